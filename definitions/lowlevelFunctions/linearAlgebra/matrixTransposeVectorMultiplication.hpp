@@ -0,0 +1,147 @@
+/*
+ * CoDiPack, a Code Differentiation Package
+ *
+ * Copyright (C) 2015-2026 Chair for Scientific Computing (SciComp), RPTU University Kaiserslautern-Landau
+ * Homepage: http://scicomp.rptu.de
+ * Contact:  Prof. Nicolas R. Gauger (codi@scicomp.uni-kl.de)
+ *
+ * Lead developers: Max Sagebaum, Johannes Blühdorn (SciComp, RPTU University Kaiserslautern-Landau)
+ *
+ * This file is part of CoDiPack (http://scicomp.rptu.de/software/codi).
+ *
+ * CoDiPack is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * CoDiPack is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * See the GNU General Public License for more details.
+ * You should have received a copy of the GNU
+ * General Public License along with CoDiPack.
+ * If not, see <http://www.gnu.org/licenses/>.
+ *
+ * For other licensing options please contact us.
+ *
+ * Authors:
+ *  - SciComp, RPTU University Kaiserslautern-Landau:
+ *    - Max Sagebaum
+ *    - Johannes Blühdorn
+ *    - Former members:
+ *      - Tim Albring
+ */
+#pragma once
+
+#include <algorithm>
+#include <vector>
+
+#include <codi/config.h>
+#include <codi/misc/macros.hpp>
+#include <codi/tools/lowlevelFunctions/generationHelperCoDiPack.hpp>
+#include <codi/tools/lowlevelFunctions/blasKernels.hpp>
+#include <codi/tools/lowlevelFunctions/lowLevelFunctionCreationUtilities.hpp>
+
+/** \copydoc codi::Namespace */
+namespace codi {
+
+  /**
+   *  Low level function for \f$y = A^T * x\f$ with
+   *   - \f$ A \in \R^{n \times m} \f$, row major
+   *   - \f$ x \in \R^{n} \f$
+   *   - \f$ y \in \R^{m} \f$
+   */
+  template<typename Type>
+  struct matrixTransposeVectorMultiplication : public LowLevelFunction {
+      [[in, store(Tape::HasPrimalValues || active_x), size(n * m)]] Type* ACTIVE_ARG(A);
+      [[in, store(Tape::HasPrimalValues || active_A), size(n)]] Type* ACTIVE_ARG(x);
+      [[out, size(m)]] Type* ACTIVE_ARG(y);
+
+      [[storeType(int), order(1)]] int n;
+      [[storeType(int), order(2)]] int m;
+
+      void primal() {
+        BlasKernels::gemvTransposed(y, A, x, n, m, false);
+      }
+
+      void primal_activity() {
+        if (active && !active_x) {
+          // Columns of A without active entries produce passive outputs.
+          for (int j = 0; j < m; j += 1) {
+            bool activeColumn = false;
+            for (int i = 0; i < n && !activeColumn; i += 1) {
+              activeColumn = 0 != A_i_in[i * m + j];
+            }
+            if (!activeColumn) {
+              y_i_out[j] = 0;
+            }
+          }
+        }
+      }
+
+      void diff_A_fwd() {
+        BlasKernels::gemvTransposed(y_d_out, A_d_in, x, n, m, false);
+      }
+
+      void diff_x_fwd() {
+        BlasKernels::gemvTransposed(y_d_out, A, x_d_in, n, m, active_A);
+      }
+
+      void diff_A_rws() {
+        BlasKernels::ger(A_b_in, x, y_b_out, n, m, false);
+      }
+
+      void diff_x_rws() {
+        BlasKernels::gemv(x_b_in, A, y_b_out, n, m, false);
+      }
+  };
+
+  /**
+   *  Low level function for \f$y = A^T * x\f$ with
+   *   - \f$ A \in \R^{n \times m} \f$, row major
+   *   - \f$ x \in \R^{n} \f$
+   *   - \f$ y \in \R^{m} \f$
+   *
+   *  The rows of A are split into blocks such that each block fits into one low level function entry. The results of
+   *  the blocks are summed up.
+   */
+  template<typename Type>
+  void matrixTransposeVectorMultiplicationRowMajor(Type const* A, Type const* x, Type* y, int n, int m) {
+    int rows = (BlasKernels::maxValuesPerCall<Type>() - m) / (m + 1);
+
+    if (rows < 1) {
+      // A single row does not fit into a low level function.
+      for (int j = 0; j < m; j += 1) {
+        Type value = 0.0;
+        for (int i = 0; i < n; i += 1) {
+          value += A[i * m + j] * x[i];
+        }
+        y[j] = value;
+      }
+    } else {
+      matrixTransposeVectorMultiplication(A, x, y, std::min(rows, n), m);
+
+      if (rows < n) {
+        std::vector<Type> partial(m);
+        for (int start = rows; start < n; start += rows) {
+          matrixTransposeVectorMultiplication(&A[start * m], &x[start], partial.data(), std::min(rows, n - start), m);
+          for (int j = 0; j < m; j += 1) {
+            y[j] += partial[j];
+          }
+        }
+      }
+    }
+  }
+
+  /**
+   *  Low level function for \f$y = A * x\f$ with
+   *   - \f$ A \in \R^{n \times m} \f$, column major
+   *   - \f$ x \in \R^{m} \f$
+   *   - \f$ y \in \R^{n} \f$
+   */
+  template<typename Type>
+  void matrixVectorMultiplicationColMajor(Type const* A, Type const* x, Type* y, int n, int m) {
+    matrixTransposeVectorMultiplicationRowMajor(A, x, y, m, n);
+  }
+}
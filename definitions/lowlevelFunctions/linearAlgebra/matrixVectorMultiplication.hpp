@@ -0,0 +1,137 @@
+/*
+ * CoDiPack, a Code Differentiation Package
+ *
+ * Copyright (C) 2015-2026 Chair for Scientific Computing (SciComp), RPTU University Kaiserslautern-Landau
+ * Homepage: http://scicomp.rptu.de
+ * Contact:  Prof. Nicolas R. Gauger (codi@scicomp.uni-kl.de)
+ *
+ * Lead developers: Max Sagebaum, Johannes Blühdorn (SciComp, RPTU University Kaiserslautern-Landau)
+ *
+ * This file is part of CoDiPack (http://scicomp.rptu.de/software/codi).
+ *
+ * CoDiPack is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * CoDiPack is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * See the GNU General Public License for more details.
+ * You should have received a copy of the GNU
+ * General Public License along with CoDiPack.
+ * If not, see <http://www.gnu.org/licenses/>.
+ *
+ * For other licensing options please contact us.
+ *
+ * Authors:
+ *  - SciComp, RPTU University Kaiserslautern-Landau:
+ *    - Max Sagebaum
+ *    - Johannes Blühdorn
+ *    - Former members:
+ *      - Tim Albring
+ */
+#pragma once
+
+#include <algorithm>
+
+#include <codi/config.h>
+#include <codi/misc/macros.hpp>
+#include <codi/tools/lowlevelFunctions/generationHelperCoDiPack.hpp>
+#include <codi/tools/lowlevelFunctions/blasKernels.hpp>
+#include <codi/tools/lowlevelFunctions/lowLevelFunctionCreationUtilities.hpp>
+
+/** \copydoc codi::Namespace */
+namespace codi {
+
+  /**
+   *  Low level function for \f$y = A * x\f$ with
+   *   - \f$ A \in \R^{n \times m} \f$, row major
+   *   - \f$ x \in \R^{m} \f$
+   *   - \f$ y \in \R^{n} \f$
+   */
+  template<typename Type>
+  struct matrixVectorMultiplication : public LowLevelFunction {
+      [[in, store(Tape::HasPrimalValues || active_x), size(n * m)]] Type* ACTIVE_ARG(A);
+      [[in, store(Tape::HasPrimalValues || active_A), size(m)]] Type* ACTIVE_ARG(x);
+      [[out, size(n)]] Type* ACTIVE_ARG(y);
+
+      [[storeType(int), order(1)]] int n;
+      [[storeType(int), order(2)]] int m;
+
+      void primal() {
+        BlasKernels::gemv(y, A, x, n, m, false);
+      }
+
+      void primal_activity() {
+        if (active && !active_x) {
+          // Rows of A without active entries produce passive outputs.
+          for (int i = 0; i < n; i += 1) {
+            bool activeRow = false;
+            for (int j = 0; j < m && !activeRow; j += 1) {
+              activeRow = 0 != A_i_in[i * m + j];
+            }
+            if (!activeRow) {
+              y_i_out[i] = 0;
+            }
+          }
+        }
+      }
+
+      void diff_A_fwd() {
+        BlasKernels::gemv(y_d_out, A_d_in, x, n, m, false);
+      }
+
+      void diff_x_fwd() {
+        BlasKernels::gemv(y_d_out, A, x_d_in, n, m, active_A);
+      }
+
+      void diff_A_rws() {
+        BlasKernels::ger(A_b_in, y_b_out, x, n, m, false);
+      }
+
+      void diff_x_rws() {
+        BlasKernels::gemvTransposed(x_b_in, A, y_b_out, n, m, false);
+      }
+  };
+
+  /**
+   *  Low level function for \f$y = A * x\f$ with
+   *   - \f$ A \in \R^{n \times m} \f$, row major
+   *   - \f$ x \in \R^{m} \f$
+   *   - \f$ y \in \R^{n} \f$
+   *
+   *  The rows of A are split into blocks such that each block fits into one low level function entry.
+   */
+  template<typename Type>
+  void matrixVectorMultiplicationRowMajor(Type const* A, Type const* x, Type* y, int n, int m) {
+    int rows = (BlasKernels::maxValuesPerCall<Type>() - m) / (m + 1);
+
+    if (rows < 1) {
+      // A single row does not fit into a low level function.
+      for (int i = 0; i < n; i += 1) {
+        Type value = 0.0;
+        for (int j = 0; j < m; j += 1) {
+          value += A[i * m + j] * x[j];
+        }
+        y[i] = value;
+      }
+    } else {
+      for (int start = 0; start < n; start += rows) {
+        matrixVectorMultiplication(&A[start * m], x, &y[start], std::min(rows, n - start), m);
+      }
+    }
+  }
+
+  /**
+   *  Low level function for \f$y = A^T * x\f$ with
+   *   - \f$ A \in \R^{m \times n} \f$, column major
+   *   - \f$ x \in \R^{m} \f$
+   *   - \f$ y \in \R^{n} \f$
+   */
+  template<typename Type>
+  void matrixTransposeVectorMultiplicationColMajor(Type const* A, Type const* x, Type* y, int m, int n) {
+    matrixVectorMultiplicationRowMajor(A, x, y, n, m);
+  }
+}
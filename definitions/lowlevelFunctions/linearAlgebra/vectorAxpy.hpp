@@ -0,0 +1,120 @@
+/*
+ * CoDiPack, a Code Differentiation Package
+ *
+ * Copyright (C) 2015-2026 Chair for Scientific Computing (SciComp), RPTU University Kaiserslautern-Landau
+ * Homepage: http://scicomp.rptu.de
+ * Contact:  Prof. Nicolas R. Gauger (codi@scicomp.uni-kl.de)
+ *
+ * Lead developers: Max Sagebaum, Johannes Blühdorn (SciComp, RPTU University Kaiserslautern-Landau)
+ *
+ * This file is part of CoDiPack (http://scicomp.rptu.de/software/codi).
+ *
+ * CoDiPack is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * CoDiPack is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * See the GNU General Public License for more details.
+ * You should have received a copy of the GNU
+ * General Public License along with CoDiPack.
+ * If not, see <http://www.gnu.org/licenses/>.
+ *
+ * For other licensing options please contact us.
+ *
+ * Authors:
+ *  - SciComp, RPTU University Kaiserslautern-Landau:
+ *    - Max Sagebaum
+ *    - Johannes Blühdorn
+ *    - Former members:
+ *      - Tim Albring
+ */
+#pragma once
+
+#include <algorithm>
+
+#include <codi/config.h>
+#include <codi/misc/macros.hpp>
+#include <codi/tools/lowlevelFunctions/generationHelperCoDiPack.hpp>
+#include <codi/tools/lowlevelFunctions/blasKernels.hpp>
+#include <codi/tools/lowlevelFunctions/lowLevelFunctionCreationUtilities.hpp>
+
+/** \copydoc codi::Namespace */
+namespace codi {
+
+  /**
+   *  Low level function for \f$r = a * x + y\f$ with
+   *   - \f$ a \in \R \f$
+   *   - \f$ x, y, r \in \R^{n} \f$
+   *
+   *  \c r may be the same array as \c y.
+   */
+  template<typename Type>
+  struct vectorAxpy : public LowLevelFunction {
+      [[in, store(Tape::HasPrimalValues || active_x), size(1)]] Type* ACTIVE_ARG(a);
+      [[in, store(Tape::HasPrimalValues || active_a), size(n)]] Type* ACTIVE_ARG(x);
+      [[in, store(Tape::HasPrimalValues), size(n)]] Type* ACTIVE_ARG(y);
+      [[out, size(n)]] Type* ACTIVE_ARG(r);
+
+      [[storeType(int), order(1)]] int n;
+
+      void primal() {
+        BlasKernels::copy(r, y, n, false);
+        BlasKernels::axpy(r, a[0], x, n, true);
+      }
+
+      void primal_activity() {
+        if (active && !active_a) {
+          // Entries with passive x and y produce passive outputs.
+          for (int i = 0; i < n; i += 1) {
+            if (!(active_x && 0 != x_i_in[i]) && !(active_y && 0 != y_i_in[i])) {
+              r_i_out[i] = 0;
+            }
+          }
+        }
+      }
+
+      void diff_a_fwd() {
+        BlasKernels::axpy(r_d_out, a_d_in[0], x, n, false);
+      }
+
+      void diff_x_fwd() {
+        BlasKernels::axpy(r_d_out, a[0], x_d_in, n, active_a);
+      }
+
+      void diff_y_fwd() {
+        BlasKernels::copy(r_d_out, y_d_in, n, active_a || active_x);
+      }
+
+      void diff_a_rws() {
+        a_b_in[0] = BlasKernels::dot(r_b_out, x, n);
+      }
+
+      void diff_x_rws() {
+        BlasKernels::axpy(x_b_in, a[0], r_b_out, n, false);
+      }
+
+      void diff_y_rws() {
+        BlasKernels::copy(y_b_in, r_b_out, n, false);
+      }
+  };
+
+  /**
+   *  Low level function for \f$y = a * x + y\f$ with
+   *   - \f$ a \in \R \f$
+   *   - \f$ x, y \in \R^{n} \f$
+   *
+   *  Large vectors are split into blocks such that each block fits into one low level function entry.
+   */
+  template<typename Type>
+  void axpy(Type const& a, Type const* x, Type* y, int n) {
+    int blockSize = (BlasKernels::maxValuesPerCall<Type>() - 1) / 3;
+
+    for (int start = 0; start < n; start += blockSize) {
+      vectorAxpy(&a, &x[start], &y[start], &y[start], std::min(blockSize, n - start));
+    }
+  }
+}
@@ -0,0 +1,108 @@
+/*
+ * CoDiPack, a Code Differentiation Package
+ *
+ * Copyright (C) 2015-2026 Chair for Scientific Computing (SciComp), RPTU University Kaiserslautern-Landau
+ * Homepage: http://scicomp.rptu.de
+ * Contact:  Prof. Nicolas R. Gauger (codi@scicomp.uni-kl.de)
+ *
+ * Lead developers: Max Sagebaum, Johannes Blühdorn (SciComp, RPTU University Kaiserslautern-Landau)
+ *
+ * This file is part of CoDiPack (http://scicomp.rptu.de/software/codi).
+ *
+ * CoDiPack is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * CoDiPack is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * See the GNU General Public License for more details.
+ * You should have received a copy of the GNU
+ * General Public License along with CoDiPack.
+ * If not, see <http://www.gnu.org/licenses/>.
+ *
+ * For other licensing options please contact us.
+ *
+ * Authors:
+ *  - SciComp, RPTU University Kaiserslautern-Landau:
+ *    - Max Sagebaum
+ *    - Johannes Blühdorn
+ *    - Former members:
+ *      - Tim Albring
+ */
+#pragma once
+
+#include <algorithm>
+
+#include <codi/config.h>
+#include <codi/misc/macros.hpp>
+#include <codi/tools/lowlevelFunctions/generationHelperCoDiPack.hpp>
+#include <codi/tools/lowlevelFunctions/blasKernels.hpp>
+#include <codi/tools/lowlevelFunctions/lowLevelFunctionCreationUtilities.hpp>
+
+/** \copydoc codi::Namespace */
+namespace codi {
+
+  /**
+   *  Low level function for \f$r = x^T * y\f$ with
+   *   - \f$ x, y \in \R^{n} \f$
+   *   - \f$ r \in \R \f$
+   */
+  template<typename Type>
+  struct vectorDotProduct : public LowLevelFunction {
+      [[in, store(Tape::HasPrimalValues || active_y), size(n)]] Type* ACTIVE_ARG(x);
+      [[in, store(Tape::HasPrimalValues || active_x), size(n)]] Type* ACTIVE_ARG(y);
+      [[out, size(1)]] Type* ACTIVE_ARG(r);
+
+      [[storeType(int), order(1)]] int n;
+
+      void primal() {
+        r[0] = BlasKernels::dot(x, y, n);
+      }
+
+      void diff_x_fwd() {
+        r_d_out[0] = BlasKernels::dot(x_d_in, y, n);
+      }
+
+      void diff_y_fwd() {
+        if (active_x) {
+          r_d_out[0] += BlasKernels::dot(x, y_d_in, n);
+        } else {
+          r_d_out[0] = BlasKernels::dot(x, y_d_in, n);
+        }
+      }
+
+      void diff_x_rws() {
+        BlasKernels::axpy(x_b_in, r_b_out[0], y, n, false);
+      }
+
+      void diff_y_rws() {
+        BlasKernels::axpy(y_b_in, r_b_out[0], x, n, false);
+      }
+  };
+
+  /**
+   *  Low level function for \f$x^T * y\f$ with \f$ x, y \in \R^{n} \f$.
+   *
+   *  Large vectors are split into blocks such that each block fits into one low level function entry.
+   */
+  template<typename Type>
+  Type dotProduct(Type const* x, Type const* y, int n) {
+    int blockSize = (BlasKernels::maxValuesPerCall<Type>() - 1) / 2;
+
+    Type r = 0.0;
+    Type partial;
+    for (int start = 0; start < n; start += blockSize) {
+      if (0 == start) {
+        vectorDotProduct(x, y, &r, std::min(blockSize, n));
+      } else {
+        vectorDotProduct(&x[start], &y[start], &partial, std::min(blockSize, n - start));
+        r += partial;
+      }
+    }
+
+    return r;
+  }
+}
@@ -0,0 +1,103 @@
+/*
+ * CoDiPack, a Code Differentiation Package
+ *
+ * Copyright (C) 2015-2026 Chair for Scientific Computing (SciComp), RPTU University Kaiserslautern-Landau
+ * Homepage: http://scicomp.rptu.de
+ * Contact:  Prof. Nicolas R. Gauger (codi@scicomp.uni-kl.de)
+ *
+ * Lead developers: Max Sagebaum, Johannes Blühdorn (SciComp, RPTU University Kaiserslautern-Landau)
+ *
+ * This file is part of CoDiPack (http://scicomp.rptu.de/software/codi).
+ *
+ * CoDiPack is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * CoDiPack is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * See the GNU General Public License for more details.
+ * You should have received a copy of the GNU
+ * General Public License along with CoDiPack.
+ * If not, see <http://www.gnu.org/licenses/>.
+ *
+ * For other licensing options please contact us.
+ *
+ * Authors:
+ *  - SciComp, RPTU University Kaiserslautern-Landau:
+ *    - Max Sagebaum
+ *    - Johannes Blühdorn
+ *    - Former members:
+ *      - Tim Albring
+ */
+#pragma once
+
+#include <codi/config.h>
+#include <codi/misc/macros.hpp>
+#include <codi/tools/lowlevelFunctions/generationHelperCoDiPack.hpp>
+#include <codi/tools/lowlevelFunctions/blasKernels.hpp>
+#include <codi/tools/lowlevelFunctions/lowLevelFunctionCreationUtilities.hpp>
+#include <codi/tools/lowlevelFunctions/linearAlgebra/vectorDotProduct.hpp>
+
+/** \copydoc codi::Namespace */
+namespace codi {
+
+  /**
+   *  Low level function for \f$r = \|x\|_2\f$ with
+   *   - \f$ x \in \R^{n} \f$
+   *   - \f$ r \in \R \f$
+   *
+   *  The derivative is defined as zero for \f$ x = 0 \f$.
+   */
+  template<typename Type>
+  struct vectorNorm2 : public LowLevelFunction {
+      [[in, store(true), size(n)]] Type* ACTIVE_ARG(x);
+      [[out, size(1)]] Type* ACTIVE_ARG(r);
+
+      [[storeType(int), order(1)]] int n;
+
+      void primal() {
+        r[0] = BlasKernels::norm2(x, n);
+      }
+
+      void diff_x_fwd() {
+        Real norm = BlasKernels::norm2(x, n);
+        if (0.0 != norm) {
+          r_d_out[0] = BlasKernels::dot(x, x_d_in, n) / norm;
+        } else {
+          r_d_out[0] = 0.0;
+        }
+      }
+
+      void diff_x_rws() {
+        Real norm = BlasKernels::norm2(x, n);
+        if (0.0 != norm) {
+          Real factor = r_b_out[0] / norm;
+          BlasKernels::axpy(x_b_in, factor, x, n, false);
+        } else {
+          for (int i = 0; i < n; i += 1) {
+            x_b_in[i] = 0.0;
+          }
+        }
+      }
+  };
+
+  /**
+   *  Low level function for \f$\|x\|_2\f$ with \f$ x \in \R^{n} \f$.
+   *
+   *  Large vectors are evaluated as the square root of a blocked dot product.
+   */
+  template<typename Type>
+  Type norm2(Type const* x, int n) {
+    Type r = 0.0;
+    if (n <= BlasKernels::maxValuesPerCall<Type>() - 1) {
+      vectorNorm2(x, &r, n);
+    } else {
+      r = sqrt(dotProduct(x, x, n));
+    }
+
+    return r;
+  }
+}
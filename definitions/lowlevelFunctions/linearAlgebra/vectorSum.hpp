@@ -0,0 +1,97 @@
+/*
+ * CoDiPack, a Code Differentiation Package
+ *
+ * Copyright (C) 2015-2026 Chair for Scientific Computing (SciComp), RPTU University Kaiserslautern-Landau
+ * Homepage: http://scicomp.rptu.de
+ * Contact:  Prof. Nicolas R. Gauger (codi@scicomp.uni-kl.de)
+ *
+ * Lead developers: Max Sagebaum, Johannes Blühdorn (SciComp, RPTU University Kaiserslautern-Landau)
+ *
+ * This file is part of CoDiPack (http://scicomp.rptu.de/software/codi).
+ *
+ * CoDiPack is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * CoDiPack is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * See the GNU General Public License for more details.
+ * You should have received a copy of the GNU
+ * General Public License along with CoDiPack.
+ * If not, see <http://www.gnu.org/licenses/>.
+ *
+ * For other licensing options please contact us.
+ *
+ * Authors:
+ *  - SciComp, RPTU University Kaiserslautern-Landau:
+ *    - Max Sagebaum
+ *    - Johannes Blühdorn
+ *    - Former members:
+ *      - Tim Albring
+ */
+#pragma once
+
+#include <algorithm>
+
+#include <codi/config.h>
+#include <codi/misc/macros.hpp>
+#include <codi/tools/lowlevelFunctions/generationHelperCoDiPack.hpp>
+#include <codi/tools/lowlevelFunctions/blasKernels.hpp>
+#include <codi/tools/lowlevelFunctions/lowLevelFunctionCreationUtilities.hpp>
+
+/** \copydoc codi::Namespace */
+namespace codi {
+
+  /**
+   *  Low level function for \f$r = \sum_i x_i\f$ with
+   *   - \f$ x \in \R^{n} \f$
+   *   - \f$ r \in \R \f$
+   */
+  template<typename Type>
+  struct vectorSum : public LowLevelFunction {
+      [[in, store(Tape::HasPrimalValues), size(n)]] Type* ACTIVE_ARG(x);
+      [[out, size(1)]] Type* ACTIVE_ARG(r);
+
+      [[storeType(int), order(1)]] int n;
+
+      void primal() {
+        r[0] = BlasKernels::sum(x, n);
+      }
+
+      void diff_x_fwd() {
+        r_d_out[0] = BlasKernels::sum(x_d_in, n);
+      }
+
+      void diff_x_rws() {
+        for (int i = 0; i < n; i += 1) {
+          x_b_in[i] = r_b_out[0];
+        }
+      }
+  };
+
+  /**
+   *  Low level function for \f$\sum_i x_i\f$ with \f$ x \in \R^{n} \f$.
+   *
+   *  Large vectors are split into blocks such that each block fits into one low level function entry.
+   */
+  template<typename Type>
+  Type sum(Type const* x, int n) {
+    int blockSize = BlasKernels::maxValuesPerCall<Type>() - 1;
+
+    Type r = 0.0;
+    Type partial;
+    for (int start = 0; start < n; start += blockSize) {
+      if (0 == start) {
+        vectorSum(x, &r, std::min(blockSize, n));
+      } else {
+        vectorSum(&x[start], &partial, std::min(blockSize, n - start));
+        r += partial;
+      }
+    }
+
+    return r;
+  }
+}
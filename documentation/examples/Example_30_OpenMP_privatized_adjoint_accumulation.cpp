@@ -0,0 +1,93 @@
+#if CODI_EnableOpenMP
+//! [Example 30 - OpenMP privatized adjoint accumulation]
+#include <codi.hpp>
+#include <chrono>
+#include <iostream>
+#include <vector>
+
+using Real = codi::RealReverseIndexOpenMP;  // each thread records on its own tape, the adjoints are shared
+using Tape = typename Real::Tape;
+using Position = typename Tape::Position;
+
+//! [Function]
+// Every thread reads all inputs, all threads update the same adjoints during the reverse sweep.
+Real func(std::vector<Real> const& x, int begin, int end) {
+  Real y = 0.0;
+  for (int i = begin; i < end; ++i) {
+    y += sin(x[i % x.size()] * (double)i);
+  }
+  return y;
+}
+//! [Function]
+
+template<codi::OpenMPAdjointAccumulation accumulation>
+void run(std::string const& name, int n, int m) {
+  Tape& tape = Real::getTape();
+
+  std::vector<Real> x(m);
+  tape.setActive();
+  for (int j = 0; j < m; ++j) {
+    x[j] = 1.0 + j / (double)m;
+    tape.registerInput(x[j]);
+  }
+
+  codi::OpenMPAdjointEvaluation<Tape, accumulation> evaluation;  // Step 1: Create one evaluation object for the team
+  double time = 0.0;
+
+  #pragma omp parallel
+  {
+    Tape& threadTape = Real::getTape();  // the thread-local tape
+    threadTape.setActive();
+    Position start = threadTape.getPosition();
+
+    int const numThreads = omp_get_num_threads();
+    int const threadId = omp_get_thread_num();
+    Real y = func(x, n * threadId / numThreads, n * (threadId + 1) / numThreads);
+
+    threadTape.registerOutput(y);
+    threadTape.setPassive();
+    y.setGradient(1.0);
+
+    #pragma omp barrier
+    auto begin = std::chrono::steady_clock::now();
+
+    // Step 2: All threads evaluate their own tape, the adjoints of x are accumulated over all threads
+    evaluation.evaluate(threadTape, threadTape.getPosition(), start);
+
+    #pragma omp master
+    {
+      time = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+    }
+
+    threadTape.resetTo(start, false);
+  }
+
+  double sum = 0.0;
+  for (int j = 0; j < m; ++j) {
+    sum += x[j].getGradient();
+  }
+
+  std::cout << name << ": sum of df/dx = " << sum << ", reverse sweep " << time << " s" << std::endl;
+
+  tape.clearAdjoints();
+  tape.reset();
+}
+
+int main(int nargs, char** args) {
+  int const n = 1000000;  // number of statements
+  int const m = 100;      // number of inputs
+
+  run<codi::OpenMPAdjointAccumulation::Atomic>("Atomic    ", n, m);
+  run<codi::OpenMPAdjointAccumulation::Privatized>("Privatized", n, m);
+
+  return 0;
+}
+//! [Example 30 - OpenMP privatized adjoint accumulation]
+#else
+#include <iostream>
+
+int main(int nargs, char** args) {
+  std::cout << "Please compile with 'make OPENMP=yes'." << std::endl;
+  return 0;
+}
+#endif
@@ -0,0 +1,74 @@
+//! [Example 31 - Mixed precision Jacobians]
+#include <codi.hpp>
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+//! [Function]
+template<typename Real>
+Real func(std::vector<Real> const& x, int n) {
+  Real y = 0.0;
+  for (int i = 0; i < n; ++i) {
+    Real t = sin(x[i % x.size()]) * exp(0.001 * x[(7 * i) % x.size()]) / x[(3 * i) % x.size()];
+    y += t * t;
+  }
+  return y;
+}
+//! [Function]
+
+template<typename Real>
+std::vector<double> gradient(std::string const& name, int n, int m) {
+  using Tape = typename Real::Tape;
+  Tape& tape = Real::getTape();
+
+  std::vector<Real> x(m);
+  tape.setActive();
+  for (int j = 0; j < m; ++j) {
+    x[j] = 1.0 + j / (double)m;
+    tape.registerInput(x[j]);
+  }
+
+  Real y = func(x, n);
+
+  tape.registerOutput(y);
+  tape.setPassive();
+  y.setGradient(1.0);
+  tape.evaluate();
+
+  std::vector<double> grad(m);
+  for (int j = 0; j < m; ++j) {
+    grad[j] = (double)x[j].getGradient();
+  }
+
+  std::cout << name << ": tape memory " << tape.getTapeValues().getUsedMemorySize() / 1024.0 / 1024.0 << " MB"
+            << std::endl;
+
+  tape.reset();
+
+  return grad;
+}
+
+int main(int nargs, char** args) {
+  int const n = 100000;  // number of statements
+  int const m = 100;     // number of inputs
+
+  std::vector<double> reference = gradient<codi::RealReverse>("double Jacobians          ", n, m);
+  std::vector<double> mixed = gradient<codi::RealReverseMixed>("float Jacobians           ", n, m);
+  std::vector<double> mixedAdj =
+      gradient<codi::RealReverseMixedGen<double, float, float>>("float Jacobians + adjoints", n, m);
+
+  // Relative error of the mixed precision gradients with respect to the full precision gradient.
+  double errorMixed = 0.0;
+  double errorMixedAdj = 0.0;
+  for (int j = 0; j < m; ++j) {
+    errorMixed = std::max(errorMixed, std::abs(mixed[j] - reference[j]) / std::abs(reference[j]));
+    errorMixedAdj = std::max(errorMixedAdj, std::abs(mixedAdj[j] - reference[j]) / std::abs(reference[j]));
+  }
+
+  std::cout << "Max. relative error float Jacobians:            " << errorMixed << std::endl;
+  std::cout << "Max. relative error float Jacobians + adjoints: " << errorMixedAdj << std::endl;
+
+  return 0;
+}
+//! [Example 31 - Mixed precision Jacobians]
@@ -0,0 +1,90 @@
+//! [Example 32 - Linear system factorization reuse]
+#include <codi.hpp>
+#include <chrono>
+#include <iostream>
+
+#if CODI_EnableEigen
+
+using Real = codi::RealReverseVec<4>;  // Four directions are evaluated in one reverse sweep.
+using Tape = typename Real::Tape;
+
+template<typename T>
+using Matrix = Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic>;
+template<typename T>
+using Vector = Eigen::Matrix<T, Eigen::Dynamic, 1>;
+
+//! [Solvers]
+// Solves every system from scratch, the reverse mode solves the transposed system once per direction.
+template<typename Number>
+struct EigenSolver : public codi::EigenLinearSystem<Number, Matrix, Vector> {
+  public:
+
+    using Base = codi::EigenLinearSystem<Number, Matrix, Vector>;
+    using MatrixReal = typename Base::MatrixReal;
+    using VectorReal = typename Base::VectorReal;
+
+    void solveSystem(MatrixReal const* A, VectorReal const* b, VectorReal* x) {
+      *x = A->partialPivLu().solve(*b);
+    }
+};
+
+// Keeps the LU decomposition from the primal solve and solves all directions at once.
+template<typename Number>
+using EigenSolverLU = codi::EigenLinearSystemLU<Number, Matrix, Vector>;
+//! [Solvers]
+
+template<typename Solver>
+void run(std::string const& name, int size) {
+  Tape& tape = Real::getTape();
+
+  Matrix<Real> A(size, size);
+  Vector<Real> rhs(size);
+  Vector<Real> sol(size);
+
+  tape.setActive();
+  for (int i = 0; i < size; i += 1) {
+    for (int j = 0; j < size; j += 1) {
+      A(i, j) = (i == j) ? 2.0 * size : 1.0 / (1.0 + i + j);
+      tape.registerInput(A(i, j));
+    }
+    rhs(i) = 1.0 + i;
+    tape.registerInput(rhs(i));
+  }
+
+  auto begin = std::chrono::steady_clock::now();
+  codi::solveLinearSystem(Solver(), A, rhs, sol);
+  double timePrimal = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+
+  for (int i = 0; i < size; i += 1) {
+    tape.registerOutput(sol(i));
+  }
+  tape.setPassive();
+
+  for (int d = 0; d < 4; d += 1) {
+    sol(d).gradient()[d] = 1.0;
+  }
+
+  begin = std::chrono::steady_clock::now();
+  tape.evaluate();
+  double timeReverse = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+
+  std::cout << name << ": primal " << timePrimal << " s, reverse " << timeReverse << " s, ratio "
+            << timeReverse / timePrimal << ", d sol(0)/d rhs(0) = " << rhs(0).getGradient()[0] << std::endl;
+
+  tape.reset();
+}
+#endif
+
+int main(int nargs, char** args) {
+#if CODI_EnableEigen
+  int size = 400;
+
+  run<EigenSolver<Real>>("Solve from scratch", size);
+  run<EigenSolverLU<Real>>("Reuse LU          ", size);
+#else
+  std::cerr << "EIGEN_DIR not set. Skipping Eigen example." << std::endl;
+#endif
+
+  return 0;
+}
+//! [Example 32 - Linear system factorization reuse]
@@ -0,0 +1,95 @@
+//! [Example 33 - Warm started iterative linear system solves]
+#include <codi.hpp>
+#include <iostream>
+
+#if CODI_EnableEigen
+
+using Real = codi::RealReversePrimal;
+using Tape = typename Real::Tape;
+using Identifier = typename Real::Identifier;
+
+template<typename T>
+using Matrix = Eigen::SparseMatrix<T>;
+template<typename T>
+using Vector = Eigen::Matrix<T, Eigen::Dynamic, 1>;
+
+template<typename Number>
+using Solver = codi::SparseEigenLinearSystemIterative<Number, Matrix, Vector>;
+
+void run(std::string const& name, codi::LinearSystemSolverHints hints, int size) {
+  Tape& tape = Real::getTape();
+  codi::LinearSystemSolverStatistics& statistics = codi::LinearSystemSolverStatistics::getGlobal();
+
+  std::vector<Real> p(size);
+  Matrix<Real> A(size, size);
+  Vector<Real> rhs(size);
+  Vector<Real> sol(size);
+
+  tape.setActive();
+  for (int i = 0; i < size; i += 1) {
+    p[i] = 1.0 + 0.01 * i;
+    tape.registerInput(p[i]);
+  }
+
+  std::vector<Eigen::Triplet<Real>> entries;
+  for (int i = 0; i < size; i += 1) {
+    entries.push_back(Eigen::Triplet<Real>(i, i, 2.05 + 0.01 * p[i]));
+    if (0 != i) {
+      entries.push_back(Eigen::Triplet<Real>(i, i - 1, -1.0 + 0.01 * p[i]));
+    }
+    if (size - 1 != i) {
+      entries.push_back(Eigen::Triplet<Real>(i, i + 1, -1.0 - 0.01 * p[i]));
+    }
+    rhs(i) = p[i] * p[i];
+  }
+  A.setFromTriplets(entries.begin(), entries.end());
+
+  //! [Hints]
+  codi::solveLinearSystem(Solver<Real>(), A, rhs, sol, hints);
+  //! [Hints]
+
+  Real y = 0.0;
+  for (int i = 0; i < size; i += 1) {
+    y += sol(i) * sol(i);
+  }
+  tape.registerOutput(y);
+  tape.setPassive();
+
+  // Optimization loop: The design changes a little in each iteration, the tape is reevaluated.
+  statistics.reset();
+  for (int iter = 0; iter < 10; iter += 1) {
+    for (int i = 0; i < size; i += 1) {
+      tape.primal(p[i].getIdentifier()) += 1e-4;
+    }
+    tape.evaluatePrimal();
+
+    tape.clearAdjoints();
+    tape.gradient(y.getIdentifier()) = 1.0;
+    tape.evaluate();
+  }
+
+  std::cout << name << ": d y/d p[0] = " << tape.gradient(p[0].getIdentifier()) << std::endl;
+  statistics.printStatistics();
+
+  tape.reset();
+}
+#endif
+
+int main(int nargs, char** args) {
+#if CODI_EnableEigen
+  int size = 1000;
+
+  codi::LinearSystemSolverHints hints = codi::LinearSystemSolverHints::NONE();
+  hints |= codi::LinearSystemSolverFlags::ReverseEvaluation;
+  hints |= codi::LinearSystemSolverFlags::PrimalEvaluation;
+  hints.setTolerance(1e-12).setMaxIterations(1000);
+
+  run("Cold start", hints, size);
+  run("Warm start", hints | codi::LinearSystemSolverFlags::WarmStart, size);
+#else
+  std::cerr << "EIGEN_DIR not set. Skipping Eigen example." << std::endl;
+#endif
+
+  return 0;
+}
+//! [Example 33 - Warm started iterative linear system solves]
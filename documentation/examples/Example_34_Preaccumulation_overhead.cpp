@@ -0,0 +1,102 @@
+//! [Example 34 - Preaccumulation overhead]
+#include <codi.hpp>
+#include <chrono>
+#include <iostream>
+
+//! [Function]
+// Small region with four inputs and two outputs, typical for a flux or material law evaluation.
+template<typename Real>
+void region(Real const* x, Real* y) {
+  Real a = x[0] * x[1];
+  Real b = x[2] / x[3];
+  for (int i = 0; i < 5; ++i) {
+    a = sin(a) + b * x[i % 4];
+    b = cos(b) * a;
+  }
+  y[0] = a + b;
+  y[1] = a * b;
+}
+//! [Function]
+
+enum class Strategy {
+  None,
+  Finish,
+  LocalMappedAdjoints,
+  LocalAdjointVectorPreprocessTape,
+  LocalAdjoints
+};
+
+template<typename Real>
+void run(std::string const& name, Strategy strategy, int calls) {
+  using Tape = typename Real::Tape;
+
+  Tape& tape = Real::getTape();
+  tape.setActive();
+
+  Real x[4] = {1.0, 2.0, 3.0, 4.0};
+  for (int i = 0; i < 4; ++i) {
+    tape.registerInput(x[i]);
+  }
+
+  // The helper is reused for all regions so that its internal memory can be reused.
+  codi::PreaccumulationHelper<Real> ph;
+  Real y[2];
+  Real sum = 0.0;
+
+  auto begin = std::chrono::steady_clock::now();
+  for (int c = 0; c < calls; ++c) {
+    if (Strategy::None != strategy) {
+      ph.start(x[0], x[1], x[2], x[3]);
+    }
+
+    region(x, y);
+
+    switch (strategy) {
+      case Strategy::None:  // Reference without preaccumulation.
+        break;
+      case Strategy::Finish:
+        ph.finish(false, y[0], y[1]);
+        break;
+      case Strategy::LocalMappedAdjoints:
+        ph.finishLocalMappedAdjoints(y[0], y[1]);
+        break;
+      case Strategy::LocalAdjointVectorPreprocessTape:
+        ph.finishLocalAdjointVectorPreprocessTape(y[0], y[1]);
+        break;
+      case Strategy::LocalAdjoints:
+        ph.finishLocalAdjoints(y[0], y[1]);
+        break;
+    }
+
+    sum += y[0] + y[1];
+  }
+  double time = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+
+  tape.registerOutput(sum);
+  tape.setPassive();
+  sum.setGradient(1.0);
+  tape.evaluate();
+
+  std::cout << name << ": " << 1e9 * time / calls << " ns per region, df/dx_0 = " << x[0].getGradient() << std::endl;
+
+  tape.reset();
+}
+
+int main(int nargs, char** args) {
+  int const calls = 200000;
+
+  run<codi::RealReverseIndex>("RealReverseIndex no preaccumulation                    ", Strategy::None, calls);
+  run<codi::RealReverseIndex>("RealReverseIndex finish                                ", Strategy::Finish, calls);
+  run<codi::RealReverseIndex>("RealReverseIndex finishLocalMappedAdjoints             ",
+                              Strategy::LocalMappedAdjoints, calls);
+  run<codi::RealReverseIndex>("RealReverseIndex finishLocalAdjointVectorPreprocessTape",
+                              Strategy::LocalAdjointVectorPreprocessTape, calls);
+  run<codi::RealReverseIndex>("RealReverseIndex finishLocalAdjoints                   ", Strategy::LocalAdjoints,
+                              calls);
+  run<codi::RealReverse>("RealReverse      finishLocalMappedAdjoints             ", Strategy::LocalMappedAdjoints,
+                         calls);
+  run<codi::RealReverse>("RealReverse      finishLocalAdjoints                   ", Strategy::LocalAdjoints, calls);
+
+  return 0;
+}
+//! [Example 34 - Preaccumulation overhead]
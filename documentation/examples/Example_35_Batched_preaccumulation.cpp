@@ -0,0 +1,109 @@
+#if CODI_EnableOpenMP
+//! [Example 35 - Batched preaccumulation]
+#include <codi.hpp>
+#include <chrono>
+#include <iostream>
+#include <vector>
+
+using Real = codi::RealReverseIndexOpenMP;  // each thread records on its own tape
+using Tape = typename Real::Tape;
+using Position = typename Tape::Position;
+
+//! [Function]
+// Flux of one mesh cell with four inputs and two outputs. The same statements are recorded for every cell.
+void flux(Real const* u, Real* f) {
+  Real a = u[0] * u[1];
+  Real b = u[2] / u[3];
+  for (int i = 0; i < 5; ++i) {
+    a = sin(a) + b * u[i % 4];
+    b = cos(b) * a;
+  }
+  f[0] = a + b;
+  f[1] = a * b;
+}
+//! [Function]
+
+template<bool batched>
+void run(std::string const& name, int cells) {
+  Tape& tape = Real::getTape();
+
+  std::vector<Real> u(cells + 3);
+  std::vector<Real> f(2 * cells);
+  tape.setActive();
+  for (int i = 0; i < cells + 3; ++i) {
+    u[i] = 1.0 + i / (double)cells;
+    tape.registerInput(u[i]);
+  }
+
+  using Helper = codi::PreaccumulationBatchHelper<Real>;
+  double time = 0.0;
+  auto begin = std::chrono::steady_clock::now();
+
+  //! [Helper pool]
+  codi::OpenMPPreaccumulationHelperPool<Real, Helper> pool;  // one helper per thread, created outside of the team
+
+  #pragma omp parallel
+  {
+    Helper& ph = pool.get();  // the helper of this thread, reused for all of its cells
+    Tape& threadTape = Real::getTape();
+    threadTape.setActive();
+    Position start = threadTape.getPosition();
+
+    #pragma omp for schedule(static)
+    for (int c = 0; c < cells; ++c) {
+      //! [Batched preaccumulation]
+      ph.start(u[c], u[c + 1], u[c + 2], u[c + 3]);
+      flux(&u[c], &f[2 * c]);
+      if (batched) {
+        ph.finishBatched(f[2 * c], f[2 * c + 1]);  // only records the region
+      } else {
+        ph.finishLocalAdjoints(f[2 * c], f[2 * c + 1]);
+      }
+      //! [Batched preaccumulation]
+    }
+
+    ph.preaccumulateBatch();  // preaccumulates all regions of this thread, f can be used afterwards
+
+    #pragma omp barrier
+    #pragma omp master
+    {
+      time = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+    }
+
+    // Each thread sums up its own fluxes and evaluates its own tape.
+    Real sum = 0.0;
+    #pragma omp for schedule(static)
+    for (int c = 0; c < cells; ++c) {
+      sum += f[2 * c] + f[2 * c + 1];
+    }
+
+    threadTape.registerOutput(sum);
+    threadTape.setPassive();
+    sum.setGradient(1.0);
+    threadTape.evaluate(threadTape.getPosition(), start);
+    threadTape.resetTo(start, false);
+  }
+  //! [Helper pool]
+
+  std::cout << name << ": " << 1e9 * time / cells << " ns per cell, df/du_0 = " << u[0].getGradient() << std::endl;
+
+  tape.reset();
+}
+
+int main(int nargs, char** args) {
+  int const cells = 200000;
+
+  run<false>("finishLocalAdjoints", cells);
+  run<true>("finishBatched      ", cells);
+
+  return 0;
+}
+//! [Example 35 - Batched preaccumulation]
+#else
+#include <iostream>
+
+int main(int nargs, char** args) {
+  std::cout << "Please compile with 'make OPENMP=yes'." << std::endl;
+  return 0;
+}
+#endif
@@ -0,0 +1,91 @@
+//! [Example 36 - Preaccumulation region optimizer]
+#include <codi.hpp>
+#include <chrono>
+#include <iostream>
+#include <vector>
+
+using Real = codi::RealReverseIndex;  // the rewrite requires a Jacobian tape with editing support
+using Tape = typename Real::Tape;
+using Identifier = typename Real::Identifier;
+
+// Flux of one mesh cell with four inputs and two outputs.
+void flux(Real const* u, Real* f) {
+  Real a = u[0] * u[1];
+  Real b = u[2] / u[3];
+  for (int i = 0; i < 5; ++i) {
+    a = sin(a) + b * u[i % 4];
+    b = cos(b) * a;
+  }
+  f[0] = a + b;
+  f[1] = a * b;
+}
+
+double evaluate(Tape& tape, Real& y, std::vector<Real>& u, int evaluations) {
+  auto begin = std::chrono::steady_clock::now();
+  for (int i = 0; i < evaluations; ++i) {
+    tape.clearAdjoints();
+    y.setGradient(1.0);
+    tape.evaluate();
+  }
+  double time = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+
+  std::cout << "  df/du_0 = " << u[0].getGradient() << ", " << 1e3 * time / evaluations << " ms per reverse sweep"
+            << std::endl;
+
+  return time;
+}
+
+int main(int nargs, char** args) {
+  int const cells = 100000;
+  int const evaluations = 10;
+
+  Tape& tape = Real::getTape();
+  tape.setActive();
+
+  std::vector<Real> u(cells + 3);
+  for (int i = 0; i < cells + 3; ++i) {
+    u[i] = 1.0 + i / (double)cells;
+    tape.registerInput(u[i]);
+  }
+
+  Real y = 0.0;
+  {
+    std::vector<Real> f(2);
+    for (int c = 0; c < cells; ++c) {
+      flux(&u[c], f.data());
+      y += f[0] * f[1];
+    }
+  }
+  tape.registerOutput(y);
+  tape.setPassive();
+
+  std::cout << "Recorded tape:" << std::endl;
+  evaluate(tape, y, u, evaluations);
+
+  //! [Optimizer]
+  codi::PreaccumulationRegionOptimizer<Tape> optimizer(tape);
+
+  // Provide all values that are used after the recording.
+  optimizer.analyze([&y](auto&& func) {
+    func(y.getIdentifier());
+  });
+
+  optimizer.writeStatsVerbose(std::cout);
+  optimizer.rewrite();
+  //! [Optimizer]
+
+  // The first regions of the report.
+  std::vector<codi::PreaccumulationRegionOptimizer<Tape>::Region> const& regions = optimizer.getRegions();
+  for (size_t i = 0; i < 2 && i < regions.size(); ++i) {
+    std::cout << "Region " << i << ": entries [" << regions[i].firstEntry << ", " << regions[i].endEntry << "), "
+              << regions[i].inputs.size() << " inputs, " << regions[i].outputs.size() << " outputs" << std::endl;
+  }
+
+  std::cout << "Rewritten tape:" << std::endl;
+  evaluate(tape, y, u, evaluations);
+
+  tape.reset();
+
+  return 0;
+}
+//! [Example 36 - Preaccumulation region optimizer]
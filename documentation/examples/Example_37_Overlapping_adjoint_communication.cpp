@@ -0,0 +1,207 @@
+#if CODI_EnableMPI
+//! [Example 37 - Overlapping adjoint communication]
+#include <codi.hpp>
+#include <mpi.h>
+
+#include <chrono>
+#include <iostream>
+#include <vector>
+
+using Real = codi::RealReverse;
+using Tape = typename Real::Tape;
+using Identifier = typename Real::Identifier;
+using AsyncHelper = codi::AsyncReverseHelper<Real>;
+using VectorAccess = typename AsyncHelper::VectorAccess;
+
+// Tags for the messages that are sent to the left and to the right neighbour.
+int const TagLeft = 0;
+int const TagRight = 1;
+
+//! [Halo exchange]
+struct HaloExchange {
+    int left;
+    int right;
+
+    Identifier boundaryIds[2];  // Sent values, first and last cell.
+    Identifier haloIds[2];      // Received values, from the left and from the right neighbour.
+
+    double sendBuffer[2];
+    double receiveBuffer[2];
+    MPI_Request requests[4];
+};
+
+// Post the adjoint communication. The adjoints of the halo values are final and sent back to their owners.
+void startHaloExchangeReverse(Tape* tape, void* d, VectorAccess* access) {
+  HaloExchange* data = (HaloExchange*)d;
+
+  for (int i = 0; i < 2; ++i) {
+    data->sendBuffer[i] = access->getAdjoint(data->haloIds[i], 0);
+    access->resetAdjoint(data->haloIds[i], 0);
+  }
+
+  MPI_Irecv(&data->receiveBuffer[0], 1, MPI_DOUBLE, data->left, TagRight, MPI_COMM_WORLD, &data->requests[0]);
+  MPI_Irecv(&data->receiveBuffer[1], 1, MPI_DOUBLE, data->right, TagLeft, MPI_COMM_WORLD, &data->requests[1]);
+  MPI_Isend(&data->sendBuffer[0], 1, MPI_DOUBLE, data->left, TagLeft, MPI_COMM_WORLD, &data->requests[2]);
+  MPI_Isend(&data->sendBuffer[1], 1, MPI_DOUBLE, data->right, TagRight, MPI_COMM_WORLD, &data->requests[3]);
+}
+
+// Wait for the adjoint communication and add the received adjoints to the boundary values.
+void finishHaloExchangeReverse(Tape* tape, void* d, VectorAccess* access) {
+  HaloExchange* data = (HaloExchange*)d;
+
+  MPI_Waitall(4, data->requests, MPI_STATUSES_IGNORE);
+
+  for (int i = 0; i < 2; ++i) {
+    access->updateAdjoint(data->boundaryIds[i], 0, data->receiveBuffer[i]);
+  }
+}
+
+void deleteHaloExchange(Tape* tape, void* d) {
+  delete (HaloExchange*)d;
+}
+
+// Primal halo exchange. The received values are new inputs of the tape.
+void haloExchange(std::vector<Real>& u, Real& haloLeft, Real& haloRight, int left, int right,
+                  AsyncHelper::Cut* cut) {
+  int n = (int)u.size();
+  double send[2] = {u[0].getValue(), u[n - 1].getValue()};
+  double receive[2];
+  MPI_Sendrecv(&send[0], 1, MPI_DOUBLE, left, TagLeft, &receive[1], 1, MPI_DOUBLE, right, TagLeft, MPI_COMM_WORLD,
+               MPI_STATUS_IGNORE);
+  MPI_Sendrecv(&send[1], 1, MPI_DOUBLE, right, TagRight, &receive[0], 1, MPI_DOUBLE, left, TagRight, MPI_COMM_WORLD,
+               MPI_STATUS_IGNORE);
+
+  Tape& tape = Real::getTape();
+  haloLeft = receive[0];
+  haloRight = receive[1];
+  tape.registerInput(haloLeft);
+  tape.registerInput(haloRight);
+
+  HaloExchange* data = new HaloExchange{left, right, {u[0].getIdentifier(), u[n - 1].getIdentifier()},
+                                        {haloLeft.getIdentifier(), haloRight.getIdentifier()}, {}, {}, {}};
+  AsyncHelper::pushAsyncFunction(cut, startHaloExchangeReverse, finishHaloExchangeReverse, data,
+                                 deleteHaloExchange);
+}
+//! [Halo exchange]
+
+Real update(Real const& uLeft, Real const& uCenter, Real const& uRight) {
+  Real r = uCenter + 0.1 * (uLeft - 2.0 * uCenter + uRight);
+  for (int i = 0; i < 4; ++i) {
+    r = r + 0.001 * cos(r) * uCenter;
+  }
+  return r;
+}
+
+//! [Async functions]
+void iterate(std::vector<Real>& u, int left, int right, bool overlap) {
+  int n = (int)u.size();
+  std::vector<Real> uNew(n);
+  Real haloLeft, haloRight;
+
+  // The boundary values are computed, all following statements are independent of the adjoint communication.
+  AsyncHelper::Cut* cut = nullptr;
+  if (overlap) {
+    cut = AsyncHelper::addCut();
+  }
+
+  for (int i = 1; i < n - 1; ++i) {
+    uNew[i] = update(u[i - 1], u[i], u[i + 1]);
+  }
+
+  if (!overlap) {
+    cut = AsyncHelper::addCut();  // Communication is finished directly after it has been started.
+  }
+  haloExchange(u, haloLeft, haloRight, left, right, cut);
+
+  uNew[0] = update(haloLeft, u[0], u[1]);
+  uNew[n - 1] = update(u[n - 2], u[n - 1], haloRight);
+
+  u.swap(uNew);
+}
+//! [Async functions]
+
+void run(int rank, int size, bool overlap, int cells, int iterations, int evaluations) {
+  int left = (rank + size - 1) % size;
+  int right = (rank + 1) % size;
+
+  Tape& tape = Real::getTape();
+  tape.setActive();
+
+  std::vector<Real> x(cells);
+  for (int i = 0; i < cells; ++i) {
+    x[i] = 1.0 + 0.5 * sin(i + rank * cells);
+    tape.registerInput(x[i]);
+  }
+
+  std::vector<Real> u = x;
+  for (int it = 0; it < iterations; ++it) {
+    iterate(u, left, right, overlap);
+  }
+
+  // Each rank seeds its own part of the global objective.
+  Real y = 0.0;
+  for (int i = 0; i < cells; ++i) {
+    y += u[i] * u[i];
+  }
+  tape.registerOutput(y);
+  tape.setPassive();
+
+  // Warm-up evaluation.
+  tape.clearAdjoints();
+  y.setGradient(1.0);
+  tape.evaluate();
+
+  MPI_Barrier(MPI_COMM_WORLD);
+  auto begin = std::chrono::steady_clock::now();
+  for (int e = 0; e < evaluations; ++e) {
+    tape.clearAdjoints();
+    y.setGradient(1.0);
+    tape.evaluate();
+  }
+  double time = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count() / evaluations;
+
+  double localNorm = 0.0;
+  for (int i = 0; i < cells; ++i) {
+    localNorm += x[i].getGradient() * x[i].getGradient();
+  }
+
+  double norm = 0.0;
+  double maxTime = 0.0;
+  MPI_Reduce(&localNorm, &norm, 1, MPI_DOUBLE, MPI_SUM, 0, MPI_COMM_WORLD);
+  MPI_Reduce(&time, &maxTime, 1, MPI_DOUBLE, MPI_MAX, 0, MPI_COMM_WORLD);
+
+  if (0 == rank) {
+    std::cout << (overlap ? "Overlapped" : "Synchronous") << " adjoint communication: |df/dx|^2 = " << norm << ", "
+              << 1e3 * maxTime << " ms per reverse sweep" << std::endl;
+  }
+
+  tape.reset();
+}
+
+int main(int nargs, char** args) {
+  MPI_Init(&nargs, &args);
+
+  int rank, size;
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+  MPI_Comm_size(MPI_COMM_WORLD, &size);
+
+  int const cells = 2000;
+  int const iterations = 100;
+  int const evaluations = 10;
+
+  run(rank, size, false, cells, iterations, evaluations);
+  run(rank, size, true, cells, iterations, evaluations);
+
+  MPI_Finalize();
+
+  return 0;
+}
+//! [Example 37 - Overlapping adjoint communication]
+#else
+#include <iostream>
+
+int main(int nargs, char** args) {
+  std::cout << "Please compile with 'make MPI=yes MEDI_DIR=<path to medipack>' (You have to install MeDiPack, too)" << std::endl;
+  return 0;
+}
+#endif
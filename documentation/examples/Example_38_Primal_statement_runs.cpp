@@ -0,0 +1,78 @@
+//! [Example 38 - Primal statement runs]
+#include <codi.hpp>
+#include <chrono>
+#include <iostream>
+#include <vector>
+
+//! [Stencil]
+// One explicit step of a 2D diffusion equation. All interior cells record the same expression, so the tape contains
+// long runs of statements with the same handle.
+template<typename Real>
+void step(std::vector<Real> const& u, std::vector<Real>& uNew, int n) {
+  for (int i = 1; i < n - 1; ++i) {
+    for (int j = 1; j < n - 1; ++j) {
+      int c = i * n + j;
+      uNew[c] = u[c] + 0.1 * (u[c - 1] + u[c + 1] + u[c - n] + u[c + n] - 4.0 * u[c]) + 0.01 * u[c] * u[c];
+    }
+  }
+}
+//! [Stencil]
+
+template<typename Real>
+void run(std::string const& name, int n, int steps, int evaluations) {
+  using Tape = typename Real::Tape;
+
+  Tape& tape = Real::getTape();
+  tape.setActive();
+
+  std::vector<Real> x(n * n);
+  for (int c = 0; c < n * n; ++c) {
+    x[c] = 1.0 + 0.1 * sin(c);
+    tape.registerInput(x[c]);
+  }
+
+  std::vector<Real> u = x;
+  std::vector<Real> uNew = x;
+  for (int s = 0; s < steps; ++s) {
+    step(u, uNew, n);
+    std::swap(u, uNew);
+  }
+
+  Real y = 0.0;
+  for (int c = 0; c < n * n; ++c) {
+    y += u[c];
+  }
+  tape.registerOutput(y);
+  tape.setPassive();
+
+  // Warm-up evaluation.
+  y.setGradient(1.0);
+  tape.evaluate();
+
+  auto begin = std::chrono::steady_clock::now();
+  for (int e = 0; e < evaluations; ++e) {
+    tape.clearAdjoints();
+    y.setGradient(1.0);
+    tape.evaluate();
+  }
+  double time = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count() / evaluations;
+
+  std::cout << name << ": dy/dx_0 = " << x[n + 1].getGradient() << ", " << 1e3 * time << " ms per reverse sweep"
+            << std::endl;
+
+  tape.reset();
+}
+
+int main(int nargs, char** args) {
+  int const n = 100;
+  int const steps = 20;
+  int const evaluations = 20;
+
+  std::cout << "Statement runs " << (codi::Config::ReverseStatementRuns ? "enabled" : "disabled") << std::endl;
+  run<codi::RealReverse>("RealReverse", n, steps, evaluations);
+  run<codi::RealReversePrimal>("RealReversePrimal", n, steps, evaluations);
+  run<codi::RealReversePrimalIndex>("RealReversePrimalIndex", n, steps, evaluations);
+
+  return 0;
+}
+//! [Example 38 - Primal statement runs]
@@ -0,0 +1,95 @@
+//! [Example 39 - Switch statement evaluator]
+#include <codi.hpp>
+#include <chrono>
+#include <iostream>
+#include <vector>
+
+//! [Expressions]
+// Update of a 1D reaction diffusion system with two species. The two expressions alternate in the tape.
+template<typename Real>
+auto updateU(Real const& u, Real const& v, Real const& uLeft, Real const& uRight) {
+  return u + 0.1 * (uLeft - 2.0 * u + uRight) - 0.05 * u * v;
+}
+
+template<typename Real>
+auto updateV(Real const& u, Real const& v) {
+  return v + 0.05 * u * v - 0.02 * v;
+}
+//! [Expressions]
+
+//! [Registry]
+// Closed list of the statements of the program. The position in the list is the handle of the statement.
+template<typename Tape>
+struct ExampleRegistry {
+    using Real = codi::ActiveType<Tape>;
+
+    using Statements = std::tuple<
+        codi::AssignStatement<Real, decltype(updateU(std::declval<Real>(), std::declval<Real>(), std::declval<Real>(),
+                                                     std::declval<Real>()))>,
+        codi::AssignStatement<Real, decltype(updateV(std::declval<Real>(), std::declval<Real>()))>>;
+};
+
+using RealSwitch =
+    codi::RealReversePrimalGen<double, double, int, codi::SwitchStatementEvaluator<ExampleRegistry>>;
+//! [Registry]
+
+template<typename Real>
+void run(std::string const& name, int n, int steps, int evaluations) {
+  using Tape = typename Real::Tape;
+
+  Tape& tape = Real::getTape();
+  tape.setActive();
+
+  std::vector<Real> x(n);
+  for (int i = 0; i < n; ++i) {
+    x[i] = 1.0 + 0.1 * sin(i);
+    tape.registerInput(x[i]);
+  }
+
+  std::vector<Real> u = x;
+  std::vector<Real> v(n, 0.5);
+  std::vector<Real> uNew = u;
+  for (int s = 0; s < steps; ++s) {
+    for (int i = 1; i < n - 1; ++i) {
+      uNew[i] = updateU(u[i], v[i], u[i - 1], u[i + 1]);
+      v[i] = updateV(u[i], v[i]);
+    }
+    std::swap(u, uNew);
+  }
+
+  Real y = 0.0;
+  for (int i = 0; i < n; ++i) {
+    y += u[i] * v[i];
+  }
+  tape.registerOutput(y);
+  tape.setPassive();
+
+  // Warm-up evaluation.
+  y.setGradient(1.0);
+  tape.evaluate();
+
+  auto begin = std::chrono::steady_clock::now();
+  for (int e = 0; e < evaluations; ++e) {
+    tape.clearAdjoints();
+    y.setGradient(1.0);
+    tape.evaluate();
+  }
+  double time = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count() / evaluations;
+
+  std::cout << name << ": dy/dx_1 = " << x[1].getGradient() << ", " << 1e3 * time << " ms per reverse sweep, "
+            << tape.getTapeValues().getUsedMemorySize() / 1024.0 / 1024.0 << " MB tape memory" << std::endl;
+
+  tape.reset();
+}
+
+int main(int nargs, char** args) {
+  int const n = 10000;
+  int const steps = 50;
+  int const evaluations = 20;
+
+  run<codi::RealReversePrimal>("InnerStatementEvaluator", n, steps, evaluations);
+  run<RealSwitch>("SwitchStatementEvaluator", n, steps, evaluations);
+
+  return 0;
+}
+//! [Example 39 - Switch statement evaluator]
@@ -0,0 +1,70 @@
+//! [Example 40 - Primal constant pool]
+#include <codi.hpp>
+#include <chrono>
+#include <iostream>
+#include <vector>
+
+//! [Stencil]
+// Fourth order smoothing stencil. Each statement has five constants, which are the same for all statements.
+template<typename Real>
+auto smooth(Real const& um2, Real const& um1, Real const& u, Real const& up1, Real const& up2) {
+  return -0.0625 * um2 + 0.25 * um1 + 0.625 * u + 0.25 * up1 - 0.0625 * up2;
+}
+//! [Stencil]
+
+int main(int nargs, char** args) {
+  using Real = codi::RealReversePrimal;
+  using Tape = typename Real::Tape;
+
+  int const n = 10000;
+  int const steps = 50;
+  int const evaluations = 20;
+
+  Tape& tape = Real::getTape();
+  tape.setActive();
+
+  std::vector<Real> x(n);
+  for (int i = 0; i < n; ++i) {
+    x[i] = 1.0 + 0.1 * sin(i);
+    tape.registerInput(x[i]);
+  }
+
+  std::vector<Real> u = x;
+  std::vector<Real> uNew = u;
+  for (int s = 0; s < steps; ++s) {
+    for (int i = 2; i < n - 2; ++i) {
+      uNew[i] = smooth(u[i - 2], u[i - 1], u[i], u[i + 1], u[i + 2]);
+    }
+    std::swap(u, uNew);
+  }
+
+  Real y = 0.0;
+  for (int i = 0; i < n; ++i) {
+    y += u[i] * u[i];
+  }
+  tape.registerOutput(y);
+  tape.setPassive();
+
+  // Warm-up evaluation.
+  y.setGradient(1.0);
+  tape.evaluate();
+
+  auto begin = std::chrono::steady_clock::now();
+  for (int e = 0; e < evaluations; ++e) {
+    tape.clearAdjoints();
+    y.setGradient(1.0);
+    tape.evaluate();
+  }
+  double time = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count() / evaluations;
+
+  std::cout << "Constant pool " << (codi::Config::PrimalConstantPool ? "enabled" : "disabled") << ": dy/dx_1 = "
+            << x[1].getGradient() << ", " << 1e3 * time << " ms per reverse sweep, "
+            << tape.getTapeValues().getUsedMemorySize() / 1024.0 / 1024.0 << " MB tape memory" << std::endl;
+
+  tape.printStatistics();
+
+  tape.reset();
+
+  return 0;
+}
+//! [Example 40 - Primal constant pool]
@@ -0,0 +1,77 @@
+//! [Example 41 - Parallel primal evaluation]
+#include <codi.hpp>
+#include <chrono>
+#include <iostream>
+#include <vector>
+
+//! [Time step]
+// Explicit time step of a nonlinear diffusion equation. All statements of a step are independent of each other.
+template<typename Real>
+void timeStep(std::vector<Real> const& u, std::vector<Real>& uNew) {
+  size_t n = u.size();
+  for (size_t i = 1; i < n - 1; ++i) {
+    uNew[i] = u[i] + 0.1 * (1.0 + u[i] * u[i]) * (u[i - 1] - 2.0 * u[i] + u[i + 1]);
+  }
+}
+//! [Time step]
+
+int main(int nargs, char** args) {
+  using Real = codi::RealReversePrimal;
+  using Tape = typename Real::Tape;
+
+  size_t const n = 100000;
+  int const steps = 20;
+  int const evaluations = 10;
+
+  Tape& tape = Real::getTape();
+  tape.setActive();
+
+  std::vector<Real> x(n);
+  for (size_t i = 0; i < n; ++i) {
+    x[i] = 1.0 + 0.1 * sin(i);
+    tape.registerInput(x[i]);
+  }
+
+  std::vector<Real> u = x;
+  std::vector<Real> uNew = u;
+  for (int s = 0; s < steps; ++s) {
+    timeStep(u, uNew);
+    std::swap(u, uNew);
+  }
+
+  Real y = 0.0;
+  for (size_t i = 0; i < n; ++i) {
+    y += u[i] * u[i];
+  }
+  tape.registerOutput(y);
+  tape.setPassive();
+
+  auto measure = [&](auto&& eval) {
+    auto begin = std::chrono::steady_clock::now();
+    for (int e = 0; e < evaluations; ++e) {
+      tape.primal(x[0].getIdentifier()) = 1.0 + 0.01 * e;
+      eval();
+    }
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count() / evaluations;
+  };
+
+  double timeSerial = measure([&]() { tape.evaluatePrimal(); });
+  double ySerial = tape.primal(y.getIdentifier());
+
+  auto begin = std::chrono::steady_clock::now();
+  tape.evaluatePrimalParallel();  // Builds the level schedule.
+  double timeSchedule = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+
+  double timeParallel = measure([&]() { tape.evaluatePrimalParallel(); });
+  double yParallel = tape.primal(y.getIdentifier());
+
+  std::cout << "OpenMP " << (codi::Config::EnableOpenMP ? "enabled" : "disabled") << std::endl;
+  std::cout << "Serial primal evaluation:   y = " << ySerial << ", " << 1e3 * timeSerial << " ms" << std::endl;
+  std::cout << "Parallel primal evaluation: y = " << yParallel << ", " << 1e3 * timeParallel << " ms" << std::endl;
+  std::cout << "First parallel evaluation with schedule construction: " << 1e3 * timeSchedule << " ms" << std::endl;
+
+  tape.reset();
+
+  return 0;
+}
+//! [Example 41 - Parallel primal evaluation]
@@ -0,0 +1,98 @@
+//! [Example 42 - Fused primal and reverse evaluation]
+#include <codi.hpp>
+#include <chrono>
+#include <iostream>
+#include <vector>
+
+using Real = codi::RealReversePrimalIndex;
+using Tape = typename Real::Tape;
+
+//! [Function]
+// Explicit time steps of a nonlinear diffusion equation. The intermediate values reuse identifiers.
+Real func(std::vector<Real> const& x, int steps) {
+  size_t n = x.size();
+  std::vector<Real> u = x;
+  std::vector<Real> uNew = u;
+  for (int s = 0; s < steps; ++s) {
+    for (size_t i = 1; i < n - 1; ++i) {
+      uNew[i] = u[i] + 0.1 * (1.0 + u[i] * u[i]) * (u[i - 1] - 2.0 * u[i] + u[i + 1]);
+    }
+    std::swap(u, uNew);
+  }
+
+  Real y = 0.0;
+  for (size_t i = 0; i < n; ++i) {
+    y += u[i] * u[i];
+  }
+  return y;
+}
+//! [Function]
+
+int main(int nargs, char** args) {
+  size_t const n = 100000;
+  int const steps = 20;
+  int const evaluations = 10;
+
+  Tape& tape = Real::getTape();
+  tape.setActive();
+
+  std::vector<Real> x(n);
+  for (size_t i = 0; i < n; ++i) {
+    x[i] = 1.0 + 0.1 * sin(i);
+    tape.registerInput(x[i]);
+  }
+  Real y = func(x, steps);
+  tape.registerOutput(y);
+  tape.setPassive();
+
+  auto setInputs = [&](int e) {
+    for (size_t i = 0; i < n; ++i) {
+      tape.primal(x[i].getIdentifier()) = 1.0 + 0.1 * sin(i) + 0.01 * e;
+    }
+  };
+
+  double yValue = 0.0;
+  auto measure = [&](char const* name, auto&& eval) {
+    auto begin = std::chrono::steady_clock::now();
+    for (int e = 0; e < evaluations; ++e) {
+      tape.clearAdjoints();
+      eval(e);
+    }
+    double time = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count() / evaluations;
+    std::cout << name << ": y = " << yValue << ", dy/dx_1 = " << x[1].getGradient() << ", " << 1e3 * time << " ms"
+              << std::endl;
+  };
+
+  // Separate evaluations. revertPrimals is required if the identifiers of the inputs could be reused on the tape.
+  measure("revertPrimals, evaluatePrimal, evaluate", [&](int e) {
+    tape.revertPrimals(tape.getZeroPosition());
+    setInputs(e);
+    tape.evaluatePrimal();
+    yValue = tape.primal(y.getIdentifier());
+    y.gradient() = 1.0;
+    tape.evaluate();
+  });
+
+  measure("evaluatePrimal, evaluate", [&](int e) {
+    setInputs(e);
+    tape.evaluatePrimal();
+    yValue = tape.primal(y.getIdentifier());
+    y.gradient() = 1.0;
+    tape.evaluate();
+  });
+
+  //! [Fused evaluation]
+  measure("evaluatePrimalThenReverse", [&](int e) {
+    setInputs(e);
+    tape.evaluatePrimalThenReverse([&]() {
+      yValue = tape.primal(y.getIdentifier());  // Output values are only available between the sweeps.
+      y.gradient() = 1.0;
+    });
+  });
+  //! [Fused evaluation]
+
+  tape.reset();
+
+  return 0;
+}
+//! [Example 42 - Fused primal and reverse evaluation]
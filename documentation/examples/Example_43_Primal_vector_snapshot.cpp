@@ -0,0 +1,84 @@
+//! [Example 43 - Primal vector snapshot]
+#include <codi.hpp>
+#include <chrono>
+#include <iostream>
+#include <vector>
+
+using Real = codi::RealReversePrimalIndex;
+using Tape = typename Real::Tape;
+
+// Explicit time steps of a nonlinear diffusion equation. The intermediate values reuse identifiers.
+void func(std::vector<Real> const& x, std::vector<Real>& y, int steps) {
+  size_t n = x.size();
+  std::vector<Real> u = x;
+  std::vector<Real> uNew = u;
+  for (int s = 0; s < steps; ++s) {
+    for (size_t i = 1; i < n - 1; ++i) {
+      uNew[i] = u[i] + 0.1 * (1.0 + u[i] * u[i]) * (u[i - 1] - 2.0 * u[i] + u[i + 1]);
+    }
+    std::swap(u, uNew);
+  }
+
+  for (size_t i = 0; i < n; ++i) {
+    y[i % y.size()] += u[i] * u[i];
+  }
+}
+
+int main(int nargs, char** args) {
+  size_t const n = 10000;
+  int const steps = 20;
+  size_t const m = 8;
+
+  Tape& tape = Real::getTape();
+  tape.setActive();
+
+  std::vector<Real> x(n);
+  std::vector<Real> y(m);
+  for (size_t i = 0; i < n; ++i) {
+    x[i] = 1.0 + 0.1 * sin(i);
+    tape.registerInput(x[i]);
+  }
+  func(x, y, steps);
+  for (size_t j = 0; j < m; ++j) {
+    tape.registerOutput(y[j]);
+  }
+  tape.setPassive();
+
+  std::vector<double> adjoints(tape.getParameter(codi::TapeParameters::LargestIdentifier) + 1);
+
+  auto measure = [&](char const* name, auto&& eval) {
+    double gradientSum = 0.0;
+    auto begin = std::chrono::steady_clock::now();
+    for (size_t j = 0; j < m; ++j) {
+      std::fill(adjoints.begin(), adjoints.end(), 0.0);
+      adjoints[y[j].getIdentifier()] = 1.0;
+      eval();
+      gradientSum += adjoints[x[1].getIdentifier()];
+    }
+    double time = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count() / m;
+    std::cout << name << ": sum of dy_j/dx_1 = " << gradientSum << ", " << 1e3 * time << " ms per sweep" << std::endl;
+  };
+
+  // evaluate copies the whole primal vector for each sweep.
+  measure("evaluate", [&]() {
+    tape.evaluate(tape.getPosition(), tape.getZeroPosition(), adjoints.data());
+  });
+
+  //! [Snapshot]
+  codi::PrimalVectorSnapshot<Tape> snapshot;
+  snapshot.capture(tape);  // Copies the primal vector once and marks the blocks that a reverse sweep reverts.
+  std::cout << "Restored blocks: " << snapshot.getDirtyBlockCount() << " of " << snapshot.getBlockCount() << std::endl;
+
+  std::vector<double> primals;
+  snapshot.initialize(primals);
+  measure("evaluateWithPrimals and restore", [&]() {
+    tape.evaluateWithPrimals(tape.getPosition(), tape.getZeroPosition(), primals.data(), adjoints.data());
+    snapshot.restore(primals.data());  // Copies only the marked blocks.
+  });
+  //! [Snapshot]
+
+  tape.reset();
+
+  return 0;
+}
+//! [Example 43 - Primal vector snapshot]
@@ -0,0 +1,92 @@
+#ifdef _OPENMP
+//! [Example 44 - Concurrent reverse evaluation]
+#include <omp.h>
+
+#include <codi.hpp>
+#include <chrono>
+#include <iostream>
+#include <vector>
+
+using Real = codi::RealReverse;
+using Tape = typename Real::Tape;
+
+// Explicit time steps of a nonlinear diffusion equation.
+void func(std::vector<Real> const& x, std::vector<Real>& y, int steps) {
+  size_t n = x.size();
+  std::vector<Real> u = x;
+  std::vector<Real> uNew = u;
+  for (int s = 0; s < steps; ++s) {
+    for (size_t i = 1; i < n - 1; ++i) {
+      uNew[i] = u[i] + 0.1 * (1.0 + u[i] * u[i]) * (u[i - 1] - 2.0 * u[i] + u[i + 1]);
+    }
+    std::swap(u, uNew);
+  }
+
+  for (size_t i = 0; i < n; ++i) {
+    y[i % y.size()] += u[i] * u[i];
+  }
+}
+
+int main(int nargs, char** args) {
+  size_t const n = 10000;
+  int const steps = 20;
+  int const m = 32;
+
+  Tape& tape = Real::getTape();
+  tape.setActive();
+
+  std::vector<Real> x(n);
+  std::vector<Real> y(m);
+  for (size_t i = 0; i < n; ++i) {
+    x[i] = 1.0 + 0.1 * sin(i);
+    tape.registerInput(x[i]);
+  }
+  func(x, y, steps);
+  for (int j = 0; j < m; ++j) {
+    tape.registerOutput(y[j]);
+  }
+  tape.setPassive();
+
+  size_t adjointSize = tape.getParameter(codi::TapeParameters::LargestIdentifier) + 1;
+  std::vector<double> gradients(m);
+
+  for (int threads = 1; threads <= omp_get_max_threads(); threads *= 2) {
+    auto begin = std::chrono::steady_clock::now();
+
+    //! [Concurrent evaluation]
+#pragma omp parallel num_threads(threads)
+    {
+      std::vector<double> adjoints(adjointSize);  // One adjoint vector per thread.
+
+#pragma omp for schedule(dynamic)
+      for (int j = 0; j < m; ++j) {
+        std::fill(adjoints.begin(), adjoints.end(), 0.0);
+        adjoints[y[j].getIdentifier()] = 1.0;
+        tape.evaluateConcurrent(tape.getPosition(), tape.getZeroPosition(), adjoints.data());
+        gradients[j] = adjoints[x[1].getIdentifier()];
+      }
+    }
+    //! [Concurrent evaluation]
+
+    double time = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+    double gradientSum = 0.0;
+    for (int j = 0; j < m; ++j) {
+      gradientSum += gradients[j];
+    }
+    std::cout << threads << " threads: sum of dy_j/dx_1 = " << gradientSum << ", " << 1e3 * time << " ms for " << m
+              << " sweeps" << std::endl;
+  }
+
+  tape.reset();
+
+  return 0;
+}
+//! [Example 44 - Concurrent reverse evaluation]
+#else
+#include <iostream>
+
+int main(int nargs, char** args) {
+  std::cout << "Please compile with OpenMP support." << std::endl;
+  return 0;
+}
+#endif
@@ -11,4 +11,11 @@ std::vector<typename Tape::EvalHandle> primal_reuse_textCreateEvalHandles(){
   evalHandles[1] = Tape::StatementEvaluator::template createHandle<Impl, Impl, codi::AssignStatement<codi::ActiveType<codi::PrimalValueReuseTape<codi::PrimalValueTapeTypes<double, double, codi::MultiUseIndexManager<int>, codi::InnerStatementEvaluator, codi::DefaultChunkedData> > >, codi::ActiveType<codi::PrimalValueReuseTape<codi::PrimalValueTapeTypes<double, double, codi::MultiUseIndexManager<int>, codi::InnerStatementEvaluator, codi::DefaultChunkedData> > > >>();
 
   return evalHandles;
-}
\ No newline at end of file
+}
+
+template <typename Impl>
+struct primal_reuse_textStatementRegistry {
+  using Statements = std::tuple<
+    codi::AssignStatement<codi::ActiveType<Impl >, codi::ComputeExpression<double, codi::OperationMultiply, codi::ComputeExpression<double, codi::OperationMultiply, codi::ActiveType<Impl >, codi::ActiveType<Impl > >, codi::ActiveType<Impl > > >,
+    codi::AssignStatement<codi::ActiveType<Impl >, codi::ActiveType<Impl > >>;
+};
@@ -50,6 +50,7 @@
 #include "codi/tapes/forwardEvaluation.hpp"
 #include "codi/tapes/indices/debugMultiUseIndexManager.hpp"
 #include "codi/tapes/indices/linearIndexManager.hpp"
+#include "codi/tapes/indices/localityReuseIndexManager.hpp"
 #include "codi/tapes/indices/multiUseIndexManager.hpp"
 #include "codi/tapes/jacobianLinearTape.hpp"
 #include "codi/tapes/jacobianReuseTape.hpp"
@@ -58,24 +59,41 @@
 #include "codi/tapes/statementEvaluators/directStatementEvaluator.hpp"
 #include "codi/tapes/statementEvaluators/innerStatementEvaluator.hpp"
 #include "codi/tapes/statementEvaluators/reverseStatementEvaluator.hpp"
+#include "codi/tapes/statementEvaluators/switchStatementEvaluator.hpp"
 #include "codi/tapes/tagging/tagTapeForward.hpp"
 #include "codi/tapes/tagging/tagTapeReverse.hpp"
 #include "codi/tools/data/aggregatedTypeVectorAccessWrapper.hpp"
 #include "codi/tools/data/direction.hpp"
 #include "codi/tools/data/externalFunctionUserData.hpp"
+#include "codi/tools/data/identifierMap.hpp"
 #include "codi/tools/data/jacobian.hpp"
+#include "codi/tools/data/primalVectorSnapshot.hpp"
+#include "codi/tools/data/runtimeDirection.hpp"
 #include "codi/tools/derivativeAccess.hpp"
+#include "codi/tools/helpers/asyncReverseHelper.hpp"
 #include "codi/tools/helpers/customAdjointVectorHelper.hpp"
 #include "codi/tools/helpers/externalFunctionHelper.hpp"
 // #include "codi/tools/helpers/evaluationHelper.hpp" // Included at the end of this file.
 #include "codi/tapes/io/readerWriterHelpers.hpp"
 #include "codi/tools/helpers/linearSystem/linearSystemHandler.hpp"
+#include "codi/tools/helpers/preaccumulationBatchHelper.hpp"
 #include "codi/tools/helpers/preaccumulationHelper.hpp"
+#include "codi/tools/helpers/preaccumulationHelperPool.hpp"
 #include "codi/tools/helpers/statementPushHelper.hpp"
 #include "codi/tools/helpers/tapeHelper.hpp"
 #include "codi/tools/identifierCacheOptimizer.hpp"
 #include "codi/tools/io/writeConnectivityData.hpp"
+#include "codi/tools/lowlevelFunctions/elementwise/elementwiseBinaryMap.hpp"
+#include "codi/tools/lowlevelFunctions/elementwise/elementwiseUnaryMap.hpp"
+#include "codi/tools/lowlevelFunctions/linearAlgebra/matrixTransposeVectorMultiplication.hpp"
+#include "codi/tools/lowlevelFunctions/linearAlgebra/matrixVectorMultiplication.hpp"
+#include "codi/tools/lowlevelFunctions/linearAlgebra/vectorAxpy.hpp"
+#include "codi/tools/lowlevelFunctions/linearAlgebra/vectorDotProduct.hpp"
+#include "codi/tools/lowlevelFunctions/linearAlgebra/vectorNorm2.hpp"
+#include "codi/tools/lowlevelFunctions/linearAlgebra/vectorScale.hpp"
+#include "codi/tools/lowlevelFunctions/linearAlgebra/vectorSum.hpp"
 #include "codi/tools/lowlevelFunctions/lowLevelFunctionCreationUtilities.hpp"
+#include "codi/tools/preaccumulationRegionOptimizer.hpp"
 #include "codi/traits/computationTraits.hpp"
 #include "codi/traits/numericLimits.hpp"
 #include "codi/traits/tapeTraits.hpp"
@@ -131,6 +149,17 @@ namespace codi {
   template<size_t dim>
   using RealReverseVec = RealReverseGen<double, Direction<double, dim>>;
 
+  /// General mixed-precision reverse AD type. See \ref sec_reverseAD for a reverse mode AD explanation or
+  /// \ref ActiveTypeList for a list of all types.
+  ///
+  /// Jacobian taping approach with linear index handling. The recorded Jacobians are stored as JacobianReal.
+  template<typename Real, typename JacobianReal, typename Gradient = Real, typename Index = int>
+  using RealReverseMixedGen = ActiveType<JacobianLinearTape<JacobianTapeTypes<
+      Real, Gradient, LinearIndexManager<Index>, DefaultChunkedData, LocalAdjoints, JacobianReal>>>;
+
+  /// \copydoc codi::RealReverseMixedGen
+  using RealReverseMixed = RealReverseMixedGen<double, float>;
+
   /// General unchecked reverse AD type. See \ref sec_reverseAD for a reverse mode AD explanation or \ref ActiveTypeList
   /// for a list of all types.
   ///
@@ -159,6 +188,18 @@ namespace codi {
   template<size_t dim>
   using RealReverseIndexVec = RealReverseIndexGen<double, Direction<double, dim>>;
 
+  /// General mixed-precision reverse AD type. See \ref sec_reverseAD for a reverse mode AD explanation or
+  /// \ref ActiveTypeList for a list of all types.
+  ///
+  /// Jacobian taping approach with reuse index handling. The recorded Jacobians are stored as JacobianReal.
+  template<typename Real, typename JacobianReal, typename Gradient = Real,
+           typename IndexManager = MultiUseIndexManager<int>>
+  using RealReverseIndexMixedGen = ActiveType<JacobianReuseTape<
+      JacobianTapeTypes<Real, Gradient, IndexManager, DefaultChunkedData, LocalAdjoints, JacobianReal>>>;
+
+  /// \copydoc codi::RealReverseIndexMixedGen
+  using RealReverseIndexMixed = RealReverseIndexMixedGen<double, float>;
+
   /// General unchecked reverse AD type. See \ref sec_reverseAD for a reverse mode AD explanation or \ref ActiveTypeList
   /// for a list of all types.
   ///
@@ -125,6 +125,31 @@ namespace codi {
     /// Statement tag for low level functions.
     size_t constexpr StatementLowLevelFunctionTag = 254;
 
+#ifndef CODI_WideStatements
+  /// See codi::Config::WideStatements.
+  #define CODI_WideStatements false
+#endif
+    /// Enables statements with more than MaxArgumentSize arguments in Jacobian tapes. Such statements are tagged with
+    /// StatementWideTag and the number of arguments is stored in the Jacobian data.
+    bool constexpr WideStatements = CODI_WideStatements;
+#undef CODI_WideStatements
+
+    /// Statement tag for wide statements, see WideStatements.
+    size_t constexpr StatementWideTag = 253;
+
+    /// Minimum number of arguments of a wide statement. Smaller statements can not be distinguished from the tags in
+    /// the tape readers and writers.
+    size_t constexpr MinWideArgumentSize = StatementInputTag + 1;
+
+#ifndef CODI_MaxWideArgumentSize
+  /// See codi::Config::MaxWideArgumentSize.
+  #define CODI_MaxWideArgumentSize 65536
+#endif
+    /// Maximum number of arguments in a wide statement. The Jacobian data chunks are at least this large if
+    /// WideStatements is enabled.
+    size_t constexpr MaxWideArgumentSize = CODI_MaxWideArgumentSize;
+#undef CODI_MaxWideArgumentSize
+
 #ifndef CODI_SmallChunkSize
   /// See codi::Config::SmallChunkSize.
   #define CODI_SmallChunkSize 32768
@@ -298,6 +323,23 @@ namespace codi {
     bool constexpr ReversalZeroesAdjoints = CODI_ReversalZeroesAdjoints;
 #undef CODI_ReversalZeroesAdjoints
 
+#ifndef CODI_ReverseStatementRuns
+  /// See codi::Config::ReverseStatementRuns.
+  #define CODI_ReverseStatementRuns true
+#endif
+    /// Primal value tapes evaluate consecutive statements with the same handle with one call in the reverse sweep.
+    bool constexpr ReverseStatementRuns = CODI_ReverseStatementRuns;
+#undef CODI_ReverseStatementRuns
+
+#ifndef CODI_PrimalConstantPool
+  /// See codi::Config::PrimalConstantPool.
+  #define CODI_PrimalConstantPool false
+#endif
+    /// Primal value tapes store equal tuples of statement constants only once and reference them from the statement
+    /// data. See codi::ConstantValuePool.
+    bool constexpr PrimalConstantPool = CODI_PrimalConstantPool;
+#undef CODI_PrimalConstantPool
+
     /// @}
     /*******************************************************************************/
     /// @name Event system
@@ -218,7 +218,7 @@ namespace codi {
       template<typename TypedCallback, typename... Args>
       static CODI_INLINE void internalNotifyListeners(bool const enabled, Event event, Args&&... args) {
         if (enabled) {
-          for (auto const& listener : getListeners()[event]) {
+          for (auto const& listener : getListeners().at(event)) {  // No insertion, safe for concurrent calls.
             ((TypedCallback)listener.second.first)(std::forward<Args>(args)..., listener.second.second);
           }
         }
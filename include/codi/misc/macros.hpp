@@ -185,4 +185,12 @@ namespace codi {
         FUNC<TT...>(std::forward<Args>(args)...); \
       }                                           \
   }
+
+#if CODI_EnableOpenMP
+  /// OpenMP pragma in code that also works without OpenMP. Empty if codi::Config::EnableOpenMP is false.
+  #define CODI_OMP_OPTIONAL(...) _Pragma(#__VA_ARGS__)
+#else
+  /// OpenMP pragma in code that also works without OpenMP. Empty if codi::Config::EnableOpenMP is false.
+  #define CODI_OMP_OPTIONAL(...) /* empty */
+#endif
 }
@@ -35,6 +35,8 @@
 
 #pragma once
 
+#include <cstddef>
+
 /** \copydoc codi::Namespace */
 namespace codi {
 
@@ -50,4 +52,25 @@ namespace codi {
     IntegralType chunkCount = (targetSize + chunkSize - 1) / chunkSize;
     return chunkCount * chunkSize;
   }
+
+  /**
+   * @brief Number of bits required to represent the given value, i.e., the position of the highest set bit plus one.
+   *
+   * Returns zero for a zero value.
+   *
+   * @param value  An unsigned value.
+   * @return Number of bits required to represent value.
+   */
+  inline size_t getBitWidth(size_t value) {
+#if defined(__GNUC__) || defined(__clang__)
+    return 0 == value ? 0 : sizeof(unsigned long long) * 8 - (size_t)__builtin_clzll((unsigned long long)value);
+#else
+    size_t width = 0;
+    while (0 != value) {
+      width += 1;
+      value >>= 1;
+    }
+    return width;
+#endif
+  }
 }
@@ -167,11 +167,11 @@ namespace codi {
       /// Lookup table for low level function.
       static std::vector<LowLevelFunctionEntry<Impl, Real, Identifier>>* lowLevelFunctionLookup;
 
-    private:
-
       /// External function token is always added first.
       static Config::LowLevelFunctionToken constexpr EXTERNAL_FUNCTION_TOKEN = 0;
 
+    private:
+
       CODI_INLINE Impl const& cast() const {
         return static_cast<Impl const&>(*this);
       }
@@ -198,6 +198,34 @@ namespace codi {
 
     protected:
 
+      /// Number of concurrent evaluations that are active on the calling thread.
+      static CODI_INLINE int& concurrentEvaluationDepth() {
+        static thread_local int depth = 0;
+        return depth;
+      }
+
+      /// Temporary memory of the calling thread, used instead of the tape memory in concurrent evaluations.
+      static CODI_INLINE TemporaryMemory& threadTemporaryMemory() {
+        static thread_local TemporaryMemory memory;
+        return memory;
+      }
+
+      /// While an object of this type exists, getTemporaryMemory() returns the temporary memory of the calling
+      /// thread.
+      struct ConcurrentEvaluationScope {
+        public:
+
+          /// Constructor.
+          ConcurrentEvaluationScope() {
+            concurrentEvaluationDepth() += 1;
+          }
+
+          /// Destructor.
+          ~ConcurrentEvaluationScope() {
+            concurrentEvaluationDepth() -= 1;
+          }
+      };
+
       /// Initialize all manual push data, including the counter. Check that a previous manual store is completed.
       CODI_INLINE void initializeManualPushData(Real const& lhsValue, Identifier const& lhsIndex, size_t size) {
         codiAssert(this->manualPushGoal == this->manualPushCounter);
@@ -611,7 +639,12 @@ namespace codi {
     public:
 
       /// @copydoc LowLevelFunctionTapeInterface::getTemporaryMemory()
+      /// <br> Implementation: Returns the temporary memory of the calling thread during concurrent evaluations.
       CODI_INLINE TemporaryMemory& getTemporaryMemory() {
+        if (0 != concurrentEvaluationDepth()) CODI_Unlikely {
+          return threadTemporaryMemory();
+        }
+
         return allocator;
       }
 
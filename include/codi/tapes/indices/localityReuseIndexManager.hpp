@@ -0,0 +1,434 @@
+/*
+ * CoDiPack, a Code Differentiation Package
+ *
+ * Copyright (C) 2015-2026 Chair for Scientific Computing (SciComp), RPTU University Kaiserslautern-Landau
+ * Homepage: http://scicomp.rptu.de
+ * Contact:  Prof. Nicolas R. Gauger (codi@scicomp.uni-kl.de)
+ *
+ * Lead developers: Max Sagebaum, Johannes Blühdorn (SciComp, RPTU University Kaiserslautern-Landau)
+ *
+ * This file is part of CoDiPack (http://scicomp.rptu.de/software/codi).
+ *
+ * CoDiPack is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * CoDiPack is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * See the GNU General Public License for more details.
+ * You should have received a copy of the GNU
+ * General Public License along with CoDiPack.
+ * If not, see <http://www.gnu.org/licenses/>.
+ *
+ * For other licensing options please contact us.
+ *
+ * Authors:
+ *  - SciComp, RPTU University Kaiserslautern-Landau:
+ *    - Max Sagebaum
+ *    - Johannes Blühdorn
+ *    - Former members:
+ *      - Tim Albring
+ */
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+#include "../../config.h"
+#include "../../misc/eventSystem.hpp"
+#include "../../misc/macros.hpp"
+#include "../../misc/mathUtility.hpp"
+#include "../data/emptyData.hpp"
+#include "indexManagerInterface.hpp"
+
+/** \copydoc codi::Namespace */
+namespace codi {
+
+  /**
+   * @brief Reuse index manager that hands out freed identifiers with respect to their location in the adjoint vector.
+   *
+   * Same management strategy as ReuseIndexManager: Variables keep their identifiers as long as they are active, freed
+   * identifiers are assigned to new variables and identifiers that have already been used in the current recording are
+   * preferred over unused ones.
+   *
+   * ReuseIndexManager hands out freed identifiers in LIFO order, so that consecutive statements may access adjoint
+   * variables that are far apart. This index manager divides the identifiers into regions of 2^RegionSizeLog2
+   * consecutive identifiers, e.g., a memory page of the adjoint vector. Each region has its own free lists. A new
+   * identifier is taken from the region of the most recently assigned identifier. Only if this region is exhausted,
+   * the next region with free identifiers is selected. New identifiers are created region by region.
+   *
+   * On reset, the free identifiers of each region are sorted by a radix sort: The region is the leading digit, the
+   * position inside the region is sorted with a bitset. A new recording then assigns the identifiers in increasing
+   * order, starting at the first region, which resembles the access pattern of linear index management.
+   *
+   * The free lists are stored intrusively, one successor identifier per created identifier, and the regions with free
+   * identifiers are tracked in bitsets. All operations besides the region search are constant in time.
+   *
+   * This index manager is not thread-safe. It can be used as the base of MultiUseIndexManager, e.g.,
+   * RealReverseIndexGen<double, double, MultiUseIndexManager<int, LocalityReuseIndexManager<int>>>.
+   *
+   * @tparam T_Index           Type for the identifier, usually an integer type.
+   * @tparam T_regionSizeLog2  Number of identifiers per region as power of two. The default of 2^9 identifiers covers
+   *                           a 4 KiB page of double adjoints.
+   */
+  template<typename T_Index, size_t T_regionSizeLog2 = 9>
+  struct LocalityReuseIndexManager : public IndexManagerInterface<T_Index>, public EmptyData {
+    public:
+
+      using Index = CODI_DD(T_Index, int);        ///< See LocalityReuseIndexManager.
+      using ActiveTypeIndexData = Index;          ///< Same as the index.
+      using Base = IndexManagerInterface<Index>;  ///< Base class abbreviation.
+
+      using Position = EmptyData::Position;  ///< See EmptyData.
+
+      static size_t constexpr RegionSizeLog2 = T_regionSizeLog2;       ///< See LocalityReuseIndexManager.
+      static size_t constexpr RegionSize = size_t(1) << RegionSizeLog2;  ///< Number of identifiers per region.
+
+      static_assert(RegionSizeLog2 >= 6, "Regions need to have at least 64 identifiers.");
+
+      /*******************************************************************************/
+      /// @name IndexManagerInterface: Constants
+      /// @{
+
+      static bool constexpr CopyNeedsStatement = true;  ///< No copy optimization is implemented.
+      static bool constexpr IsLinear = false;           ///< Identifiers are not coupled to statements.
+      static bool constexpr NeedsStaticStorage = true;  ///< Identifiers are managed globally.
+
+      /// @}
+
+    private:
+
+      static size_t constexpr BitsPerWord = 64;
+      static size_t constexpr NoRegion = size_t(-1);
+
+      /// Free lists of all regions. The list entries are linked via nextFree.
+      struct RegionLists {
+        public:
+          std::vector<Index> heads;         ///< First free identifier of each region, InactiveIndex if empty.
+          std::vector<uint64_t> nonEmpty;  ///< Bitset of the regions with free identifiers.
+          size_t count;                     ///< Number of identifiers in all lists.
+
+          /// Constructor
+          RegionLists() : heads(), nonEmpty(), count(0) {}
+
+          /// Enlarge to the given number of regions.
+          void resize(size_t regions) {
+            heads.resize(regions, Base::InactiveIndex);
+            nonEmpty.resize((regions + BitsPerWord - 1) / BitsPerWord, 0);
+          }
+
+          /// Prepend the identifier to the list of its region.
+          CODI_INLINE void push(Index const& index, std::vector<Index>& nextFree) {
+            size_t region = getRegion(index);
+
+            if (Base::InactiveIndex == heads[region]) {
+              nonEmpty[region / BitsPerWord] |= uint64_t(1) << (region % BitsPerWord);
+            }
+            nextFree[index] = heads[region];
+            heads[region] = index;
+            count += 1;
+          }
+
+          /// Remove the first identifier from the list of the region. The list must not be empty.
+          CODI_INLINE Index pop(size_t region, std::vector<Index> const& nextFree) {
+            Index index = heads[region];
+
+            heads[region] = nextFree[index];
+            if (Base::InactiveIndex == heads[region]) {
+              nonEmpty[region / BitsPerWord] &= ~(uint64_t(1) << (region % BitsPerWord));
+            }
+            count -= 1;
+
+            return index;
+          }
+
+          /// First region with free identifiers, searching upwards from start and then from the beginning. Returns
+          /// NoRegion if all lists are empty.
+          size_t findRegion(size_t start) const {
+            size_t const words = nonEmpty.size();
+            size_t word = start / BitsPerWord;
+
+            if (word < words) {
+              uint64_t bits = nonEmpty[word] & (~uint64_t(0) << (start % BitsPerWord));
+              for (size_t i = 0; i <= words; i += 1) {
+                if (0 != bits) {
+                  return word * BitsPerWord + getBitWidth(bits & (~bits + 1)) - 1;  // Lowest set bit.
+                }
+
+                word = (word + 1) % words;
+                bits = nonEmpty[word];
+              }
+            }
+
+            return NoRegion;
+          }
+
+          /// Remove all entries of the region.
+          CODI_INLINE void clear(size_t region, size_t removed) {
+            heads[region] = Base::InactiveIndex;
+            nonEmpty[region / BitsPerWord] &= ~(uint64_t(1) << (region % BitsPerWord));
+            count -= removed;
+          }
+      };
+
+      std::vector<Index> nextFree;  ///< Successor of each identifier in its free list.
+
+      RegionLists usedLists;    ///< Identifiers that have already been used in this recording.
+      RegionLists unusedLists;  ///< Identifiers that have not been used in this recording yet.
+
+      size_t currentRegion;  ///< Region of the most recently assigned identifier.
+
+      Index globalMaximumIndex;  ///< The largest created index.
+
+    protected:
+
+      bool valid;  ///< Prevent index free after destruction.
+
+    public:
+
+      /// Constructor
+      LocalityReuseIndexManager(Index const& reservedIndices)
+          : nextFree(),
+            usedLists(),
+            unusedLists(),
+            currentRegion(0),
+            globalMaximumIndex(reservedIndices),
+            valid(true) {
+        generateNewIndices();
+      }
+
+      /// Destructor
+      ~LocalityReuseIndexManager() {
+        valid = false;
+      }
+
+      /*******************************************************************************/
+      /// @name IndexManagerInterface: Methods
+      /// @{
+
+      /// \copydoc codi::IndexManagerInterface::assignIndex
+      template<typename Tape>
+      CODI_INLINE bool assignIndex(Index& index) {
+        bool generatedNewIndex = false;
+
+        if (Base::InactiveIndex == index) {
+          if (Base::InactiveIndex != usedLists.heads[currentRegion]) {
+            index = usedLists.pop(currentRegion, nextFree);
+          } else if (Base::InactiveIndex != unusedLists.heads[currentRegion]) {
+            index = unusedLists.pop(currentRegion, nextFree);
+          } else {
+            generatedNewIndex = assignFromOtherRegion(index, false);
+          }
+        }
+
+        EventSystem<Tape>::notifyIndexAssignListeners(index);
+
+        return generatedNewIndex;
+      }
+
+      /// \copydoc codi::IndexManagerInterface::assignUnusedIndex
+      template<typename Tape>
+      CODI_INLINE bool assignUnusedIndex(Index& index) {
+        freeIndex<Tape>(index);  // Zero check is performed inside.
+
+        bool generatedNewIndex = false;
+        if (Base::InactiveIndex != unusedLists.heads[currentRegion]) {
+          index = unusedLists.pop(currentRegion, nextFree);
+        } else {
+          generatedNewIndex = assignFromOtherRegion(index, true);
+        }
+
+        EventSystem<Tape>::notifyIndexAssignListeners(index);
+
+        return generatedNewIndex;
+      }
+
+      /// \copydoc codi::IndexManagerInterface::copyIndex
+      template<typename Tape>
+      CODI_INLINE void copyIndex(Index& lhs, Index const& rhs) {
+        if (Base::InactiveIndex == rhs) {
+          freeIndex<Tape>(lhs);
+        } else {
+          assignIndex<Tape>(lhs);
+        }
+      }
+
+      /// \copydoc codi::IndexManagerInterface::freeIndex
+      template<typename Tape>
+      CODI_INLINE void freeIndex(Index& index) {
+        if (valid && Base::InactiveIndex != index) {  // Do not free the zero index.
+          codiAssert(index <= getLargestCreatedIndex());
+
+          EventSystem<Tape>::notifyIndexFreeListeners(index);
+
+          usedLists.push(index, nextFree);
+
+          index = Base::InactiveIndex;
+        }
+      }
+
+      /// \copydoc IndexManagerInterface::initIndex
+      CODI_INLINE void initIndex(Index& index) {
+        index = Index();
+      }
+
+      /// \copydoc codi::IndexManagerInterface::updateLargestCreatedIndex
+      CODI_NO_INLINE void updateLargestCreatedIndex(Index const& index) {
+        while (index > globalMaximumIndex) {
+          generateNewIndices();
+        }
+      }
+
+      /// \copydoc codi::IndexManagerInterface::reset
+      /// <br><br> Implementation: All free identifiers become unused and are sorted per region.
+      CODI_NO_INLINE void reset() {
+        std::array<uint64_t, RegionSize / BitsPerWord> present = {};
+
+        for (size_t region = 0; region < unusedLists.heads.size(); region += 1) {
+          if (Base::InactiveIndex == usedLists.heads[region] && Base::InactiveIndex == unusedLists.heads[region]) {
+            continue;
+          }
+
+          Index const regionStart = Index(region << RegionSizeLog2);
+          size_t entries = 0;
+
+          // Digit 1: Collect the identifiers of the region.
+          for (RegionLists* lists : {&usedLists, &unusedLists}) {
+            size_t removed = 0;
+            for (Index index = lists->heads[region]; Base::InactiveIndex != index; index = nextFree[index]) {
+              size_t offset = index - regionStart;
+              present[offset / BitsPerWord] |= uint64_t(1) << (offset % BitsPerWord);
+              removed += 1;
+            }
+            lists->clear(region, removed);
+            entries += removed;
+          }
+
+          // Digit 2: Rebuild the list in increasing order from the bitset.
+          for (size_t word = present.size(); word > 0; word -= 1) {
+            uint64_t bits = present[word - 1];
+            while (0 != bits) {
+              size_t bit = getBitWidth(bits) - 1;  // Highest set bit.
+              bits &= ~(uint64_t(1) << bit);
+
+              unusedLists.push(regionStart + Index((word - 1) * BitsPerWord + bit), nextFree);
+            }
+            present[word - 1] = 0;
+          }
+
+          codiAssert(entries > 0);
+          CODI_UNUSED(entries);
+        }
+
+        currentRegion = 0;
+      }
+
+      /// \copydoc codi::IndexManagerInterface::addToTapeValues <br><br>
+      /// Implementation: Adds max live indices, cur live indices, indices stored, memory used, memory allocated.
+      void addToTapeValues(TapeValues& values) const {
+        unsigned long maximumGlobalIndex = globalMaximumIndex;
+        unsigned long storedIndices = usedLists.count + unusedLists.count;
+        long currentLiveIndices = maximumGlobalIndex - storedIndices;
+
+        double memoryStoredIndices = (double)nextFree.size() * (double)(sizeof(Index)) +
+                                     2.0 * (double)unusedLists.heads.size() * (double)(sizeof(Index));
+        double memoryAllocatedIndices = (double)nextFree.capacity() * (double)(sizeof(Index)) +
+                                        (double)usedLists.heads.capacity() * (double)(sizeof(Index)) +
+                                        (double)unusedLists.heads.capacity() * (double)(sizeof(Index));
+
+        TapeValues::LocalReductionOperation constexpr operation =
+            NeedsStaticStorage ? TapeValues::LocalReductionOperation::Max : TapeValues::LocalReductionOperation::Sum;
+
+        values.addUnsignedLongEntry("Max. live indices", maximumGlobalIndex, operation);
+        values.addLongEntry("Cur. live indices", currentLiveIndices, operation);
+        values.addUnsignedLongEntry("Indices stored", storedIndices, operation);
+        values.addDoubleEntry("Memory used", memoryStoredIndices, operation, true, false);
+        values.addDoubleEntry("Memory allocated", memoryAllocatedIndices, operation, false, true);
+      }
+
+      /// \copydoc IndexManagerInterface::validateRhsIndex
+      void validateRhsIndex(ActiveTypeIndexData const& data) const {
+        CODI_UNUSED(data);
+
+        codiAssert(data <= getLargestCreatedIndex());
+      }
+
+      /// \copydoc IndexManagerInterface::getIndex
+      CODI_INLINE Index const& getIndex(Index const& data) {
+        return data;
+      }
+
+      /// \copydoc IndexManagerInterface::getIndex
+      CODI_INLINE Index& getIndex(Index& data) {
+        return data;
+      }
+
+      /// \copydoc IndexManagerInterface::getLargestCreatedIndex
+      /// Tape resets do not change the largest created index. It is not guaranteed that the largest created index
+      /// has been assigned to a variable already.
+      CODI_INLINE Index getLargestCreatedIndex() const {
+        return globalMaximumIndex;
+      }
+
+      /// @}
+
+    private:
+
+      /// Region of an identifier.
+      CODI_INLINE static size_t getRegion(Index const& index) {
+        return (size_t)index >> RegionSizeLog2;
+      }
+
+      /// Switch to the next region with free identifiers. Used identifiers are preferred over unused ones. Creates new
+      /// identifiers if no free identifiers are left.
+      CODI_NO_INLINE bool assignFromOtherRegion(Index& index, bool onlyUnused) {
+        bool generatedNewIndex = false;
+
+        size_t region = NoRegion;
+        if (!onlyUnused) {
+          region = usedLists.findRegion(currentRegion);
+          if (NoRegion != region) {
+            currentRegion = region;
+            index = usedLists.pop(currentRegion, nextFree);
+
+            return generatedNewIndex;
+          }
+        }
+
+        region = unusedLists.findRegion(currentRegion);
+        if (NoRegion == region) {
+          region = generateNewIndices();
+          generatedNewIndex = true;
+        }
+
+        currentRegion = region;
+        index = unusedLists.pop(currentRegion, nextFree);
+
+        return generatedNewIndex;
+      }
+
+      /// Create the identifiers up to the end of the region of the next identifier. Returns this region.
+      CODI_NO_INLINE size_t generateNewIndices() {
+        size_t region = getRegion(globalMaximumIndex + 1);
+        Index const first = globalMaximumIndex + 1;
+        Index const last = Index(((region + 1) << RegionSizeLog2) - 1);
+
+        nextFree.resize((size_t)last + 1, Base::InactiveIndex);
+        usedLists.resize(region + 1);
+        unusedLists.resize(region + 1);
+
+        // Push in reverse order, such that the identifiers are assigned in increasing order.
+        for (Index index = last; index >= first; index -= 1) {
+          unusedLists.push(index, nextFree);
+        }
+
+        globalMaximumIndex = last;
+
+        return region;
+      }
+  };
+}
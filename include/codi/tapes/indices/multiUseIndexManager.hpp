@@ -51,15 +51,18 @@ namespace codi {
    * Performs reference counting for each index. If the reference count is zero, then the index is freed and given back
    * to the ReuseIndexManager.
    *
-   * @tparam T_Index   Type for the identifier, usually an integer type.
+   * The underlying reuse index manager can be exchanged, e.g., for LocalityReuseIndexManager.
+   *
+   * @tparam T_Index              Type for the identifier, usually an integer type.
+   * @tparam T_ReuseIndexManager  Index manager that performs the index reuse. Needs the interface of ReuseIndexManager.
    */
-  template<typename T_Index>
-  struct MultiUseIndexManager : public ReuseIndexManager<T_Index> {
+  template<typename T_Index, typename T_ReuseIndexManager = ReuseIndexManager<T_Index>>
+  struct MultiUseIndexManager : public T_ReuseIndexManager {
     public:
 
-      using Index = CODI_DD(T_Index, int);    ///< See MultiUseIndexManager.
-      using ActiveTypeIndexData = Index;      ///< Same as the index.
-      using Base = ReuseIndexManager<Index>;  ///< Base class abbreviation.
+      using Index = CODI_DD(T_Index, int);                                    ///< See MultiUseIndexManager.
+      using ActiveTypeIndexData = Index;                                      ///< Same as the index.
+      using Base = CODI_DD(T_ReuseIndexManager, ReuseIndexManager<Index>);  ///< See MultiUseIndexManager.
 
       /*******************************************************************************/
       /// @name IndexManagerInterface: Constants
@@ -35,6 +35,8 @@
 #pragma once
 
 #include <algorithm>
+#include <array>
+#include <type_traits>
 #include <vector>
 
 #include "../../config.h"
@@ -252,11 +254,7 @@ namespace codi {
         usedIndicesPos = 0;
 
         if (Config::SortIndicesOnReset) {
-          if (totalSize == unusedIndices.size()) {
-            std::sort(unusedIndices.begin(), unusedIndices.end());
-          } else {
-            std::sort(&unusedIndices[0], &unusedIndices[unusedIndicesPos]);
-          }
+          sortIndices(unusedIndices.data(), unusedIndicesPos);
         }
       }
 
@@ -299,6 +297,45 @@ namespace codi {
 
     private:
 
+      /// Least significant digit radix sort of the indices. Indices are bounded by the largest created index, so only
+      /// the digits up to its highest bit are sorted.
+      CODI_NO_INLINE void sortIndices(Index* indices, size_t count) {
+        using UnsignedIndex = typename std::make_unsigned<Index>::type;
+
+        size_t constexpr DigitBits = 8;
+        size_t constexpr Buckets = size_t(1) << DigitBits;
+
+        size_t const indexBits = getBitWidth((size_t)cast().getLargestCreatedIndex());
+
+        std::vector<Index> buffer(count);
+        Index* from = indices;
+        Index* to = buffer.data();
+
+        for (size_t shift = 0; shift < indexBits; shift += DigitBits) {
+          std::array<size_t, Buckets> offsets = {};
+          for (size_t pos = 0; pos < count; ++pos) {
+            offsets[((UnsignedIndex)from[pos] >> shift) & (Buckets - 1)] += 1;
+          }
+
+          size_t sum = 0;
+          for (size_t& offset : offsets) {
+            size_t bucketSize = offset;
+            offset = sum;
+            sum += bucketSize;
+          }
+
+          for (size_t pos = 0; pos < count; ++pos) {
+            to[offsets[((UnsignedIndex)from[pos] >> shift) & (Buckets - 1)]++] = from[pos];
+          }
+
+          std::swap(from, to);
+        }
+
+        if (from != indices) {
+          std::copy(from, from + count, indices);
+        }
+      }
+
       CODI_NO_INLINE void increaseIndicesSize(std::vector<Index>& v) {
         v.resize(v.size() + indexSizeIncrement);
       }
@@ -88,6 +88,18 @@ namespace codi {
       template<typename AdjointVector>
       void evaluate(Position const& start, Position const& end, AdjointVector&& data);
 
+      /**
+       * \copybrief codi::PositionalEvaluationTapeInterface::evaluate
+       *
+       * Tape evaluation with a custom adjoint vector that can be called by several threads at the same time. The state
+       * of the tape is not modified and low level functions use the temporary memory of the calling thread. Each thread
+       * needs its own adjoint vector. External functions and event listeners need to support concurrent calls.
+       *
+       * @tparam AdjointVector  See CustomAdjointVectorEvaluationTapeInterface documentation.
+       */
+      template<typename AdjointVector>
+      void evaluateConcurrent(Position const& start, Position const& end, AdjointVector&& data);
+
       // clang-format off
       /**
        * \copybrief codi::ForwardEvaluationTapeInterface::evaluateForward(T_Position const&, T_Position const&, AdjointsManagement)
@@ -60,8 +60,9 @@ namespace codi {
       using Tape = void;         ///< Any CoDiPack tape implementation.
       using EvalHandle = void*;  ///< See PrimalValueTapeTypes.
 
-      /// Called for each statement in a Jacobian tape.
-      void handleStatement(Identifier& lhsIndex, Config::ArgumentSize const& size, Real const* jacobians,
+      /// Called for each statement in a Jacobian tape. The Jacobians are provided in the storage type of the tape,
+      /// see JacobianTapeTypes::JacobianReal.
+      void handleStatement(Identifier& lhsIndex, size_t const& size, Real const* jacobians,
                            Identifier const* rhsIdentifiers);
       /// Called for each statement in a primal value tape.
       void handleStatement(EvalHandle const& evalHandle, Config::ArgumentSize const& nPassiveValues,
@@ -59,6 +59,10 @@ namespace codi {
    *
    * Afterwards the user has to call pushJacobianManual() for each argument \f$u\f$.
    *
+   * The number of arguments has to be smaller than Config::MaxArgumentSize. If SupportsWideStatements is true, the
+   * number of arguments can also be in the range [Config::MinWideArgumentSize, Config::MaxWideArgumentSize], see
+   * Config::WideStatements.
+   *
    * The user has to ensure that the computations of the Jacobians are evaluated such that the CoDiPack tape does not
    * accidentally record them.
    *
@@ -77,6 +81,10 @@ namespace codi {
       using Gradient = CODI_DD(T_Gradient, double);                   ///< See ManualStatementPushTapeInterface.
       using ActiveTypeTapeData = CODI_DD(T_ActiveTypeTapeData, int);  ///< See ManualStatementPushTapeInterface.
 
+      static bool constexpr SupportsWideStatements =
+          CODI_UNDEFINED_VALUE;  ///< True if storeManual accepts statements with more than Config::MaxArgumentSize
+                                 ///< arguments.
+
       /*******************************************************************************/
       /// @name Interface definition
 
@@ -92,6 +100,6 @@ namespace codi {
       /// @param lhsValue   Value of the result \f$ w \f$. Usually `w.value()`.
       /// @param lhsData    Tape data of the result \f$ w \f$. Usually `w.getTapeData()`.
       /// @param size       Number of arguments of \f$ \phi \f$.
-      void storeManual(Real const& lhsValue, ActiveTypeTapeData& lhsData, Config::ArgumentSize const& size);
+      void storeManual(Real const& lhsValue, ActiveTypeTapeData& lhsData, size_t const& size);
   };
 }
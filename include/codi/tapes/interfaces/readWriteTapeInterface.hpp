@@ -94,9 +94,10 @@ namespace codi {
       /// @name Tape Reading
 
       /// Initialize the statement from a file. It is especially important that the lhsIndex is valid when using this
-      /// method. This overload is used for Jacobian tapes.
-      void createStatementManual(Real const& lhsValue, Identifier& lhsIndex, Config::ArgumentSize const& size,
-                                 Real const* jacobians, Identifier const* rhsIdentifiers);
+      /// method. This overload is used for Jacobian tapes. Sizes of at least Config::MinWideArgumentSize create a wide
+      /// statement, see Config::WideStatements.
+      void createStatementManual(Real const& lhsValue, Identifier& lhsIndex, size_t const& size, Real const* jacobians,
+                                 Identifier const* rhsIdentifiers);
 
       ///  Initialize the statement and the rhs vectors from a file. It is especially important that the Identifiers are
       ///  valid when using this method. This overload is used for Primal tapes.
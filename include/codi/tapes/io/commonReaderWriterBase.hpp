@@ -414,7 +414,7 @@ namespace codi {
       }
 
       /// Ensure that all the nodes on the rhs have been placed in the .dot file before creating edges to them.
-      void placeUnusedRhsNodes(Identifier const* const rhsIdentifiers, Config::ArgumentSize const& nArguments) {
+      void placeUnusedRhsNodes(Identifier const* const rhsIdentifiers, size_t const& nArguments) {
         // Check if the identifierExtension is zero for any of the rhsIdentifiers. A zero extension indicates that the
         // node has not been placed. The type of the identifier is then checked to add the correct colour coding.
         for (size_t argCount = 0; argCount < nArguments; argCount++) {
@@ -74,10 +74,10 @@ namespace codi {
 
       /**
        * \copydoc codi::TapeWriterInterface::writeStatement(Identifier const&, size_t&, Real const* const,
-       *                                                    Identifier const* const, Config::ArgumentSize const&)
+       *                                                    Identifier const* const, size_t const&)
        */
       void writeStatement(Identifier const& curLhsIdentifier, size_t& curJacobianPos, Real const* const rhsJacobians,
-                          Identifier const* const rhsIdentifiers, Config::ArgumentSize const& nJacobians) {
+                          Identifier const* const rhsIdentifiers, size_t const& nJacobians) {
         std::string node;
         if (nJacobians == Config::StatementInputTag) CODI_Unlikely {
           // Do nothing.
@@ -54,7 +54,7 @@ namespace codi {
       JacobianBaseTapeReader() : CommonBaseTapeReader<T_Type>() {};  ///< Constructor.
 
       /// Used to register the currently read statement form the tape file onto the new tape.
-      void registerStatement(Identifier const& lhsIdentifier, Config::ArgumentSize const& nArgs,
+      void registerStatement(Identifier const& lhsIdentifier, size_t const& nArgs,
                              std::vector<Identifier> const& rhsIdentifiers, std::vector<Real> const& rhsJacobians,
                              Identifier& lowestIndex, bool& isFirstIdentifier) {
         // Update the lowest identifier for the Linear case. The lowest identifier will be the first identifier.
@@ -49,6 +49,9 @@ namespace codi {
    * lhsIdentifier(Identifier) numberOfArguments(Config::ArgumentSize) (rhsIdentifiers(Identifier) rhsJacobian(Real) ...
    * [repeats numberOfArguments times]) \endcode
    *
+   * For wide statements, see Config::WideStatements, numberOfArguments is Config::StatementWideTag and is followed by
+   * the actual number of arguments as a size_t.
+   *
    * See codi::TapeWriterInterface for a general description on how to use tape writers.
    *
    * @tparam T_Type The CoDiPack type of the tape that is to be written out.
@@ -76,12 +79,19 @@ namespace codi {
 
       /**
        * \copydoc codi::TapeWriterInterface::writeStatement(Identifier const&, size_t&, Real const* const,
-       *                                                    Identifier const* const, Config::ArgumentSize const&)
+       *                                                    Identifier const* const, size_t const&)
        */
       void writeStatement(Identifier const& curLhsIdentifier, size_t& curJacobianPos, Real const* const rhsJacobians,
-                          Identifier const* const rhsIdentifiers, Config::ArgumentSize const& nJacobians) {
+                          Identifier const* const rhsIdentifiers, size_t const& nJacobians) {
         fwrite(&curLhsIdentifier, sizeof(Identifier), 1, fileHandleBin);
-        fwrite(&nJacobians, sizeof(Config::ArgumentSize), 1, fileHandleBin);
+        if (nJacobians > Config::StatementInputTag) CODI_Unlikely {
+          Config::ArgumentSize wideTag = Config::StatementWideTag;
+          fwrite(&wideTag, sizeof(Config::ArgumentSize), 1, fileHandleBin);
+          fwrite(&nJacobians, sizeof(size_t), 1, fileHandleBin);
+        } else CODI_Likely {
+          Config::ArgumentSize argsSize = (Config::ArgumentSize)nJacobians;
+          fwrite(&argsSize, sizeof(Config::ArgumentSize), 1, fileHandleBin);
+        }
         if (nJacobians == Config::StatementInputTag) CODI_Unlikely {
           // Do nothing.
         } else CODI_Likely {
@@ -107,6 +117,9 @@ namespace codi {
    * lhsIdentifier(Identifier) numberOfArguments(Config::ArgumentSize) (rhsIdentifiers(Identifier) rhsJacobian(Real) ...
    * [repeats numberOfArguments times]) \endcode
    *
+   * For wide statements, see Config::WideStatements, numberOfArguments is Config::StatementWideTag and is followed by
+   * the actual number of arguments as a size_t.
+   *
    * See codi::TapeReaderInterface for a general description on how to use tape readers.
    *
    * @tparam T_Type The CoDiPack type of the tape that is to be restored.
@@ -128,7 +141,8 @@ namespace codi {
         Identifier lowestIndex = 0;
 
         Identifier lhsIdentifier;
-        Config::ArgumentSize nArgs;
+        Config::ArgumentSize argsSize;
+        size_t nArgs;
 
         std::vector<Identifier> rhsIdentifiers(Config::MaxArgumentSize, 0);
         std::vector<Real> rhsJacobians(Config::MaxArgumentSize, 0);
@@ -140,7 +154,16 @@ namespace codi {
         this->openFile(fileHandleReadBin, this->fileName, "rb");
 
         while (fread(&lhsIdentifier, sizeof(Identifier), 1, fileHandleReadBin) == 1) {
-          fread(&nArgs, sizeof(Config::ArgumentSize), 1, fileHandleReadBin);
+          fread(&argsSize, sizeof(Config::ArgumentSize), 1, fileHandleReadBin);
+          nArgs = argsSize;
+          if (nArgs == Config::StatementWideTag) CODI_Unlikely {
+            fread(&nArgs, sizeof(size_t), 1, fileHandleReadBin);
+            if (nArgs > rhsIdentifiers.size()) {
+              rhsIdentifiers.resize(nArgs);
+              rhsJacobians.resize(nArgs);
+            }
+          }
+
           if (nArgs == Config::StatementLowLevelFunctionTag) CODI_Unlikely {
             // TODO.
           } else if (nArgs == Config::StatementInputTag) CODI_Unlikely {
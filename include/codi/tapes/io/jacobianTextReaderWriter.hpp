@@ -92,16 +92,16 @@ namespace codi {
 
       /**
        * \copydoc codi::TapeWriterInterface::writeStatement(Identifier const&, size_t&, Real const* const,
-       *                                                    Identifier const* const, Config::ArgumentSize const&)
+       *                                                    Identifier const* const, size_t const&)
        */
       void writeStatement(Identifier const& curLhsIdentifier, size_t& curJacobianPos, Real const* const rhsJacobians,
-                          Identifier const* const rhsIdentifiers, Config::ArgumentSize const& nJacobians) {
+                          Identifier const* const rhsIdentifiers, size_t const& nJacobians) {
         if (nJacobians == Config::StatementInputTag) CODI_Unlikely {
           if (printInputStatements) {
-            fprintf(fileHandleTxt, "\n%d  %hhu  []", curLhsIdentifier, static_cast<Config::ArgumentSize>(nJacobians));
+            fprintf(fileHandleTxt, "\n%d  %zu  []", curLhsIdentifier, nJacobians);
           }
         } else CODI_Likely {
-          fprintf(fileHandleTxt, "\n%d  %hhu  [", curLhsIdentifier, static_cast<Config::ArgumentSize>(nJacobians));
+          fprintf(fileHandleTxt, "\n%d  %zu  [", curLhsIdentifier, nJacobians);
 
           for (size_t argCount = 0; argCount < nJacobians; argCount++) {
             fprintf(fileHandleTxt, " %d ", rhsIdentifiers[curJacobianPos + argCount]);
@@ -181,7 +181,7 @@ namespace codi {
         Identifier lowestIndex = 0;
 
         Identifier lhsIdentifier;
-        Config::ArgumentSize nArgs;
+        size_t nArgs;
 
         std::vector<Identifier> rhsIdentifiers(Config::MaxArgumentSize, 0);
         std::vector<Real> rhsJacobians(Config::MaxArgumentSize, 0);
@@ -203,7 +203,13 @@ namespace codi {
           }
           ungetc(next, fileHandleReadTxt);
 
-          fscanf(fileHandleReadTxt, "%hhu  [", &nArgs);
+          fscanf(fileHandleReadTxt, "%zu  [", &nArgs);
+          if (nArgs > rhsIdentifiers.size()) CODI_Unlikely {
+            // Wide statement, see Config::WideStatements.
+            rhsIdentifiers.resize(nArgs);
+            rhsJacobians.resize(nArgs);
+          }
+
           if (nArgs == Config::StatementLowLevelFunctionTag) CODI_Unlikely {
             // Will throw in previous if.
           } else if (nArgs == Config::StatementInputTag) CODI_Unlikely {
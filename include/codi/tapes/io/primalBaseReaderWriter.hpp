@@ -112,6 +112,38 @@ namespace codi {
         }
         // Footer print
         fprintf(fileHandleCreator, "\n  %s", fileFooter.c_str());
+
+        generateStatementRegistry(fileHandleCreator);
+      }
+
+      /// Add the statement registry for the SwitchStatementEvaluator to the handle creator file. The statements are
+      /// written for an arbitrary tape Impl. Statements with other generators, e.g. Jacobian statements, are skipped.
+      void generateStatementRegistry(FILE* fileHandleCreator) {
+        std::string const tapeName = demangleName<Tape>();
+        std::string const genericTapeName = "Impl";
+        std::string const tapeGeneratorPrefix = "Impl, Impl, ";
+
+        std::string registryName = this->modifyFileName("StatementRegistry");
+        fprintf(fileHandleCreator, "\n\ntemplate <typename Impl>\nstruct %s {\n  using Statements = std::tuple<",
+                registryName.c_str());
+
+        bool first = true;
+        for (std::string const& stmt : evalHandleStatements) {
+          if (0 != stmt.compare(0, tapeGeneratorPrefix.size(), tapeGeneratorPrefix)) {
+            continue;
+          }
+
+          std::string genericStmt = stmt.substr(tapeGeneratorPrefix.size());
+          for (size_t pos = genericStmt.find(tapeName); pos != std::string::npos;
+               pos = genericStmt.find(tapeName, pos + genericTapeName.size())) {
+            genericStmt.replace(pos, tapeName.size(), genericTapeName);
+          }
+
+          fprintf(fileHandleCreator, "%s\n    %s", first ? "" : ",", genericStmt.c_str());
+          first = false;
+        }
+
+        fprintf(fileHandleCreator, ">;\n};\n");
       }
 
       /// Get the index for an evalHandle.
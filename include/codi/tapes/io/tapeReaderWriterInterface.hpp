@@ -151,7 +151,7 @@ namespace codi {
        */
       virtual void writeStatement(Identifier const& curLhsIdentifier, size_t& curJacobianPos,
                                   Real const* const rhsJacobians, Identifier const* const rhsIdentifiers,
-                                  Config::ArgumentSize const& nJacobians) {
+                                  size_t const& nJacobians) {
         CODI_UNUSED(curLhsIdentifier, curJacobianPos, rhsJacobians, rhsIdentifiers, nJacobians);
       }
 
@@ -245,6 +245,9 @@ namespace codi {
    * std::cout << tape.gradient(textRead->getInputs()[0]) << std::endl;
    * \endcode
    *
+   * The header file also contains the template <tt>"filename"StatementRegistry</tt>. It lists all statements of the
+   * written tape and can be used as the registry of a codi::SwitchStatementEvaluator.
+   *
    * @tparam T_Type The CoDiPack type of the tape that is to be restored.
    */
   template<typename T_Type>
@@ -35,6 +35,7 @@
 #pragma once
 
 #include <algorithm>
+#include <array>
 #include <cmath>
 #include <fstream>
 #include <type_traits>
@@ -74,15 +75,18 @@ namespace codi {
    * @tparam T_IndexManager  Index manager for the tape. Has to implement IndexManagerInterface.
    * @tparam T_Data          See TapeTypesInterface.
    * @tparam T_Adjoints      Internal implementation of the adjoint variables.
+   * @tparam T_JacobianReal  Storage type of the recorded Jacobians, e.g. float for double computations. Jacobians are
+   *                         converted on recording and converted back to T_Real during evaluation.
    */
   template<typename T_Real, typename T_Gradient, typename T_IndexManager, template<typename, typename> class T_Data,
-           template<typename, typename, typename> class T_Adjoints = LocalAdjoints>
+           template<typename, typename, typename> class T_Adjoints = LocalAdjoints, typename T_JacobianReal = T_Real>
   struct JacobianTapeTypes : public TapeTypesInterface {
     public:
 
       using Real = CODI_DD(T_Real, double);                                              ///< See JacobianTapeTypes.
       using Gradient = CODI_DD(T_Gradient, double);                                      ///< See JacobianTapeTypes.
       using IndexManager = CODI_DD(T_IndexManager, CODI_T(IndexManagerInterface<int>));  ///< See JacobianTapeTypes.
+      using JacobianReal = CODI_DD(T_JacobianReal, double);                              ///< See JacobianTapeTypes.
       template<typename Chunk, typename Nested>
       using Data = CODI_DD(CODI_T(T_Data<Chunk, Nested>),
                            CODI_T(DataInterface<Nested>));  ///< See JacobianTapeTypes.
@@ -106,7 +110,7 @@ namespace codi {
                                                        Chunk2<Identifier, Config::ArgumentSize> >::type;
       using StatementData = Data<StatementChunk, IndexManager>;  ///< Statement data vector.
 
-      using JacobianChunk = Chunk2<Real, Identifier>;           ///< Jacobian chunks is \<Jacobian, rhs index\>.
+      using JacobianChunk = Chunk2<JacobianReal, Identifier>;   ///< Jacobian chunks is \<Jacobian, rhs index\>.
       using JacobianData = Data<JacobianChunk, StatementData>;  ///< Jacobian data vector.
 
       using NestedData = JacobianData;  ///< See TapeTypesInterface.
@@ -145,6 +149,7 @@ namespace codi {
       using IndexManager = typename TapeTypes::IndexManager;              ///< See JacobianTapeTypes.
       using Identifier = typename TapeTypes::Identifier;                  ///< See TapeTypesInterface.
       using ActiveTypeTapeData = typename TapeTypes::ActiveTypeTapeData;  ///< See TapeTypesInterface.
+      using JacobianReal = typename TapeTypes::JacobianReal;              ///< See JacobianTapeTypes.
 
       using StatementData = typename TapeTypes::StatementData;  ///< See JacobianTapeTypes.
       using JacobianData = typename TapeTypes::JacobianData;    ///< See JacobianTapeTypes.
@@ -166,6 +171,8 @@ namespace codi {
       static bool constexpr LinearIndexHandling =
           TapeTypes::IsLinearIndexHandler;                  ///< See IdentifierInformationTapeInterface.
       static bool constexpr RequiresPrimalRestore = false;  ///< See PrimalEvaluationTapeInterface.
+      static bool constexpr SupportsWideStatements =
+          Config::WideStatements;  ///< See ManualStatementPushTapeInterface.
 
     protected:
 
@@ -180,6 +187,9 @@ namespace codi {
 
       Adjoints adjoints;  ///< Evaluation vector for AD.
 
+      size_t wideStatementSize;        ///< Number of arguments of the current manual wide statement.
+      size_t wideStatementPushesLeft;  ///< Remaining manual pushes of a wide statement, see Config::WideStatements.
+
     private:
 
       CODI_INLINE Impl const& cast() const {
@@ -219,10 +229,14 @@ namespace codi {
 #endif
             indexManager(0),  // Reserve the zero index.
             statementData(Config::ChunkSize),
-            jacobianData(std::max(Config::ChunkSize, Config::MaxArgumentSize)),  // Chunk must be large enough to store
-                                                                                 // data for all arguments of one
-                                                                                 // statement.
-            adjoints(1)  // Ensure that adjoint[0] exists, see its use in gradient() const.
+            jacobianData(std::max(Config::ChunkSize,
+                                  Config::WideStatements ? Config::MaxWideArgumentSize + 2
+                                                         : Config::MaxArgumentSize)),  // Chunk must be large enough to
+                                                                                       // store data for all arguments
+                                                                                       // of one statement.
+            adjoints(1),  // Ensure that adjoint[0] exists, see its use in gradient() const.
+            wideStatementSize(0),
+            wideStatementPushesLeft(0)
 
       {
         statementData.setNested(&indexManager.get());
@@ -428,16 +442,18 @@ namespace codi {
                                     (Config::ArgumentSize)numberOfArguments[i.value]);
 
                 if (Config::StatementEvents) {
-                  Real* jacobians;
+                  JacobianReal* jacobians;
                   Identifier* rhsIdentifiers;
                   jacobianData.getDataPointers(jacobians, rhsIdentifiers);
                   jacobians -= totalNumberOfArguments;
                   rhsIdentifiers -= totalNumberOfArguments;
 
+                  JacobianBuffer buffer;
                   EventSystem<Impl>::notifyStatementStoreOnTapeListeners(
                       cast(), lhs.values[i.value].getIdentifier(),
                       AggregatedTraits::template arrayAccess<i.value>(real), numberOfArguments[i.value],
-                      &rhsIdentifiers[eventJacobianOffset], &jacobians[eventJacobianOffset]);
+                      &rhsIdentifiers[eventJacobianOffset],
+                      jacobiansAsReal(&jacobians[eventJacobianOffset], numberOfArguments[i.value], buffer));
 
                   eventJacobianOffset += numberOfArguments[i.value];
                 }
@@ -508,15 +524,16 @@ namespace codi {
             cast().pushStmtData(lhs.cast().getIdentifier(), (Config::ArgumentSize)numberOfArguments);
 
             if (Config::StatementEvents) {
-              Real* jacobians;
+              JacobianReal* jacobians;
               Identifier* rhsIdentifiers;
               jacobianData.getDataPointers(jacobians, rhsIdentifiers);
               jacobians -= numberOfArguments;
               rhsIdentifiers -= numberOfArguments;
 
-              EventSystem<Impl>::notifyStatementStoreOnTapeListeners(cast(), lhs.cast().getIdentifier(),
-                                                                     rhs.cast().getValue(), numberOfArguments,
-                                                                     rhsIdentifiers, jacobians);
+              JacobianBuffer buffer;
+              EventSystem<Impl>::notifyStatementStoreOnTapeListeners(
+                  cast(), lhs.cast().getIdentifier(), rhs.cast().getValue(), numberOfArguments, rhsIdentifiers,
+                  jacobiansAsReal(jacobians, numberOfArguments, buffer));
             }
           } else {
             indexManager.get().template freeIndex<Impl>(lhs.cast().getTapeData());
@@ -650,23 +667,167 @@ namespace codi {
 
     protected:
 
+      /// Temporary storage for the conversion of recorded Jacobians to Real.
+      using JacobianBuffer =
+          typename std::conditional<std::is_same<JacobianReal, Real>::value, char,
+                                    typename std::conditional<Config::WideStatements, std::vector<Real>,
+                                                              std::array<Real, Config::MaxArgumentSize>>::type>::type;
+
+      /// Ensures that the buffer can hold size entries.
+      CODI_INLINE static void resizeJacobianBuffer(std::vector<Real>& buffer, size_t size) {
+        if (buffer.size() < size) {
+          buffer.resize(size);
+        }
+      }
+
+      /// Arrays have a fixed size.
+      template<size_t size>
+      CODI_INLINE static void resizeJacobianBuffer(std::array<Real, size>& buffer, size_t newSize) {
+        CODI_UNUSED(buffer, newSize);
+      }
+
+      /// Converts a recorded Jacobian to the computation type. No-op if the types agree.
+      CODI_INLINE static Real const& jacobianToReal(Real const& jacobian) {
+        return jacobian;
+      }
+
+      /// Converts a recorded Jacobian to the computation type.
+      template<typename T>
+      CODI_INLINE static Real jacobianToReal(T const& jacobian) {
+        return Real(jacobian);
+      }
+
+      /// Provides recorded Jacobians as Real values for interfaces that expect the computation type. The data is
+      /// returned directly if the types agree, otherwise it is converted into the buffer.
+      CODI_INLINE static Real const* jacobiansAsReal(JacobianReal const* jacobians, size_t size,
+                                                     JacobianBuffer& buffer) {
+        if constexpr (std::is_same<JacobianReal, Real>::value) {
+          CODI_UNUSED(size, buffer);
+          return jacobians;
+        } else {
+          resizeJacobianBuffer(buffer, size);
+          codiAssert(size <= buffer.size());
+          for (size_t i = 0; i < size; ++i) {
+            buffer[i] = jacobianToReal(jacobians[i]);
+          }
+          return buffer.data();
+        }
+      }
+
+      /// Provides the entries of an adjoint as Real values for the statement evaluate events. Converts the entries if
+      /// the adjoint type has a different precision than Real.
+      template<typename Adjoint>
+      CODI_INLINE static auto adjointAsRealArray(Adjoint const& adjoint) {
+        using ArrayReal = AtomicTraits::RemoveAtomic<GradientTraits::Real<Adjoint>>;
+        size_t constexpr dim = GradientTraits::dim<Adjoint>();
+
+        if constexpr (std::is_same<ArrayReal, Real>::value) {
+          return GradientTraits::toArray(adjoint);
+        } else {
+          std::array<ArrayReal, dim> values = GradientTraits::toArray(adjoint);
+          std::array<Real, dim> result;
+          for (size_t i = 0; i < dim; ++i) {
+            result[i] = Real(values[i]);
+          }
+          return result;
+        }
+      }
+
+      /// Passes a Jacobian statement to a writer. Converts the recorded Jacobians if necessary.
+      template<typename Writer>
+      CODI_INLINE static void writeJacobianStatement(Writer* writer, Identifier const& lhsIdentifier,
+                                                     size_t& curJacobianPos, JacobianReal const* const rhsJacobians,
+                                                     Identifier const* const rhsIdentifiers,
+                                                     size_t const& argsSize) {
+        if constexpr (std::is_same<JacobianReal, Real>::value) {
+          writer->writeStatement(lhsIdentifier, curJacobianPos, rhsJacobians, rhsIdentifiers, argsSize);
+        } else {
+          JacobianBuffer buffer;
+          size_t bufferPos = 0;
+          size_t size = Config::StatementInputTag == argsSize ? 0 : argsSize;
+          writer->writeStatement(lhsIdentifier, bufferPos, jacobiansAsReal(&rhsJacobians[curJacobianPos], size, buffer),
+                                 &rhsIdentifiers[curJacobianPos], argsSize);
+        }
+      }
+
+      /*
+       * Wide statements, see Config::WideStatements, are tagged with Config::StatementWideTag in the statement data.
+       * The number of arguments is stored in the identifier of an additional Jacobian entry in front of and after the
+       * arguments, so that it is available in both evaluation directions.
+       */
+
+      /// Start a statement in a forward iteration over the Jacobian data. Returns the number of arguments and skips the
+      /// leading entry of a wide statement.
+      CODI_INLINE static size_t beginStatementForward(Config::ArgumentSize const& argsSize, size_t& curJacobianPos,
+                                                      Identifier const* const rhsIdentifiers) {
+        if (Config::WideStatements && Config::StatementWideTag == argsSize) CODI_Unlikely {
+          size_t numberOfArguments = (size_t)rhsIdentifiers[curJacobianPos];
+          curJacobianPos += 1;
+          return numberOfArguments;
+        } else CODI_Likely {
+          CODI_UNUSED(curJacobianPos, rhsIdentifiers);
+          return argsSize;
+        }
+      }
+
+      /// Finish a statement in a forward iteration over the Jacobian data. Skips the trailing entry of a wide
+      /// statement.
+      CODI_INLINE static void endStatementForward(Config::ArgumentSize const& argsSize, size_t& curJacobianPos) {
+        if (Config::WideStatements && Config::StatementWideTag == argsSize) CODI_Unlikely {
+          curJacobianPos += 1;
+        }
+      }
+
+      /// Start a statement in a reverse iteration over the Jacobian data. Returns the number of arguments and skips the
+      /// trailing entry of a wide statement.
+      CODI_INLINE static size_t beginStatementReverse(Config::ArgumentSize const& argsSize, size_t& curJacobianPos,
+                                                      Identifier const* const rhsIdentifiers) {
+        if (Config::WideStatements && Config::StatementWideTag == argsSize) CODI_Unlikely {
+          curJacobianPos -= 1;
+          return (size_t)rhsIdentifiers[curJacobianPos];
+        } else CODI_Likely {
+          CODI_UNUSED(rhsIdentifiers);
+          return argsSize;
+        }
+      }
+
+      /// Finish a statement in a reverse iteration over the Jacobian data. Skips the leading entry of a wide statement.
+      CODI_INLINE static void endStatementReverse(Config::ArgumentSize const& argsSize, size_t& curJacobianPos) {
+        if (Config::WideStatements && Config::StatementWideTag == argsSize) CODI_Unlikely {
+          curJacobianPos -= 1;
+        }
+      }
+
+      /// True if a statement with size arguments can be stored as a wide statement.
+      CODI_INLINE static bool isValidWideStatementSize(size_t const& size) {
+        return Config::WideStatements && Config::MinWideArgumentSize <= size && size <= Config::MaxWideArgumentSize;
+      }
+
+      /// Push the leading or trailing entry of a wide statement.
+      CODI_INLINE void pushWideStatementSize(size_t const& size) {
+        jacobianData.pushData(JacobianReal(), (Identifier)size);
+      }
+
       /// Performs the AD \ref sec_reverseAD "reverse" equation for a statement.
       template<typename AdjointVector>
       CODI_INLINE static void incrementAdjoints(
           AdjointVector& CODI_RESTRICT adjointVector,
           AdjointVectorTraits::Gradient<AdjointVector> const& CODI_RESTRICT lhsAdjoint,
-          Config::ArgumentSize const& CODI_RESTRICT numberOfArguments, size_t& CODI_RESTRICT curJacobianPos,
-          Real const* CODI_RESTRICT const rhsJacobians, Identifier const* CODI_RESTRICT const rhsIdentifiers) {
+          Config::ArgumentSize const& CODI_RESTRICT argsSize, size_t& CODI_RESTRICT curJacobianPos,
+          JacobianReal const* CODI_RESTRICT const rhsJacobians, Identifier const* CODI_RESTRICT const rhsIdentifiers) {
+        size_t const numberOfArguments = beginStatementReverse(argsSize, curJacobianPos, rhsIdentifiers);
         size_t endJacobianPos = curJacobianPos - numberOfArguments;
 
         if (CODI_ENABLE_CHECK(Config::SkipZeroAdjointEvaluation, !RealTraits::isTotalZero(lhsAdjoint))) CODI_Likely {
           while (endJacobianPos < curJacobianPos) CODI_Likely {
             curJacobianPos -= 1;
-            adjointVector[rhsIdentifiers[curJacobianPos]] += rhsJacobians[curJacobianPos] * lhsAdjoint;
+            adjointVector[rhsIdentifiers[curJacobianPos]] += jacobianToReal(rhsJacobians[curJacobianPos]) * lhsAdjoint;
           }
         } else CODI_Unlikely {
           curJacobianPos = endJacobianPos;
         }
+
+        endStatementReverse(argsSize, curJacobianPos);
       }
 
       /// Wrapper helper for improved compiler optimizations.
@@ -677,16 +838,19 @@ namespace codi {
       template<typename AdjointVector>
       CODI_INLINE static void incrementTangents(AdjointVector const& CODI_RESTRICT adjointVector,
                                                 AdjointVectorTraits::Gradient<AdjointVector>& CODI_RESTRICT lhsAdjoint,
-                                                Config::ArgumentSize const& numberOfArguments,
+                                                Config::ArgumentSize const& argsSize,
                                                 size_t& CODI_RESTRICT curJacobianPos,
-                                                Real const* CODI_RESTRICT const rhsJacobians,
+                                                JacobianReal const* CODI_RESTRICT const rhsJacobians,
                                                 Identifier const* CODI_RESTRICT const rhsIdentifiers) {
+        size_t const numberOfArguments = beginStatementForward(argsSize, curJacobianPos, rhsIdentifiers);
         size_t endJacobianPos = curJacobianPos + numberOfArguments;
 
         while (curJacobianPos < endJacobianPos) CODI_Likely {
-          lhsAdjoint += rhsJacobians[curJacobianPos] * adjointVector[rhsIdentifiers[curJacobianPos]];
+          lhsAdjoint += jacobianToReal(rhsJacobians[curJacobianPos]) * adjointVector[rhsIdentifiers[curJacobianPos]];
           curJacobianPos += 1;
         }
+
+        endStatementForward(argsSize, curJacobianPos);
       }
 
       /// Wrapper helper for improved compiler optimizations.
@@ -715,6 +879,14 @@ namespace codi {
                                                        EventHints::EvaluationKind::Reverse, EventHints::Endpoint::End);
       }
 
+      /// \copydoc codi::CustomAdjointVectorEvaluationTapeInterface::evaluateConcurrent()
+      template<typename AdjointVector>
+      void evaluateConcurrent(Position const& start, Position const& end, AdjointVector&& data) {
+        typename Base::ConcurrentEvaluationScope scope;
+
+        evaluate(start, end, std::forward<AdjointVector>(data));
+      }
+
       /// \copydoc codi::CustomAdjointVectorEvaluationTapeInterface::evaluate()
       template<typename AdjointVector>
       CODI_NO_INLINE void evaluateForward(Position const& start, Position const& end, AdjointVector&& data) {
@@ -887,31 +1059,51 @@ namespace codi {
         if (Config::StatementEvents) {
           if (this->manualPushCounter == this->manualPushGoal) {
             // emit statement event
-            Real* jacobians;
+            JacobianReal* jacobians;
             Identifier* rhsIdentifiers;
             jacobianData.getDataPointers(jacobians, rhsIdentifiers);
             jacobians -= this->manualPushGoal;
             rhsIdentifiers -= this->manualPushGoal;
 
-            EventSystem<Impl>::notifyStatementStoreOnTapeListeners(cast(), this->manualPushLhsIdentifier,
-                                                                   this->manualPushLhsValue, this->manualPushGoal,
-                                                                   rhsIdentifiers, jacobians);
+            JacobianBuffer buffer;
+            EventSystem<Impl>::notifyStatementStoreOnTapeListeners(
+                cast(), this->manualPushLhsIdentifier, this->manualPushLhsValue, this->manualPushGoal,
+                rhsIdentifiers, jacobiansAsReal(jacobians, this->manualPushGoal, buffer));
+          }
+        }
+
+        if (Config::WideStatements && 0 != wideStatementPushesLeft) CODI_Unlikely {
+          wideStatementPushesLeft -= 1;
+          if (0 == wideStatementPushesLeft) {
+            pushWideStatementSize(wideStatementSize);
           }
         }
       }
 
       /// \copydoc codi::ManualStatementPushTapeInterface::storeManual()
-      void storeManual(Real const& lhsValue, ActiveTypeTapeData& lhsData, Config::ArgumentSize const& size) {
+      void storeManual(Real const& lhsValue, ActiveTypeTapeData& lhsData, size_t const& size) {
         CODI_UNUSED(lhsValue);
         Impl& impl = cast();
 
-        codiAssert(size < Config::MaxArgumentSize);
+        codiAssert(size < Config::MaxArgumentSize || isValidWideStatementSize(size));
 
         statementData.reserveItems(1);
-        jacobianData.reserveItems(size);
 
-        indexManager.get().template assignIndex<Impl>(lhsData);
-        impl.pushStmtData(indexManager.get().getIndex(lhsData), (Config::ArgumentSize)size);
+        if (Config::WideStatements && Config::StatementInputTag < size) CODI_Unlikely {
+          jacobianData.reserveItems(size + 2);
+
+          indexManager.get().template assignIndex<Impl>(lhsData);
+          impl.pushStmtData(indexManager.get().getIndex(lhsData), Config::StatementWideTag);
+          pushWideStatementSize(size);
+
+          wideStatementSize = size;
+          wideStatementPushesLeft = size;
+        } else CODI_Likely {
+          jacobianData.reserveItems(size);
+
+          indexManager.get().template assignIndex<Impl>(lhsData);
+          impl.pushStmtData(indexManager.get().getIndex(lhsData), (Config::ArgumentSize)size);
+        }
 
         impl.initializeManualPushData(lhsValue, indexManager.get().getIndex(lhsData), size);
       }
@@ -922,10 +1114,10 @@ namespace codi {
       /// @{
 
       /// \copydoc codi::ReadWriteTapeInterface::createStatementManual(codi::ReadWriteTapeInterface::Real const&,
-      /// codi::ReadWriteTapeInterface::Identifier&, codi::Config::ArgumentSize const&,
+      /// codi::ReadWriteTapeInterface::Identifier&, size_t const&,
       /// codi::ReadWriteTapeInterface::Real const*, codi::ReadWriteTapeInterface::Identifier const*)
-      void createStatementManual(Real const& lhsValue, Identifier& lhsIndex, Config::ArgumentSize const& size,
-                                 Real const* jacobians, Identifier const* rhsIdentifiers) {
+      void createStatementManual(Real const& lhsValue, Identifier& lhsIndex, size_t const& size, Real const* jacobians,
+                                 Identifier const* rhsIdentifiers) {
         CODI_UNUSED(lhsValue);
         Impl& impl = cast();
 
@@ -934,14 +1126,28 @@ namespace codi {
         if (Config::StatementInputTag == size && TapeTypes::IsLinearIndexHandler) CODI_Unlikely {
           impl.pushStmtData(lhsIndex, (Config::ArgumentSize)size);
         } else CODI_Likely {
-          jacobianData.reserveItems(size);
-          impl.pushStmtData(lhsIndex, (Config::ArgumentSize)size);
+          bool const wide = Config::WideStatements && Config::StatementInputTag < size;
+          codiAssert(size < Config::MaxArgumentSize || Config::StatementInputTag == size ||
+                     isValidWideStatementSize(size));
+
+          if (wide) CODI_Unlikely {
+            jacobianData.reserveItems(size + 2);
+            impl.pushStmtData(lhsIndex, Config::StatementWideTag);
+            pushWideStatementSize(size);
+          } else CODI_Likely {
+            jacobianData.reserveItems(size);
+            impl.pushStmtData(lhsIndex, (Config::ArgumentSize)size);
+          }
           impl.initializeManualPushData(lhsValue, lhsIndex, size);
           // Record the rhs of the statement.
           for (size_t rhsCount = 0; rhsCount < size; rhsCount++) {
             cast().incrementManualPushCounter();
             jacobianData.pushData(jacobians[rhsCount], rhsIdentifiers[rhsCount]);
           }
+
+          if (wide) CODI_Unlikely {
+            pushWideStatementSize(size);
+          }
         }
       }
 
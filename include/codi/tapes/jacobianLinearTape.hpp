@@ -75,6 +75,7 @@ namespace codi {
       using IndexManager = typename TapeTypes::IndexManager;              ///< See TapeTypesInterface.
       using Identifier = typename TapeTypes::Identifier;                  ///< See TapeTypesInterface.
       using ActiveTypeTapeData = typename TapeTypes::ActiveTypeTapeData;  ///< See TapeTypesInterface.
+      using JacobianReal = typename TapeTypes::JacobianReal;              ///< See JacobianTapeTypes.
       using Position = typename Base::Position;                           ///< See TapeTypesInterface.
 
       CODI_STATIC_ASSERT(IndexManager::IsLinear, "This class requires an index manager with a linear scheme.");
@@ -140,7 +141,7 @@ namespace codi {
           size_t& curLLFInfoDataPos, size_t const& endLLFInfoDataPos, Config::LowLevelFunctionToken* const tokenPtr,
           Config::LowLevelFunctionDataSize* const dataSizePtr,
           /* data from jacobian vector */
-          size_t& curJacobianPos, size_t const& endJacobianPos, Real const* const rhsJacobians,
+          size_t& curJacobianPos, size_t const& endJacobianPos, JacobianReal const* const rhsJacobians,
           Identifier const* const rhsIdentifiers,
           /* data from statement vector */
           size_t& curStmtPos, size_t const& endStmtPos, Config::ArgumentSize const* const numberOfJacobians,
@@ -170,7 +171,7 @@ namespace codi {
             adjointVector[curAdjointPos] = lhsAdjoint;
 
             EventSystem<JacobianLinearTape>::notifyStatementEvaluateListeners(
-                tape, curAdjointPos, GradientTraits::dim<Adjoint>(), GradientTraits::toArray(lhsAdjoint).data());
+                tape, curAdjointPos, GradientTraits::dim<Adjoint>(), Base::adjointAsRealArray(lhsAdjoint).data());
           }
 
           curStmtPos += 1;
@@ -188,7 +189,7 @@ namespace codi {
           size_t& curLLFInfoDataPos, size_t const& endLLFInfoDataPos, Config::LowLevelFunctionToken* const tokenPtr,
           Config::LowLevelFunctionDataSize* const dataSizePtr,
           /* data from jacobianData */
-          size_t& curJacobianPos, size_t const& endJacobianPos, Real const* const rhsJacobians,
+          size_t& curJacobianPos, size_t const& endJacobianPos, JacobianReal const* const rhsJacobians,
           Identifier const* const rhsIdentifiers,
           /* data from statementData */
           size_t& curStmtPos, size_t const& endStmtPos, Config::ArgumentSize const* const numberOfJacobians,
@@ -219,7 +220,7 @@ namespace codi {
 
             EventSystem<JacobianLinearTape>::notifyStatementEvaluateListeners(
                 tape, (Identifier)curAdjointPos, GradientTraits::dim<Adjoint>(),
-                GradientTraits::toArray(lhsAdjoint).data());
+                Base::adjointAsRealArray(lhsAdjoint).data());
 
             if (Config::ReversalZeroesAdjoints) {
               adjointVector[curAdjointPos] = Adjoint();
@@ -243,7 +244,7 @@ namespace codi {
           size_t& curLLFInfoDataPos, size_t const& endLLFInfoDataPos, Config::LowLevelFunctionToken* const tokenPtr,
           Config::LowLevelFunctionDataSize* const dataSizePtr,
           /* data from jacobianData */
-          size_t& curJacobianPos, size_t const& endJacobianPos, Real const* const rhsJacobians,
+          size_t& curJacobianPos, size_t const& endJacobianPos, JacobianReal const* const rhsJacobians,
           Identifier const* const rhsIdentifiers,
           /* data from statementData */
           size_t& curStmtPos, size_t const& endStmtPos, Config::ArgumentSize const* const numberOfJacobians,
@@ -266,10 +267,14 @@ namespace codi {
                                           dataView, func);
             writer->writeLowLevelFunction(func, dataView);
           } else if (Config::StatementInputTag == argsSize) CODI_Unlikely {
-            writer->writeStatement(curLhsIdentifier, curJacobianPos, rhsJacobians, rhsIdentifiers, argsSize);
+            Base::writeJacobianStatement(writer, curLhsIdentifier, curJacobianPos, rhsJacobians, rhsIdentifiers,
+                                         argsSize);
           } else CODI_Likely {
-            writer->writeStatement(curLhsIdentifier, curJacobianPos, rhsJacobians, rhsIdentifiers, argsSize);
-            curJacobianPos += argsSize;
+            size_t const numberOfArguments = Base::beginStatementForward(argsSize, curJacobianPos, rhsIdentifiers);
+            Base::writeJacobianStatement(writer, curLhsIdentifier, curJacobianPos, rhsJacobians, rhsIdentifiers,
+                                         numberOfArguments);
+            curJacobianPos += numberOfArguments;
+            Base::endStatementForward(argsSize, curJacobianPos);
           }
           curStmtPos += 1;
         }
@@ -294,7 +299,7 @@ namespace codi {
                 size_t& curLLFInfoDataPos, size_t const& endLLFInfoDataPos,
                 Config::LowLevelFunctionToken* const tokenPtr, Config::LowLevelFunctionDataSize* const dataSizePtr,
                 /* data from jacobian vector */
-                size_t& curJacobianPos, size_t const& endJacobianPos, Real* const rhsJacobians,
+                size_t& curJacobianPos, size_t const& endJacobianPos, JacobianReal* const rhsJacobians,
                 Identifier* const rhsIdentifiers,
                 /* data from statement vector */
                 size_t& curStmtPos, size_t const& endStmtPos, Config::ArgumentSize const* const numberOfJacobians,
@@ -309,25 +314,27 @@ namespace codi {
               while (curAdjointPos < endAdjointPos) CODI_Likely {
                 curAdjointPos += 1;
 
-                Config::ArgumentSize argsSize = numberOfJacobians[curStmtPos];
+                Config::ArgumentSize const argsSize = numberOfJacobians[curStmtPos];
 
                 if (Config::StatementLowLevelFunctionTag == argsSize) CODI_Unlikely {
                   Base::prepareLowLevelFunction(true, curLLFByteDataPos, dataPtr, curLLFInfoDataPos, tokenPtr,
                                                 dataSizePtr, dataView, func);
                   callbacks.handleLowLevelFunction(*func, dataView);
                 } else CODI_Likely {
-                  if (Config::StatementInputTag == argsSize) CODI_Unlikely {
-                    argsSize = 0;
+                  size_t numberOfArguments = 0;
+                  if (Config::StatementInputTag != argsSize) CODI_Likely {
+                    numberOfArguments = Base::beginStatementForward(argsSize, curJacobianPos, rhsIdentifiers);
                   }
 
                   Identifier lhsIdentifier = curAdjointPos;
-                  callbacks.handleStatement(lhsIdentifier, argsSize, &rhsJacobians[curJacobianPos],
+                  callbacks.handleStatement(lhsIdentifier, numberOfArguments, &rhsJacobians[curJacobianPos],
                                             &rhsIdentifiers[curJacobianPos]);
 
                   codiAssert(lhsIdentifier ==
                              (Identifier)curAdjointPos);  // Lhs identifiers can not be edited in a linear tape.
 
-                  curJacobianPos += argsSize;
+                  curJacobianPos += numberOfArguments;
+                  Base::endStatementForward(argsSize, curJacobianPos);
                 }
 
                 curStmtPos += 1;
@@ -351,7 +358,7 @@ namespace codi {
                 size_t& curLLFInfoDataPos, size_t const& endLLFInfoDataPos,
                 Config::LowLevelFunctionToken* const tokenPtr, Config::LowLevelFunctionDataSize* const dataSizePtr,
                 /* data from jacobian vector */
-                size_t& curJacobianPos, size_t const& endJacobianPos, Real* const rhsJacobians,
+                size_t& curJacobianPos, size_t const& endJacobianPos, JacobianReal* const rhsJacobians,
                 Identifier* const rhsIdentifiers,
                 /* data from statement vector */
                 size_t& curStmtPos, size_t const& endStmtPos, Config::ArgumentSize const* const numberOfJacobians,
@@ -366,25 +373,28 @@ namespace codi {
               while (curAdjointPos > endAdjointPos) CODI_Likely {
                 curStmtPos -= 1;
 
-                Config::ArgumentSize argsSize = numberOfJacobians[curStmtPos];
+                Config::ArgumentSize const argsSize = numberOfJacobians[curStmtPos];
 
                 if (Config::StatementLowLevelFunctionTag == argsSize) CODI_Unlikely {
                   Base::prepareLowLevelFunction(false, curLLFByteDataPos, dataPtr, curLLFInfoDataPos, tokenPtr,
                                                 dataSizePtr, dataView, func);
                   callbacks.handleLowLevelFunction(*func, dataView);
                 } else CODI_Likely {
-                  if (Config::StatementInputTag == argsSize) CODI_Unlikely {
-                    argsSize = 0;
+                  size_t numberOfArguments = 0;
+                  if (Config::StatementInputTag != argsSize) CODI_Likely {
+                    numberOfArguments = Base::beginStatementReverse(argsSize, curJacobianPos, rhsIdentifiers);
                   }
 
-                  curJacobianPos -= argsSize;
+                  curJacobianPos -= numberOfArguments;
 
                   Identifier lhsIdentifier = curAdjointPos;
-                  callbacks.handleStatement(lhsIdentifier, argsSize, &rhsJacobians[curJacobianPos],
+                  callbacks.handleStatement(lhsIdentifier, numberOfArguments, &rhsJacobians[curJacobianPos],
                                             &rhsIdentifiers[curJacobianPos]);
 
                   codiAssert(lhsIdentifier ==
                              (Identifier)curAdjointPos);  // Lhs identifiers can not be edited in a linear tape.
+
+                  Base::endStatementReverse(argsSize, curJacobianPos);
                 }
 
                 curAdjointPos -= 1;
@@ -79,6 +79,7 @@ namespace codi {
       using IndexManager = typename TapeTypes::IndexManager;              ///< See TapeTypesInterface.
       using Identifier = typename TapeTypes::Identifier;                  ///< See TapeTypesInterface.
       using ActiveTypeTapeData = typename TapeTypes::ActiveTypeTapeData;  ///< See TapeTypesInterface.
+      using JacobianReal = typename TapeTypes::JacobianReal;              ///< See JacobianTapeTypes.
       using Position = typename Base::Position;                           ///< See TapeTypesInterface.
       using StatementData = typename TapeTypes::StatementData;            ///< See JacobianTapeTypes.
 
@@ -161,7 +162,7 @@ namespace codi {
           size_t& curLLFInfoDataPos, size_t const& endLLFInfoDataPos, Config::LowLevelFunctionToken* const tokenPtr,
           Config::LowLevelFunctionDataSize* const dataSizePtr,
           /* data from jacobian vector */
-          size_t& curJacobianPos, size_t const& endJacobianPos, Real const* const rhsJacobians,
+          size_t& curJacobianPos, size_t const& endJacobianPos, JacobianReal const* const rhsJacobians,
           Identifier const* const rhsIdentifiers,
           /* data from statement vector */
           size_t& curStmtPos, size_t const& endStmtPos, Identifier const* const lhsIdentifiers,
@@ -187,7 +188,7 @@ namespace codi {
 
             EventSystem<JacobianReuseTape>::notifyStatementEvaluateListeners(
                 tape, lhsIdentifiers[curStmtPos], GradientTraits::dim<Adjoint>(),
-                GradientTraits::toArray(lhsAdjoint).data());
+                Base::adjointAsRealArray(lhsAdjoint).data());
           }
 
           curStmtPos += 1;
@@ -205,7 +206,7 @@ namespace codi {
           size_t& curLLFInfoDataPos, size_t const& endLLFInfoDataPos, Config::LowLevelFunctionToken* const tokenPtr,
           Config::LowLevelFunctionDataSize* const dataSizePtr,
           /* data from jacobianData */
-          size_t& curJacobianPos, size_t const& endJacobianPos, Real const* const rhsJacobians,
+          size_t& curJacobianPos, size_t const& endJacobianPos, JacobianReal const* const rhsJacobians,
           Identifier const* const rhsIdentifiers,
           /* data from statementData */
           size_t& curStmtPos, size_t const& endStmtPos, Identifier const* const lhsIdentifiers,
@@ -229,7 +230,7 @@ namespace codi {
 
             EventSystem<JacobianReuseTape>::notifyStatementEvaluateListeners(
                 tape, lhsIdentifiers[curStmtPos], GradientTraits::dim<Adjoint>(),
-                GradientTraits::toArray(lhsAdjoint).data());
+                Base::adjointAsRealArray(lhsAdjoint).data());
 
             adjointVector[lhsIdentifiers[curStmtPos]] = Adjoint();
             Base::incrementAdjoints(adjointVector, lhsAdjoint, argsSize, curJacobianPos, rhsJacobians, rhsIdentifiers);
@@ -248,7 +249,7 @@ namespace codi {
           size_t& curLLFInfoDataPos, size_t const& endLLFInfoDataPos, Config::LowLevelFunctionToken* const tokenPtr,
           Config::LowLevelFunctionDataSize* const dataSizePtr,
           /* data from jacobianData */
-          size_t& curJacobianPos, size_t const& endJacobianPos, Real const* const rhsJacobians,
+          size_t& curJacobianPos, size_t const& endJacobianPos, JacobianReal const* const rhsJacobians,
           Identifier const* const rhsIdentifiers,
           /* data from statementData */
           size_t& curStmtPos, size_t const& endStmtPos, Identifier const* const lhsIdentifiers,
@@ -268,9 +269,12 @@ namespace codi {
                                           dataView, func);
             writer->writeLowLevelFunction(func, dataView);
           } else CODI_Likely {
-            writer->writeStatement(curLhsIdentifier, curJacobianPos, rhsJacobians, rhsIdentifiers,
-                                   curNumberOfJacobians);
-            curJacobianPos += numberOfJacobians[curStmtPos];
+            size_t const numberOfArguments =
+                Base::beginStatementForward(curNumberOfJacobians, curJacobianPos, rhsIdentifiers);
+            Base::writeJacobianStatement(writer, curLhsIdentifier, curJacobianPos, rhsJacobians, rhsIdentifiers,
+                                         numberOfArguments);
+            curJacobianPos += numberOfArguments;
+            Base::endStatementForward(curNumberOfJacobians, curJacobianPos);
           }
           curStmtPos += 1;
         }
@@ -297,7 +301,7 @@ namespace codi {
                             Config::LowLevelFunctionToken* const tokenPtr,
                             Config::LowLevelFunctionDataSize* const dataSizePtr,
                             /* data from jacobian vector */
-                            size_t& curJacobianPos, size_t const& endJacobianPos, Real* const rhsJacobians,
+                            size_t& curJacobianPos, size_t const& endJacobianPos, JacobianReal* const rhsJacobians,
                             Identifier* const rhsIdentifiers,
                             /* data from statement vector */
                             size_t& curStmtPos, size_t const& endStmtPos, Identifier* const lhsIdentifiers,
@@ -315,10 +319,12 @@ namespace codi {
                                             dataView, func);
               callbacks.handleLowLevelFunction(*func, dataView);
             } else CODI_Likely {
-              callbacks.handleStatement(lhsIdentifiers[curStmtPos], argsSize, &rhsJacobians[curJacobianPos],
+              size_t const numberOfArguments = Base::beginStatementForward(argsSize, curJacobianPos, rhsIdentifiers);
+              callbacks.handleStatement(lhsIdentifiers[curStmtPos], numberOfArguments, &rhsJacobians[curJacobianPos],
                                         &rhsIdentifiers[curJacobianPos]);
 
-              curJacobianPos += argsSize;
+              curJacobianPos += numberOfArguments;
+              Base::endStatementForward(argsSize, curJacobianPos);
             }
 
             curStmtPos += 1;
@@ -342,7 +348,7 @@ namespace codi {
                             Config::LowLevelFunctionToken* const tokenPtr,
                             Config::LowLevelFunctionDataSize* const dataSizePtr,
                             /* data from jacobian vector */
-                            size_t& curJacobianPos, size_t const& endJacobianPos, Real* const rhsJacobians,
+                            size_t& curJacobianPos, size_t const& endJacobianPos, JacobianReal* const rhsJacobians,
                             Identifier* const rhsIdentifiers,
                             /* data from statement vector */
                             size_t& curStmtPos, size_t const& endStmtPos, Identifier* const lhsIdentifiers,
@@ -362,10 +368,13 @@ namespace codi {
                                             dataView, func);
               callbacks.handleLowLevelFunction(*func, dataView);
             } else CODI_Likely {
-              curJacobianPos -= argsSize;
+              size_t const numberOfArguments = Base::beginStatementReverse(argsSize, curJacobianPos, rhsIdentifiers);
+              curJacobianPos -= numberOfArguments;
 
-              callbacks.handleStatement(lhsIdentifiers[curStmtPos], argsSize, &rhsJacobians[curJacobianPos],
+              callbacks.handleStatement(lhsIdentifiers[curStmtPos], numberOfArguments, &rhsJacobians[curJacobianPos],
                                         &rhsIdentifiers[curJacobianPos]);
+
+              Base::endStatementReverse(argsSize, curJacobianPos);
             }
           }
         };
@@ -424,7 +433,8 @@ namespace codi {
                             size_t&, size_t const&, Config::LowLevelFunctionToken* const,
                             Config::LowLevelFunctionDataSize* const,
                             /* data from jacobianData */
-                            size_t& curJacobianPos, size_t const&, Real const* const, Identifier* const rhsIdentifiers,
+                            size_t& curJacobianPos, size_t const&, JacobianReal const* const,
+                            Identifier* const rhsIdentifiers,
                             /* data from statementData */
                             size_t& curStmtPos, size_t const& endStmtPos, Identifier* const lhsIdentifiers,
                             Config::ArgumentSize const* const numberOfJacobians) {
@@ -434,11 +444,13 @@ namespace codi {
             if (Config::StatementLowLevelFunctionTag != argsSize) CODI_Likely {  // skip low-level functions
               modifyIdentifier(lhsIdentifiers[curStmtPos]);
 
-              size_t endJacobianPos = curJacobianPos + argsSize;
+              size_t const numberOfArguments = Base::beginStatementForward(argsSize, curJacobianPos, rhsIdentifiers);
+              size_t endJacobianPos = curJacobianPos + numberOfArguments;
               while (curJacobianPos < endJacobianPos) CODI_Likely {
                 modifyIdentifier(rhsIdentifiers[curJacobianPos]);
                 curJacobianPos += 1;
               }
+              Base::endStatementForward(argsSize, curJacobianPos);
             }
 
             curStmtPos += 1;
@@ -461,7 +473,7 @@ namespace codi {
           size_t& curLLFInfoDataPos, size_t const& endLLFInfoDataPos, Config::LowLevelFunctionToken* const tokenPtr,
           Config::LowLevelFunctionDataSize* const dataSizePtr,
           /* data from jacobianData */
-          size_t& curJacobianPos, size_t const& endJacobianPos, Real const* const rhsJacobians,
+          size_t& curJacobianPos, size_t const& endJacobianPos, JacobianReal const* const rhsJacobians,
           Identifier const* const rhsIdentifiers,
           /* data from statementData */
           size_t& curStmtPos, size_t const& endStmtPos, Identifier const* const lhsIdentifiers,
@@ -484,12 +496,16 @@ namespace codi {
             curLLFInfoDataPos += 1;
             curLLFByteDataPos += dataSize;
           } else CODI_Likely {
-            // Manual statement push.
+            // Manual statement push. The leading and trailing entries of wide statements are copied, too.
+            size_t curJacobianEnd = curJacobianPos + argsSize;
+            if (Config::WideStatements && Config::StatementWideTag == argsSize) CODI_Unlikely {
+              curJacobianEnd = curJacobianPos + (size_t)rhsIdentifiers[curJacobianPos] + 2;
+            }
+
             dstTape->statementData.reserveItems(1);
-            dstTape->jacobianData.reserveItems(numberOfJacobians[curStmtPos]);
+            dstTape->jacobianData.reserveItems(curJacobianEnd - curJacobianPos);
 
-            dstTape->pushStmtData(lhsIdentifiers[curStmtPos], numberOfJacobians[curStmtPos]);
-            size_t curJacobianEnd = curJacobianPos + numberOfJacobians[curStmtPos];
+            dstTape->pushStmtData(lhsIdentifiers[curStmtPos], argsSize);
 
             while (curJacobianPos < curJacobianEnd) {
               dstTape->jacobianData.pushData(rhsJacobians[curJacobianPos], rhsIdentifiers[curJacobianPos]);
@@ -0,0 +1,196 @@
+/*
+ * CoDiPack, a Code Differentiation Package
+ *
+ * Copyright (C) 2015-2026 Chair for Scientific Computing (SciComp), RPTU University Kaiserslautern-Landau
+ * Homepage: http://scicomp.rptu.de
+ * Contact:  Prof. Nicolas R. Gauger (codi@scicomp.uni-kl.de)
+ *
+ * Lead developers: Max Sagebaum, Johannes Blühdorn (SciComp, RPTU University Kaiserslautern-Landau)
+ *
+ * This file is part of CoDiPack (http://scicomp.rptu.de/software/codi).
+ *
+ * CoDiPack is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * CoDiPack is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * See the GNU General Public License for more details.
+ * You should have received a copy of the GNU
+ * General Public License along with CoDiPack.
+ * If not, see <http://www.gnu.org/licenses/>.
+ *
+ * For other licensing options please contact us.
+ *
+ * Authors:
+ *  - SciComp, RPTU University Kaiserslautern-Landau:
+ *    - Max Sagebaum
+ *    - Johannes Blühdorn
+ *    - Former members:
+ *      - Tim Albring
+ */
+#pragma once
+
+#include <cstring>
+#include <memory>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "../../config.h"
+#include "../../misc/macros.hpp"
+#include "tapeValues.hpp"
+
+/** \copydoc codi::Namespace */
+namespace codi {
+
+  /**
+   * @brief Deduplicated storage for the constant values of primal value tape statements.
+   *
+   * Each statement stores the constant values of its expression as one tuple. Equal tuples are stored only once and
+   * the statement data holds a pointer to the pooled tuple instead of the values, see Config::PrimalConstantPool.
+   *
+   * Tuples are compared bytewise. The pool is organized in blocks which are never reallocated, therefore the returned
+   * pointers stay valid until reset() or resetHard() is called.
+   *
+   * @tparam T_Real  The storage type of the constant values, usually the passive real of a tape.
+   */
+  template<typename T_Real>
+  struct ConstantValuePool {
+    public:
+
+      using Real = CODI_DD(T_Real, double);  ///< See ConstantValuePool.
+
+      static size_t constexpr BlockSize = 16384;  ///< Number of values in one block.
+
+    private:
+
+      using Block = std::unique_ptr<Real[]>;
+      using Entry = std::pair<Real*, size_t>;
+
+      std::vector<Block> blocks;
+      size_t usedBlocks;
+      size_t curBlockUsed;
+
+      std::unordered_multimap<size_t, Entry> lookup;
+
+      size_t pooledTuples;
+      size_t storedValues;
+      size_t savedBytes;
+
+    public:
+
+      /// Constructor
+      ConstantValuePool() : blocks(), usedBlocks(0), curBlockUsed(0), lookup(), pooledTuples(0),
+                            storedValues(0), savedBytes(0) {}
+
+      /**
+       * @brief Returns the pooled copy of the values.
+       *
+       * @param values  The tuple of constant values.
+       * @param size  The number of values in the tuple.
+       * @param slotSize  The number of bytes the statement data uses for the reference to the tuple.
+       */
+      CODI_INLINE Real* intern(Real const* values, size_t size, size_t slotSize) {
+        codiAssert(size <= BlockSize);
+
+        pooledTuples += 1;
+        savedBytes += sizeof(Real) * size - slotSize;
+
+        size_t hash = computeHash(values, size);
+        auto range = lookup.equal_range(hash);
+        for (auto iter = range.first; iter != range.second; ++iter) {
+          Entry const& entry = iter->second;
+          if (entry.second == size && 0 == std::memcmp(entry.first, values, sizeof(Real) * size)) {
+            return entry.first;
+          }
+        }
+
+        Real* pooled = allocate(size);
+        std::memcpy(pooled, values, sizeof(Real) * size);
+        lookup.emplace(hash, Entry(pooled, size));
+        storedValues += size;
+
+        return pooled;
+      }
+
+      /// Number of tuples that have been requested from the pool.
+      size_t getPooledTuples() const {
+        return pooledTuples;
+      }
+
+      /// Removes all tuples. The blocks are kept for the next recording.
+      void reset() {
+        lookup.clear();
+        usedBlocks = 0;
+        curBlockUsed = 0;
+        pooledTuples = 0;
+        storedValues = 0;
+        savedBytes = 0;
+      }
+
+      /// Removes all tuples and frees the blocks.
+      void resetHard() {
+        blocks.clear();
+        reset();
+      }
+
+      /// Swap the contents with the other pool.
+      void swap(ConstantValuePool& other) {
+        std::swap(blocks, other.blocks);
+        std::swap(usedBlocks, other.usedBlocks);
+        std::swap(curBlockUsed, other.curBlockUsed);
+        std::swap(lookup, other.lookup);
+        std::swap(pooledTuples, other.pooledTuples);
+        std::swap(storedValues, other.storedValues);
+        std::swap(savedBytes, other.savedBytes);
+      }
+
+      /// Adds: Pooled statements, Pooled values, Memory saved, Memory saved per statement, Memory used,
+      /// Memory allocated
+      void addToTapeValues(TapeValues& values) const {
+        double memoryUsed = (double)storedValues * (double)sizeof(Real);
+        double memoryAlloc = (double)blocks.size() * (double)BlockSize * (double)sizeof(Real);
+        double savedPerStatement = 0 == pooledTuples ? 0.0 : (double)savedBytes / (double)pooledTuples;
+
+        values.addUnsignedLongEntry("Pooled statements", pooledTuples);
+        values.addUnsignedLongEntry("Pooled values", storedValues);
+        values.addDoubleEntry("Memory saved", (double)savedBytes);
+        values.addDoubleEntry("Memory saved per statement", savedPerStatement,
+                              TapeValues::LocalReductionOperation::Max);
+        values.addDoubleEntry("Memory used", memoryUsed, TapeValues::LocalReductionOperation::Sum, true, false);
+        values.addDoubleEntry("Memory allocated", memoryAlloc, TapeValues::LocalReductionOperation::Sum, false, true);
+      }
+
+    private:
+
+      CODI_INLINE static size_t computeHash(Real const* values, size_t size) {
+        // FNV-1a over the bytes of the tuple.
+        unsigned char const* bytes = reinterpret_cast<unsigned char const*>(values);
+        size_t hash = (size_t)14695981039346656037ULL ^ size;
+        for (size_t i = 0; i < sizeof(Real) * size; i += 1) {
+          hash = (hash ^ bytes[i]) * (size_t)1099511628211ULL;
+        }
+
+        return hash;
+      }
+
+      CODI_INLINE Real* allocate(size_t size) {
+        if (0 == usedBlocks || curBlockUsed + size > BlockSize) {
+          if (usedBlocks == blocks.size()) {
+            blocks.push_back(Block(new Real[BlockSize]));
+          }
+          usedBlocks += 1;
+          curBlockUsed = 0;
+        }
+
+        Real* data = &blocks[usedBlocks - 1][curBlockUsed];
+        curBlockUsed += size;
+
+        return data;
+      }
+  };
+}
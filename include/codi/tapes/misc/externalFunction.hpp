@@ -189,6 +189,11 @@ namespace codi {
         }
       }
 
+      /// True if functions for the iteration of inputs and outputs are provided.
+      bool hasIterateFunctions() const {
+        return nullptr != funcIterIn && nullptr != funcIterOut;
+      }
+
       /// Calls the iterate inputs function if not nullptr, otherwise throws a CODI_EXCEPTION.
       void iterateInputs(Tape* tape, IterCallback func, void* userData) const {
         if (nullptr != funcIterIn) {
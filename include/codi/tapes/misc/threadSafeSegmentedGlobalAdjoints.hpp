@@ -0,0 +1,258 @@
+/*
+ * CoDiPack, a Code Differentiation Package
+ *
+ * Copyright (C) 2015-2026 Chair for Scientific Computing (SciComp), RPTU University Kaiserslautern-Landau
+ * Homepage: http://scicomp.rptu.de
+ * Contact:  Prof. Nicolas R. Gauger (codi@scicomp.uni-kl.de)
+ *
+ * Lead developers: Max Sagebaum, Johannes Blühdorn (SciComp, RPTU University Kaiserslautern-Landau)
+ *
+ * This file is part of CoDiPack (http://scicomp.rptu.de/software/codi).
+ *
+ * CoDiPack is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * CoDiPack is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * See the GNU General Public License for more details.
+ * You should have received a copy of the GNU
+ * General Public License along with CoDiPack.
+ * If not, see <http://www.gnu.org/licenses/>.
+ *
+ * For other licensing options please contact us.
+ *
+ * Authors:
+ *  - SciComp, RPTU University Kaiserslautern-Landau:
+ *    - Max Sagebaum
+ *    - Johannes Blühdorn
+ *    - Former members:
+ *      - Tim Albring
+ */
+#pragma once
+
+#include <algorithm>
+#include <array>
+
+#include "../../misc/mathUtility.hpp"
+#include "../../tools/parallel/parallelToolbox.hpp"
+#include "../../traits/adjointVectorTraits.hpp"
+#include "internalAdjointsInterface.hpp"
+
+/** \copydoc codi::Namespace */
+namespace codi {
+
+  /**
+   * @brief Provides global adjoint variables owned by a tape type. Thread-safe for use in parallel taping, without
+   *        locking for adjoint access.
+   *
+   * Same purpose as ThreadSafeGlobalAdjoints, but the adjoint variables are stored in a segmented array instead of a
+   * single contiguous vector. A growth of the adjoint variables appends new segments and never moves existing ones.
+   * Therefore, addresses of adjoint variables are stable and readers do not have to be excluded from reallocations.
+   * beginUse() and endUse() are no-ops and concurrent evaluations and registrations do not contend for a lock. Only
+   * resize() calls are serialized among each other.
+   *
+   * Segment 0 holds the identifiers [0, FirstSegmentSize), segment k > 0 holds the identifiers
+   * [FirstSegmentSize * 2^(k - 1), FirstSegmentSize * 2^k). The capacity doubles with each segment, so the number of
+   * segments stays small and the segment of an identifier is computed from its highest set bit.
+   *
+   * The price for the lock-free access is one additional indirection per adjoint access. data() does not return a
+   * pointer but a light-weight accessor object, see SegmentAccess.
+   *
+   * Shrinking the adjoint variables, e.g., via DataManagementTapeInterface::deleteAdjointVector, releases segments.
+   * Since shrinking cannot be guarded against concurrent use, no other thread may access the adjoint variables at this
+   * point. This implementation cannot be used with CoDiOpDiLibTool, which requires a contiguous adjoint vector.
+   *
+   * @tparam T_Gradient         The gradient type of a tape, usually chosen as ActiveType::Gradient.
+   * @tparam T_Identifier       The adjoint/tangent identification of a tape, usually chosen as ActiveType::Identifier.
+   * @tparam T_Tape             The associated tape type.
+   * @tparam T_ParallelToolbox  The parallel toolbox used in the associated tape. See codi::ParallelToolbox.
+   */
+  template<typename T_Gradient, typename T_Identifier, typename T_Tape, typename T_ParallelToolbox>
+  struct ThreadSafeSegmentedGlobalAdjoints : public InternalAdjointsInterface<T_Gradient, T_Identifier, T_Tape> {
+    public:
+
+      /// See ThreadSafeSegmentedGlobalAdjoints.
+      using Tape = CODI_DD(T_Tape, CODI_DEFAULT_TAPE);
+      using Gradient = CODI_DD(T_Gradient, double);   ///< See ThreadSafeSegmentedGlobalAdjoints.
+      using Identifier = CODI_DD(T_Identifier, int);  ///< See ThreadSafeSegmentedGlobalAdjoints.
+      /// See ThreadSafeSegmentedGlobalAdjoints.
+      using ParallelToolbox = CODI_DD(T_ParallelToolbox, CODI_DEFAULT_PARALLEL_TOOLBOX);
+
+      using ReadWriteMutex = typename ParallelToolbox::ReadWriteMutex;       ///< See ParallelToolbox.
+      using LockForRealloc = typename ParallelToolbox::LockForWrite;         ///< See ParallelToolbox.
+      using AtomicSize = typename ParallelToolbox::template Atomic<size_t>;  ///< See ParallelToolbox.
+
+      static size_t constexpr FirstSegmentSizeLog2 = 16;                             ///< Log2 of the first segment.
+      static size_t constexpr FirstSegmentSize = size_t(1) << FirstSegmentSizeLog2;  ///< Size of the first segment.
+      /// Maximum number of segments, sufficient to cover the full range of size_t.
+      static size_t constexpr MaxSegments = sizeof(size_t) * 8 - FirstSegmentSizeLog2 + 1;
+
+      /// Array-like access to the segmented adjoint variables. Returned by data().
+      struct SegmentAccess {
+        public:
+          using value_type = Gradient;  ///< See AdjointVectorTraits::GradientImplementation.
+
+          /// Reference access to the adjoint variable identified by identifier.
+          CODI_INLINE Gradient& operator[](Identifier const& identifier) const {
+            return ThreadSafeSegmentedGlobalAdjoints::access(identifier);
+          }
+      };
+
+    private:
+
+      /// Segment pointers. Constant initialized, releases the segments at program exit.
+      struct SegmentTable {
+        public:
+          std::array<Gradient*, MaxSegments> segments;  ///< Pointers to the segments, unused ones are nullptr.
+          size_t numberOfSegments;                      ///< Number of allocated segments.
+
+          /// Constructor
+          constexpr SegmentTable() : segments(), numberOfSegments(0) {}
+
+          /// Destructor
+          ~SegmentTable() {
+            for (size_t segment = 0; segment < numberOfSegments; segment += 1) {
+              delete[] segments[segment];
+            }
+          }
+      };
+
+      static SegmentTable table;  ///< Segmented storage of the adjoint variables.
+
+      static AtomicSize capacity;  ///< Number of adjoint variables covered by the allocated segments.
+
+      /// @brief Protects the segment table.
+      /// Only the write lock is used. It serializes reallocations, readers do not lock.
+      static ReadWriteMutex segmentsMutex;
+
+    public:
+
+      /// Constructor
+      ThreadSafeSegmentedGlobalAdjoints(size_t initialSize)
+          : InternalAdjointsInterface<Gradient, Identifier, Tape>(initialSize) {
+        if (size() < initialSize) {
+          resize((Identifier)initialSize);
+        }
+      }
+
+      /// \copydoc InternalAdjointsInterface::operator[](Identifier const&) <br><br>
+      /// Implementation: No locking is performed or required.
+      CODI_INLINE Gradient& operator[](Identifier const& identifier) {
+        return access(identifier);
+      }
+
+      /// \copydoc InternalAdjointsInterface::operator[](Identifier const&) const <br><br>
+      /// Implementation: No locking is performed or required.
+      CODI_INLINE Gradient const& operator[](Identifier const& identifier) const {
+        return access(identifier);
+      }
+
+      /// \copydoc InternalAdjointsInterface::data <br><br>
+      /// Implementation: Returns an accessor object, see SegmentAccess.
+      CODI_INLINE SegmentAccess data() {
+        return SegmentAccess();
+      }
+
+      /// \copydoc InternalAdjointsInterface::size
+      CODI_INLINE size_t size() const {
+        return capacity;
+      }
+
+      /// \copydoc InternalAdjointsInterface::resize <br><br>
+      /// Implementation: Appends or releases segments. Segment 0 is never released.
+      CODI_NO_INLINE void resize(Identifier const& newSize) {
+        LockForRealloc lock(segmentsMutex);
+
+        size_t lastPos = 0 == (size_t)newSize ? 0 : (size_t)newSize - 1;
+        size_t targetSegments = getBitWidth(lastPos >> FirstSegmentSizeLog2) + 1;
+
+        while (table.numberOfSegments < targetSegments) {
+          table.segments[table.numberOfSegments] = new Gradient[segmentSize(table.numberOfSegments)]();
+          table.numberOfSegments += 1;
+        }
+
+        while (table.numberOfSegments > targetSegments) {
+          table.numberOfSegments -= 1;
+          delete[] table.segments[table.numberOfSegments];
+          table.segments[table.numberOfSegments] = nullptr;
+        }
+
+        capacity = segmentStart(table.numberOfSegments);
+      }
+
+      /// \copydoc InternalAdjointsInterface::zeroAll
+      CODI_INLINE void zeroAll(Identifier const& maxIdentifier) {
+        size_t end = std::min((size_t)maxIdentifier + 1, size());
+
+        for (size_t segment = 0; segmentStart(segment) < end; segment += 1) {
+          Gradient* segmentData = table.segments[segment];
+          size_t segmentEnd = std::min(segmentSize(segment), end - segmentStart(segment));
+          for (size_t i = 0; i < segmentEnd; i += 1) {
+            segmentData[i] = Gradient();
+          }
+        }
+      }
+
+      /// \copydoc InternalAdjointsInterface::swap
+      CODI_INLINE void swap(ThreadSafeSegmentedGlobalAdjoints&) {
+        /* Adjoints in this implementation are a static global member. Therefore, there is no need to swap them. */
+      }
+
+      /// \copydoc InternalAdjointsInterface::beginUse <br><br>
+      /// Implementation: Empty, segments are never moved.
+      CODI_INLINE void beginUse() {}
+
+      /// \copydoc InternalAdjointsInterface::endUse <br><br>
+      /// Implementation: Empty, segments are never moved.
+      CODI_INLINE void endUse() {}
+
+    private:
+
+      /// First identifier stored in the given segment. Equals the capacity of all segments before it.
+      static CODI_INLINE size_t segmentStart(size_t segment) {
+        return 0 == segment ? 0 : FirstSegmentSize << (segment - 1);
+      }
+
+      /// Number of identifiers stored in the given segment.
+      static CODI_INLINE size_t segmentSize(size_t segment) {
+        return 0 == segment ? FirstSegmentSize : FirstSegmentSize << (segment - 1);
+      }
+
+      /// Segment lookup for an identifier.
+      static CODI_INLINE Gradient& access(Identifier const& identifier) {
+        size_t pos = (size_t)identifier;
+        size_t segment = getBitWidth(pos >> FirstSegmentSizeLog2);
+
+        return table.segments[segment][pos - segmentStart(segment)];
+      }
+  };
+
+  template<typename Gradient, typename Identifier, typename Tape, typename ParallelToolbox>
+  typename ThreadSafeSegmentedGlobalAdjoints<Gradient, Identifier, Tape, ParallelToolbox>::SegmentTable
+      ThreadSafeSegmentedGlobalAdjoints<Gradient, Identifier, Tape, ParallelToolbox>::table;
+
+  template<typename Gradient, typename Identifier, typename Tape, typename ParallelToolbox>
+  typename ThreadSafeSegmentedGlobalAdjoints<Gradient, Identifier, Tape, ParallelToolbox>::AtomicSize
+      ThreadSafeSegmentedGlobalAdjoints<Gradient, Identifier, Tape, ParallelToolbox>::capacity(0);
+
+  template<typename Gradient, typename Identifier, typename Tape, typename ParallelToolbox>
+  typename CODI_DD(ParallelToolbox, CODI_DEFAULT_PARALLEL_TOOLBOX)::ReadWriteMutex
+      ThreadSafeSegmentedGlobalAdjoints<Gradient, Identifier, Tape, ParallelToolbox>::segmentsMutex;
+
+#ifndef DOXYGEN_DISABLE
+
+  /// Specialization of AdjointVectorTraits.
+  namespace AdjointVectorTraits {
+    template<typename T_Gradient, typename T_Identifier, typename T_Tape, typename T_ParallelToolbox>
+    struct GradientImplementation<
+        ThreadSafeSegmentedGlobalAdjoints<T_Gradient, T_Identifier, T_Tape, T_ParallelToolbox>> {
+      public:
+        using Gradient = T_Gradient;
+    };
+  }
+#endif
+}
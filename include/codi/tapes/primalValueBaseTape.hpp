@@ -61,6 +61,7 @@
 #include "data/chunkedData.hpp"
 #include "indices/indexManagerInterface.hpp"
 #include "misc/assignStatement.hpp"
+#include "misc/constantValuePool.hpp"
 #include "misc/primalAdjointVectorAccess.hpp"
 #include "statementEvaluators/statementEvaluatorInterface.hpp"
 #include "statementEvaluators/statementEvaluatorTapeInterface.hpp"
@@ -171,6 +172,7 @@ namespace codi {
           TapeTypes::IsLinearIndexHandler;  ///< See IdentifierInformationTapeInterface.
       static bool constexpr RequiresPrimalRestore =
           !TapeTypes::IsLinearIndexHandler;  ///< See PrimalEvaluationTapeInterface.
+      static bool constexpr SupportsWideStatements = false;  ///< See ManualStatementPushTapeInterface.
 
       /// Used for generating arrays for lhs handling.
       template<typename T>
@@ -189,6 +191,10 @@ namespace codi {
       std::vector<Real> primals;       ///< Current state of primal values in the program.
       std::vector<Real> primalsCopy;   ///< Copy of primal values for AD evaluations.
 
+      ConstantValuePool<PassiveReal> constantPool;  ///< Pooled statement constants, see Config::PrimalConstantPool.
+      std::vector<PassiveReal> constantBuffer;      ///< Constants of the current statement before they are pooled.
+      PassiveReal** constantPoolSlot;               ///< Pool reference in the data of the current statement.
+
       Real* manualPushJacobians;          ///< Stores the pointer to the array for the Jacobian values of a manual
                                           ///< statement push.
       Identifier* manualPushIdentifiers;  ///< Stores the pointer to the array for the Jacobian values of a manual
@@ -237,7 +243,10 @@ namespace codi {
             statementByteData(Config::ByteDataChunkSize),
             adjoints(1),  // Ensure that adjoint[0] exists, see its use in gradient() const.
             primals(0),
-            primalsCopy(0) {
+            primalsCopy(0),
+            constantPool(),
+            constantBuffer(0),
+            constantPoolSlot(nullptr) {
         checkPrimalSize(true);
 
         statementData.setNested(&indexManager.get());
@@ -323,6 +332,12 @@ namespace codi {
             array += 1;
           }
 
+          /// True if the constants are stored in the constant pool. The statement data then holds the pointer to the
+          /// pooled values instead of the values, see Config::PrimalConstantPool.
+          CODI_INLINE static bool constexpr isConstantPooled(size_t constantSize) {
+            return Config::PrimalConstantPool && sizeof(PassiveReal) * constantSize > sizeof(PassiveReal*);
+          }
+
           /// Set all the pointer from the given byte data. The sizes are used to compute the offsets.
           CODI_INLINE void populate(size_t lhsSize, size_t rhsSize, size_t passiveSize, size_t constantSize,
                                     char* byteData) {
@@ -342,8 +357,13 @@ namespace codi {
             oldLhsValues = reinterpret_cast<Real*>(curPos);
             curPos += sizeof(Real) * reserverLhsSize;
 
-            constantValues = reinterpret_cast<PassiveReal*>(curPos);
-            curPos += sizeof(PassiveReal) * constantSize;
+            if (isConstantPooled(constantSize)) {
+              constantValues = *reinterpret_cast<PassiveReal**>(curPos);
+              curPos += sizeof(PassiveReal*);
+            } else {
+              constantValues = reinterpret_cast<PassiveReal*>(curPos);
+              curPos += sizeof(PassiveReal) * constantSize;
+            }
 
             codiAssert(curPos == byteData + computeSize(lhsSize, rhsSize, passiveSize, constantSize));
           }
@@ -353,8 +373,11 @@ namespace codi {
                                                                    size_t constantSize) {
             size_t reserverLhsSize = LinearIndexHandling ? 0 : lhsSize;
 
+            size_t constantBytes =
+                isConstantPooled(constantSize) ? sizeof(PassiveReal*) : sizeof(PassiveReal) * constantSize;
+
             return sizeof(Identifier) * (rhsSize + reserverLhsSize) + sizeof(Real) * (passiveSize + reserverLhsSize) +
-                   sizeof(PassiveReal) * (constantSize);
+                   constantBytes;
           }
       };
 
@@ -381,11 +404,28 @@ namespace codi {
         statementByteData.getDataPointers(byteData);
         statementByteData.addDataSize(byteSize);
 
+        if (StatementDataPointers::isConstantPooled(constantSize)) {
+          // The constants are the last entry. They are recorded into the buffer and pooled by poolConstants.
+          if (constantBuffer.size() < constantSize) {
+            constantBuffer.resize(constantSize);
+          }
+          constantPoolSlot = reinterpret_cast<PassiveReal**>(byteData + byteSize - sizeof(PassiveReal*));
+          *constantPoolSlot = constantBuffer.data();
+        }
+
         pointers.populate(lhsSize, rhsSize, passiveSize, constantSize, byteData);
 
         return byteSize;
       }
 
+      /// Moves the constants of the statement reserved last into the constant pool. Has to be called after the
+      /// constants have been written.
+      CODI_INLINE void poolConstants(size_t constantSize) {
+        if (StatementDataPointers::isConstantPooled(constantSize)) {
+          *constantPoolSlot = constantPool.intern(constantBuffer.data(), constantSize, sizeof(PassiveReal*));
+        }
+      }
+
       /// Reserve all the data for a statement.
       template<typename Lhs, typename Rhs>
       CODI_INLINE Config::LowLevelFunctionDataSize reserveStmtData(size_t activeArguments,
@@ -473,6 +513,7 @@ namespace codi {
 
           size_t passiveArguments = 0;
           pushStatement.eval(rhs.cast(), pointers, passiveArguments);
+          poolConstants(ExpressionTraits::NumberOfConstantTypeArguments<Rhs>::value);
           statementData.pushData((Config::ArgumentSize)passiveArguments,
                                  StatementEvaluator::template createHandle<Impl, Impl, Stmt>(), byteSize);
 
@@ -728,6 +769,8 @@ namespace codi {
           primal = Real();
         }
 
+        constantPool.reset();
+
         Base::reset(resetAdjoints, adjointsManagement);
       }
 
@@ -769,9 +812,37 @@ namespace codi {
         values.addSection("Statement byte entries");
         statementByteData.addToTapeValues(values);
 
+        if (Config::PrimalConstantPool) {
+          values.addSection("Constant pool");
+          constantPool.addToTapeValues(values);
+        }
+
         return values;
       }
 
+      /**
+       * @brief Start of the run of statements with the same handle that ends with the statement at curStatementPos.
+       *
+       * Stencil loops and similar code record long runs of the same expression. The reverse sweep evaluates such a
+       * run with StatementCall::ReverseRun, which inlines the evaluation of the statements into one call. Returns
+       * curStatementPos if the run has only one statement or runs are disabled, see Config::ReverseStatementRuns.
+       */
+      CODI_INLINE static size_t findStatementRunStart(size_t const& curStatementPos, size_t const& endStatementPos,
+                                                      Config::ArgumentSize const* const numberOfPassiveArguments,
+                                                      EvalHandle const* const stmtEvalHandle) {
+        size_t runStartPos = curStatementPos;
+
+        if (Config::ReverseStatementRuns) {
+          EvalHandle const& evalHandle = stmtEvalHandle[curStatementPos];
+          while (runStartPos > endStatementPos && evalHandle == stmtEvalHandle[runStartPos - 1] &&
+                 numberOfPassiveArguments[runStartPos - 1] <= Config::MaxArgumentSize) {
+            runStartPos -= 1;
+          }
+        }
+
+        return runStartPos;
+      }
+
       /******************************************************************************
        * Protected helper function for CustomAdjointVectorEvaluationTapeInterface
        */
@@ -872,12 +943,6 @@ namespace codi {
       /// Internal method for the reverse evaluation of the whole tape.
       template<bool copyPrimal, typename AdjointVector>
       CODI_INLINE void internalEvaluateReverse(Position const& start, Position const& end, AdjointVector&& data) {
-        CODI_STATIC_ASSERT(
-            Config::VariableAdjointInterfaceInPrimalTapes ||
-                CODI_T(std::is_same<typename std::remove_reference<AdjointVector>::type, Gradient*>::value),
-            "Please enable 'CODI_VariableAdjointInterfaceInPrimalTapes' in order"
-            " to use custom adjoint vectors in the primal value tapes.");
-
         Real* primalData = primals.data();
 
         if (copyPrimal) {
@@ -885,6 +950,19 @@ namespace codi {
           primalData = primalsCopy.data();
         }
 
+        internalEvaluateReverseWithPrimals(start, end, primalData, std::forward<AdjointVector>(data));
+      }
+
+      /// Internal method for the reverse evaluation on the given primal vector.
+      template<typename AdjointVector>
+      CODI_INLINE void internalEvaluateReverseWithPrimals(Position const& start, Position const& end, Real* primalData,
+                                                          AdjointVector&& data) {
+        CODI_STATIC_ASSERT(
+            Config::VariableAdjointInterfaceInPrimalTapes ||
+                CODI_T(std::is_same<typename std::remove_reference<AdjointVector>::type, Gradient*>::value),
+            "Please enable 'CODI_VariableAdjointInterfaceInPrimalTapes' in order"
+            " to use custom adjoint vectors in the primal value tapes.");
+
         VectorAccess<AdjointVector> vectorAccess(data, primalData);
 
         ADJOINT_VECTOR_TYPE* dataVector = selectAdjointVector<AdjointVector>(&vectorAccess, data);
@@ -912,6 +990,19 @@ namespace codi {
         internalEvaluateReverse<!TapeTypes::IsLinearIndexHandler>(start, end, std::forward<AdjointVector>(data));
       }
 
+      /// \copydoc codi::CustomAdjointVectorEvaluationTapeInterface::evaluateConcurrent()
+      /// <br> Implementation: Tapes with index reuse copy the primal vector in each call. evaluateWithPrimals() together
+      /// with a PrimalVectorSnapshot avoids this.
+      template<typename AdjointVector>
+      void evaluateConcurrent(Position const& start, Position const& end, AdjointVector&& data) {
+        if (TapeTypes::IsLinearIndexHandler) {
+          evaluateWithPrimals(start, end, primals.data(), std::forward<AdjointVector>(data));
+        } else {
+          std::vector<Real> localPrimals = primals;
+          evaluateWithPrimals(start, end, localPrimals.data(), std::forward<AdjointVector>(data));
+        }
+      }
+
       /// \copydoc codi::CustomAdjointVectorEvaluationTapeInterface::evaluateForward()
       template<typename AdjointVector>
       CODI_INLINE void evaluateForward(Position const& start, Position const& end, AdjointVector&& data) {
@@ -935,6 +1026,7 @@ namespace codi {
 
         std::swap(adjoints, other.adjoints);
         std::swap(primals, other.primals);
+        constantPool.swap(other.constantPool);
 
         Base::swap(other);
 
@@ -943,6 +1035,13 @@ namespace codi {
         other.checkPrimalSize(true);
       }
 
+      /// \copydoc codi::DataManagementTapeInterface::resetHard()
+      void resetHard() {
+        Base::resetHard();
+
+        constantPool.resetHard();
+      }
+
       /// \copydoc codi::DataManagementTapeInterface::deleteAdjointVector()
       void deleteAdjointVector() {
         adjoints.resize(1);
@@ -1095,7 +1194,7 @@ namespace codi {
       }
 
       /// \copydoc codi::ManualStatementPushTapeInterface::storeManual()
-      void storeManual(Real const& lhsValue, ActiveTypeTapeData& lhsData, Config::ArgumentSize const& size) {
+      void storeManual(Real const& lhsValue, ActiveTypeTapeData& lhsData, size_t const& size) {
         CODI_UNUSED(lhsValue);
 
         codiAssert(size < Config::MaxArgumentSize);
@@ -1108,7 +1207,7 @@ namespace codi {
 
         indexManager.get().template assignIndex<Impl>(lhsData);
         Real& primalEntry = primals[indexManager.get().getIndex(lhsData)];
-        statementData.pushData(size, PrimalValueBaseTape::jacobianExpressions[size], byteSize);
+        statementData.pushData((Config::ArgumentSize)size, PrimalValueBaseTape::jacobianExpressions[size], byteSize);
         pushLhsData(indexManager.get().getIndex(lhsData), primalEntry, pointers);
 
         primalEntry = lhsValue;
@@ -1155,6 +1254,7 @@ namespace codi {
           for (size_t constantCount = 0; constantCount < nConstants; constantCount++) {
             pointers.constantValues[constantCount] = rhsConstant[constantCount];
           }
+          poolConstants(nConstants);
 
           statementData.pushData(nPassiveValues, evalHandle, byteSize);
 
@@ -1298,6 +1398,46 @@ namespace codi {
       /// Wrapper helper for improved compiler optimizations.
       CODI_WRAP_FUNCTION(Wrap_internalEvaluatePrimal_EvalStatements, Impl::internalEvaluatePrimal_EvalStatements);
 
+    protected:
+
+      /// Callbacks for iterateRevertedPrimals().
+      template<typename Func>
+      struct RevertedPrimalsCallbacks {
+        public:
+          Impl& tape;     ///< The iterated tape.
+          Func& func;     ///< Called for each reverted primal value.
+          bool complete;  ///< False if a low level function did not provide its outputs.
+
+          /// Forwards the identifier to func.
+          static void callFunc(Identifier* identifier, void* userData) {
+            static_cast<RevertedPrimalsCallbacks*>(userData)->func(*identifier);
+          }
+
+          /// Iterates over the left hand side identifiers of the statement.
+          void handleStatement(EvalHandle const& evalHandle, Config::ArgumentSize const& nPassiveValues,
+                               size_t& linearAdjointPosition, char* stmtData) {
+            StatementEvaluator::template call<StatementCall::IterateOutputs, Impl>(
+                evalHandle, linearAdjointPosition, callFunc, this, nPassiveValues, stmtData);
+          }
+
+          /// Iterates over the outputs of the low level function if it provides them.
+          void handleLowLevelFunction(LowLevelFunctionEntry<Impl, Real, Identifier> const& entry,
+                                      ByteDataView& llfData) {
+            bool hasOutputs = entry.template has<LowLevelFunctionEntryCallKind::IterateOutputs>();
+            if (&entry == &(*Base::lowLevelFunctionLookup)[Base::EXTERNAL_FUNCTION_TOKEN]) {
+              // The entry of external functions always provides the iteration, the functions might not.
+              ByteDataView extView = llfData;
+              hasOutputs = extView.template read<ExternalFunction<Impl>>(1)->hasIterateFunctions();
+            }
+
+            if (hasOutputs) {
+              entry.template call<LowLevelFunctionEntryCallKind::IterateOutputs>(&tape, llfData, callFunc, this);
+            } else {
+              complete = false;
+            }
+          }
+      };
+
     public:
 
       /// @}
@@ -1322,6 +1462,88 @@ namespace codi {
                                                        EventHints::EvaluationKind::Primal, EventHints::Endpoint::End);
       }
 
+      /**
+       * @brief Primal evaluation from start to end followed by a reverse evaluation from end to start.
+       *
+       * betweenSweeps() is called after the primal evaluation. It can read the new primal values of the outputs and
+       * seed their adjoints. The reverse evaluation works directly on the primal vector of the tape, as in
+       * evaluateKeepState. For tapes with index reuse, it restores the overwritten primal values with the data stored
+       * by the primal evaluation, so the primal vector is in the state at start afterwards. This is the state that the
+       * next primal evaluation with changed inputs requires. In contrast to evaluatePrimal followed by evaluate, the
+       * primal vector is not copied and repeated calls do not need revertPrimals. For tapes with linear index
+       * management, the reverse evaluation does not change the primal values.
+       *
+       * @tparam Func  Callable without arguments.
+       */
+      template<typename Func>
+      void evaluatePrimalThenReverse(Position const& start, Position const& end, Func&& betweenSweeps,
+                                     AdjointsManagement adjointsManagement = AdjointsManagement::Automatic) {
+        cast().evaluatePrimal(start, end);
+
+        betweenSweeps();
+
+        if (AdjointsManagement::Automatic == adjointsManagement) {
+          checkAdjointSize(indexManager.get().getLargestCreatedIndex());
+        }
+
+        codiAssert(indexManager.get().getLargestCreatedIndex() < (Identifier)adjoints.size());
+
+        internalEvaluateReverse<false>(end, start, adjoints.data());
+      }
+
+      /// Primal and reverse evaluation of the whole tape. See evaluatePrimalThenReverse(Position const&,
+      /// Position const&, Func&&, AdjointsManagement).
+      template<typename Func>
+      void evaluatePrimalThenReverse(Func&& betweenSweeps,
+                                     AdjointsManagement adjointsManagement = AdjointsManagement::Automatic) {
+        evaluatePrimalThenReverse(cast().getZeroPosition(), cast().getPosition(), std::forward<Func>(betweenSweeps),
+                                  adjointsManagement);
+      }
+
+      /**
+       * @brief Reverse evaluation from start to end that works on the given primal vector.
+       *
+       * The primal vector of the tape is neither read nor modified. primalData has to contain the primal values at
+       * the position start, e.g., a copy of the primal vector of the tape after the recording. For tapes with index
+       * reuse, the evaluation reverts the primal values in primalData to the state at end, see
+       * iterateRevertedPrimals(). The size of the adjoint vector is not checked.
+       *
+       * Since the tape itself is not modified, evaluations with different primal and adjoint vectors can run
+       * concurrently, e.g., one per thread, see evaluateConcurrent().
+       *
+       * @tparam AdjointVector  See CustomAdjointVectorEvaluationTapeInterface::evaluate().
+       */
+      template<typename AdjointVector>
+      void evaluateWithPrimals(Position const& start, Position const& end, Real* primalData, AdjointVector&& data) {
+        typename Base::ConcurrentEvaluationScope scope;
+
+        internalEvaluateReverseWithPrimals(start, end, primalData, std::forward<AdjointVector>(data));
+      }
+
+      /**
+       * @brief Calls func for each identifier whose primal value is reverted by a reverse evaluation from start to
+       * end.
+       *
+       * For tapes with index reuse, these are the left hand sides of the statements and the outputs of the low level
+       * functions. Identifiers can be reported multiple times. Tapes with linear index management do not revert primal
+       * values, func is not called.
+       *
+       * @return False if a low level function in the range does not provide the iteration over its outputs. All
+       *         primal values have to be considered as reverted in this case.
+       *
+       * @tparam Func  Callable with the signature void(Identifier const&).
+       */
+      template<typename Func>
+      bool iterateRevertedPrimals(Position const& start, Position const& end, Func&& func) {
+        RevertedPrimalsCallbacks<Func> callbacks = {cast(), func, true};
+
+        if (!TapeTypes::IsLinearIndexHandler) {
+          cast().iterateForward(callbacks, end, start);
+        }
+
+        return callbacks.complete;
+      }
+
       /// \copydoc codi::PrimalEvaluationTapeInterface::primal(T_Identifier const&)
       Real& primal(Identifier const& identifier) {
         return primals[identifier];
@@ -1831,6 +2053,58 @@ namespace codi {
           }
       };
 
+      /*******************************************************************************/
+      /// ReverseRun implementation
+      template<typename Stmt>
+      struct StatementCallGenerator<StatementCall::ReverseRun, Stmt> {
+        public:
+          /// Evaluation of a single statement.
+          using ReverseGenerator = StatementCallGenerator<StatementCall::Reverse, Stmt>;
+
+          /// Evaluates the statements curStatementPos - 1 down to runStartPos, which all have the handle of Stmt. The
+          /// evaluation of the single statements is inlined.
+          CODI_INLINE static void evaluateInner(Impl& CODI_RESTRICT tape, Gradient* CODI_RESTRICT lhsAdjoints,
+                                                Real* CODI_RESTRICT primalVector,
+                                                ADJOINT_VECTOR_TYPE* CODI_RESTRICT adjointVector,
+                                                size_t& CODI_RESTRICT linearAdjointPos,
+                                                size_t& CODI_RESTRICT curStatementPos, size_t const& runStartPos,
+                                                Config::ArgumentSize const* const numberOfPassiveArguments,
+                                                Config::LowLevelFunctionDataSize const* const stmtByteSize,
+                                                size_t& CODI_RESTRICT curStatementBytePos, char* stmtDataPtr) {
+            while (curStatementPos > runStartPos) {
+              curStatementPos -= 1;
+              curStatementBytePos -= stmtByteSize[curStatementPos];
+
+              ReverseGenerator::evaluate(tape, lhsAdjoints, primalVector, adjointVector, linearAdjointPos,
+                                         numberOfPassiveArguments[curStatementPos], &stmtDataPtr[curStatementBytePos]);
+            }
+          }
+
+          /// \copydoc codi::StatementEvaluatorInnerTapeInterface::StatementCallGenerator::evaluateFull()
+          template<typename Func, typename... Args>
+          CODI_INLINE static void evaluateFull(Func const& evalInner, size_t const& maxOutputArgs,
+                                               size_t const& maxActiveArgs, size_t const& maxConstantArgs,
+                                               Args&&... args) {
+            CODI_UNUSED(maxOutputArgs, maxActiveArgs, maxConstantArgs);
+
+            // The data of the statements is loaded in the inner function.
+            evalInner(std::forward<Args>(args)...);
+          }
+
+          /// \copydoc codi::StatementEvaluatorTapeInterface::StatementCallGenerator::evaluate()
+          CODI_INLINE static void evaluate(Impl& CODI_RESTRICT tape, Gradient* CODI_RESTRICT lhsAdjoints,
+                                           Real* CODI_RESTRICT primalVector,
+                                           ADJOINT_VECTOR_TYPE* CODI_RESTRICT adjointVector,
+                                           size_t& CODI_RESTRICT linearAdjointPos, size_t& CODI_RESTRICT curStatementPos,
+                                           size_t const& runStartPos,
+                                           Config::ArgumentSize const* const numberOfPassiveArguments,
+                                           Config::LowLevelFunctionDataSize const* const stmtByteSize,
+                                           size_t& CODI_RESTRICT curStatementBytePos, char* stmtDataPtr) {
+            evaluateInner(tape, lhsAdjoints, primalVector, adjointVector, linearAdjointPos, curStatementPos,
+                          runStartPos, numberOfPassiveArguments, stmtByteSize, curStatementBytePos, stmtDataPtr);
+          }
+      };
+
       /*******************************************************************************/
       /// ResetPrimal implementation
       template<typename Stmt>
@@ -2100,6 +2374,63 @@ namespace codi {
           }
       };
 
+      /// ReverseRun implementation
+      template<typename Stmt>
+      struct StatementCallGenerator<StatementCall::ReverseRun, Stmt> {
+        public:
+          /// Evaluation of a single statement.
+          using ReverseGenerator = StatementCallGenerator<StatementCall::Reverse, Stmt>;
+
+          /// Data loading of a single statement, see InnerStatementEvaluator::call.
+          using TapeReverseGenerator = typename TapeImpl::template StatementCallGenerator<
+              StatementCall::Reverse, AssignStatement<ActiveType<TapeImpl>, ActiveType<TapeImpl>>>;
+
+          /// Evaluates the statements curStatementPos - 1 down to runStartPos, which all have the handle of Stmt. The
+          /// data of each statement is loaded by the tape like for a single call.
+          CODI_INLINE static void evaluateInner(TapeImpl& CODI_RESTRICT tape, Gradient* CODI_RESTRICT lhsAdjoints,
+                                                Real* CODI_RESTRICT primalVector,
+                                                ADJOINT_VECTOR_TYPE* CODI_RESTRICT adjointVector,
+                                                size_t& CODI_RESTRICT linearAdjointPos,
+                                                size_t& CODI_RESTRICT curStatementPos, size_t const& runStartPos,
+                                                Config::ArgumentSize const* const numberOfPassiveArguments,
+                                                Config::LowLevelFunctionDataSize const* const stmtByteSize,
+                                                size_t& CODI_RESTRICT curStatementBytePos, char* stmtDataPtr) {
+            while (curStatementPos > runStartPos) {
+              curStatementPos -= 1;
+              curStatementBytePos -= stmtByteSize[curStatementPos];
+
+              TapeReverseGenerator::evaluateFull(ReverseGenerator::evaluateInner, 1, size, 0, tape, lhsAdjoints,
+                                                 primalVector, adjointVector, linearAdjointPos,
+                                                 numberOfPassiveArguments[curStatementPos],
+                                                 &stmtDataPtr[curStatementBytePos]);
+            }
+          }
+
+          /// \copydoc codi::StatementEvaluatorInnerTapeInterface::StatementCallGenerator::evaluateFull()
+          template<typename Func, typename... Args>
+          CODI_INLINE static void evaluateFull(Func const& evalInner, size_t const& maxOutputArgs,
+                                               size_t const& maxActiveArgs, size_t const& maxConstantArgs,
+                                               Args&&... args) {
+            CODI_UNUSED(maxOutputArgs, maxActiveArgs, maxConstantArgs);
+
+            // The data of the statements is loaded in the inner function.
+            evalInner(std::forward<Args>(args)...);
+          }
+
+          /// \copydoc codi::StatementEvaluatorTapeInterface::StatementCallGenerator::evaluate()
+          CODI_INLINE static void evaluate(TapeImpl& CODI_RESTRICT tape, Gradient* CODI_RESTRICT lhsAdjoints,
+                                           Real* CODI_RESTRICT primalVector,
+                                           ADJOINT_VECTOR_TYPE* CODI_RESTRICT adjointVector,
+                                           size_t& CODI_RESTRICT linearAdjointPos, size_t& CODI_RESTRICT curStatementPos,
+                                           size_t const& runStartPos,
+                                           Config::ArgumentSize const* const numberOfPassiveArguments,
+                                           Config::LowLevelFunctionDataSize const* const stmtByteSize,
+                                           size_t& CODI_RESTRICT curStatementBytePos, char* stmtDataPtr) {
+            evaluateInner(tape, lhsAdjoints, primalVector, adjointVector, linearAdjointPos, curStatementPos,
+                          runStartPos, numberOfPassiveArguments, stmtByteSize, curStatementBytePos, stmtDataPtr);
+          }
+      };
+
       /// ResetPrimal implementation
       template<typename Stmt>
       struct StatementCallGenerator<StatementCall::ResetPrimals, Stmt>
@@ -37,6 +37,7 @@
 #include <algorithm>
 #include <functional>
 #include <type_traits>
+#include <vector>
 
 #include "../config.h"
 #include "../expressions/lhsExpressionInterface.hpp"
@@ -264,11 +265,23 @@ namespace codi {
           } else if (Config::StatementInputTag == nPassiveValues) CODI_Unlikely {
             curAdjointPos -= 1;
           } else CODI_Likely {
-            curStatementBytePos -= stmtByteSize[curStatementPos];
-
-            StatementEvaluator::template call<StatementCall::Reverse, PrimalValueLinearTape>(
-                stmtEvalHandle[curStatementPos], tape, lhsAdjoints.data(), primalVector, adjointVector, curAdjointPos,
-                nPassiveValues, &stmtDataPtr[curStatementBytePos]);
+            size_t runStartPos = Base::findStatementRunStart(curStatementPos, endStatementPos, numberOfPassiveArguments,
+                                                             stmtEvalHandle);
+
+            if (runStartPos == curStatementPos) CODI_Likely {
+              curStatementBytePos -= stmtByteSize[curStatementPos];
+
+              StatementEvaluator::template call<StatementCall::Reverse, PrimalValueLinearTape>(
+                  stmtEvalHandle[curStatementPos], tape, lhsAdjoints.data(), primalVector, adjointVector, curAdjointPos,
+                  numberOfPassiveArguments[curStatementPos], &stmtDataPtr[curStatementBytePos]);
+            } else {
+              curStatementPos += 1;  // The run evaluation starts with the current statement.
+
+              StatementEvaluator::template call<StatementCall::ReverseRun, PrimalValueLinearTape>(
+                  stmtEvalHandle[runStartPos], tape, lhsAdjoints.data(), primalVector, adjointVector, curAdjointPos,
+                  curStatementPos, runStartPos, numberOfPassiveArguments, stmtByteSize, curStatementBytePos,
+                  stmtDataPtr);
+            }
           }
         }
       }
@@ -352,6 +365,369 @@ namespace codi {
         // Primal values do not need to be reset.
       }
 
+      /*******************************************************************************/
+      /// @name Parallel primal evaluation
+      /// @{
+
+      /**
+       * @brief Primal evaluation of the tape between start and end, where independent statements are evaluated
+       * concurrently.
+       *
+       * The first call for a start and end position sorts the statements into levels. Each statement is placed on the
+       * level after the highest level of its arguments, so all statements of one level can be evaluated in parallel.
+       * The levels are cached in the tape and reused for further calls with the same positions. reset, resetTo,
+       * resetHard, swap and deleteData invalidate the cache.
+       *
+       * Statements with passive arguments share the passive value slots at the beginning of the primal vector. They are
+       * evaluated by one thread per level. Low level functions that provide IterateInputs and IterateOutputs are placed
+       * on the levels like statements and are also evaluated by one thread. All other low level functions are barriers,
+       * all statements recorded before them are evaluated before the function, all statements recorded after them after
+       * the function.
+       *
+       * The function opens an OpenMP parallel region if codi::Config::EnableOpenMP is set, otherwise the levels are
+       * evaluated sequentially. Levels with only a few statements are evaluated by a single thread. Statement listeners
+       * of the event system are notified concurrently.
+       */
+      void evaluatePrimalParallel(Position const& start, Position const& end) {
+        if (!primalSchedule.valid || !(primalSchedule.start == start) || !(primalSchedule.end == end)) {
+          buildPrimalSchedule(start, end);
+        }
+
+        Real* primalVector = this->primals.data();
+        PrimalAdjointVectorAccess<Real, Identifier, Gradient*> primalAdjointAccess(this->adjoints.data(), primalVector);
+
+        EventSystem<PrimalValueLinearTape>::notifyTapeEvaluateListeners(
+            *this, start, end, &primalAdjointAccess, EventHints::EvaluationKind::Primal, EventHints::Endpoint::Begin);
+
+        CODI_OMP_OPTIONAL(omp parallel) {
+          StackArray<Real> lhsPrimals = {};
+          typename Base::template VectorAccess<Gradient*> vectorAccess(nullptr, primalVector);
+
+          for (PrimalScheduleBlock const& block : primalSchedule.blocks) {
+            size_t const blockStart = primalSchedule.levelOffsets[2 * block.levelStart];
+
+            if (block.parallel) {
+              size_t const parallelStart = primalSchedule.levelOffsets[2 * block.levelStart + 1];
+              size_t const parallelEnd = primalSchedule.levelOffsets[2 * block.levelStart + 2];
+
+              CODI_OMP_OPTIONAL(omp single nowait) {
+                evaluatePrimalTasks(blockStart, parallelStart, lhsPrimals.data(), &vectorAccess, primalVector);
+              }
+
+              // The implicit barrier of the loop finishes the level.
+              CODI_OMP_OPTIONAL(omp for schedule(dynamic, PrimalScheduleChunkSize))
+              for (size_t curTask = parallelStart; curTask < parallelEnd; curTask += 1) {
+                evaluatePrimalTask(primalSchedule.tasks[curTask], lhsPrimals.data(), &vectorAccess, primalVector);
+              }
+            } else {
+              size_t const blockEnd = primalSchedule.levelOffsets[2 * block.levelEnd];
+
+              CODI_OMP_OPTIONAL(omp single) {
+                evaluatePrimalTasks(blockStart, blockEnd, lhsPrimals.data(), &vectorAccess, primalVector);
+              }
+            }
+          }
+        }
+
+        EventSystem<PrimalValueLinearTape>::notifyTapeEvaluateListeners(
+            *this, start, end, &primalAdjointAccess, EventHints::EvaluationKind::Primal, EventHints::Endpoint::End);
+      }
+
+      /// Parallel primal evaluation of the whole tape. See evaluatePrimalParallel(Position const&, Position const&).
+      void evaluatePrimalParallel() {
+        evaluatePrimalParallel(this->getZeroPosition(), this->getPosition());
+      }
+
+      /// @}
+      /*******************************************************************************/
+      /// @name Functions from ReverseTapeInterface, PositionalEvaluationTapeInterface and DataManagementTapeInterface
+      /// @{
+
+      /// \copydoc codi::PrimalValueBaseTape::reset
+      /// <br> Implementation: Also deletes the level schedule of evaluatePrimalParallel.
+      CODI_INLINE void reset(bool resetAdjoints = true,
+                             AdjointsManagement adjointsManagement = AdjointsManagement::Automatic) {
+        resetPrimalSchedule();
+
+        Base::reset(resetAdjoints, adjointsManagement);
+      }
+
+      /// \copydoc codi::PrimalValueBaseTape::resetTo
+      /// <br> Implementation: Also deletes the level schedule of evaluatePrimalParallel.
+      CODI_INLINE void resetTo(Position const& pos, bool resetAdjoints = true,
+                               AdjointsManagement adjointsManagement = AdjointsManagement::Automatic) {
+        resetPrimalSchedule();
+
+        Base::resetTo(pos, resetAdjoints, adjointsManagement);
+      }
+
+      /// \copydoc codi::PrimalValueBaseTape::resetHard
+      /// <br> Implementation: Also deletes the level schedule of evaluatePrimalParallel.
+      void resetHard() {
+        resetPrimalSchedule();
+
+        Base::resetHard();
+      }
+
+      /// \copydoc codi::PrimalValueBaseTape::swap
+      /// <br> Implementation: Also deletes the level schedule of evaluatePrimalParallel.
+      CODI_INLINE void swap(PrimalValueLinearTape& other) {
+        resetPrimalSchedule();
+        other.resetPrimalSchedule();
+
+        Base::swap(other);
+      }
+
+      /// \copydoc codi::CommonTapeImplementation::deleteData
+      /// <br> Implementation: Also deletes the level schedule of evaluatePrimalParallel.
+      void deleteData() {
+        resetPrimalSchedule();
+
+        Base::deleteData();
+      }
+
+      /// @}
+
+    protected:
+
+      /// Minimum number of parallel statements on a level, such that the level is evaluated by all threads.
+      static size_t constexpr PrimalScheduleMinParallelTasks = 256;
+      /// Number of statements that a thread takes at once from a parallel level.
+      static size_t constexpr PrimalScheduleChunkSize = 32;
+
+      /// A statement or low level function in the level schedule of evaluatePrimalParallel.
+      struct PrimalScheduleTask {
+          EvalHandle evalHandle;                ///< Evaluation handle of the statement.
+          Config::ArgumentSize nPassiveValues;  ///< Number of passive values or Config::StatementLowLevelFunctionTag.
+          size_t position;  ///< Linear adjoint position before the statement or index of the low level function.
+          char* stmtData;   ///< Byte data of the statement.
+      };
+
+      /// A low level function in the level schedule of evaluatePrimalParallel.
+      struct PrimalScheduleLowLevelFunction {
+          LowLevelFunctionEntry<PrimalValueLinearTape, Real, Identifier> const* func;  ///< Function entry.
+          ByteDataView data;                                                          ///< Data of the function.
+      };
+
+      /// Consecutive levels that are evaluated either by a single thread or by all threads.
+      struct PrimalScheduleBlock {
+          size_t levelStart;  ///< First level of the block.
+          size_t levelEnd;    ///< End of the levels of the block (exclusive).
+          bool parallel;      ///< If the block consists of one level that is evaluated by all threads.
+      };
+
+      /// Level schedule of evaluatePrimalParallel.
+      struct PrimalSchedule {
+          bool valid;      ///< If the schedule has been built.
+          Position start;  ///< Start position of the schedule.
+          Position end;    ///< End position of the schedule.
+
+          /// Tasks sorted by level. On each level, the serial tasks are placed before the parallel ones.
+          std::vector<PrimalScheduleTask> tasks;
+          /// Task offsets: 2 * level is the start of the serial tasks, 2 * level + 1 the start of the parallel tasks.
+          std::vector<size_t> levelOffsets;
+          std::vector<PrimalScheduleBlock> blocks;                        ///< Evaluation blocks.
+          std::vector<PrimalScheduleLowLevelFunction> lowLevelFunctions;  ///< Low level functions of the tasks.
+
+          /// Constructor
+          PrimalSchedule() : valid(false), start(), end(), tasks(), levelOffsets(), blocks(), lowLevelFunctions() {}
+      };
+
+      /// User data for the identifier iteration in buildPrimalSchedule.
+      struct PrimalScheduleLevelData {
+          std::vector<size_t>& identifierLevels;  ///< Level of the statement that computed the identifier.
+          size_t level;                           ///< Level of the current statement.
+          size_t outputs;                         ///< Number of outputs of the current statement.
+      };
+
+      PrimalSchedule primalSchedule;  ///< Cached level schedule of evaluatePrimalParallel.
+
+      /// Deletes the level schedule of evaluatePrimalParallel.
+      void resetPrimalSchedule() {
+        primalSchedule = PrimalSchedule();
+      }
+
+      /// Raises the level of the statement above the level of the input.
+      static void updatePrimalScheduleInputLevel(Identifier* identifier, void* userData) {
+        PrimalScheduleLevelData* data = (PrimalScheduleLevelData*)userData;
+
+        data->level = std::max(data->level, data->identifierLevels[*identifier] + 1);
+      }
+
+      /// Stores the level of the statement for the output.
+      static void setPrimalScheduleOutputLevel(Identifier* identifier, void* userData) {
+        PrimalScheduleLevelData* data = (PrimalScheduleLevelData*)userData;
+
+        data->identifierLevels[*identifier] = data->level;
+        data->outputs += 1;
+      }
+
+      /// Sorts the statements between start and end into levels. See evaluatePrimalParallel.
+      void buildPrimalSchedule(Position const& start, Position const& end) {
+        resetPrimalSchedule();
+
+        // Levels start at 1, identifiers that are not computed in the range have level 0.
+        std::vector<size_t> identifierLevels(this->primals.size(), 0);
+        std::vector<PrimalScheduleTask> unsortedTasks;
+        std::vector<size_t> taskKeys;
+        unsortedTasks.reserve(Base::statementData.getDataSize());  // Upper bound for the number of tasks.
+        taskKeys.reserve(Base::statementData.getDataSize());
+        size_t maxLevel = 0;
+        size_t barrierLevel = 0;
+
+        auto addTask = [&](PrimalScheduleTask const& task, size_t level, bool parallel) {
+          unsortedTasks.push_back(task);
+          taskKeys.push_back(2 * (level - 1) + (size_t)parallel);
+          maxLevel = std::max(maxLevel, level);
+        };
+
+        auto buildFunc =
+            [&](
+                /* data from call */
+                PrimalValueLinearTape& tape,
+                /* data from low level function byte data vector */
+                size_t& curLLFByteDataPos, size_t const& endLLFByteDataPos, char* dataPtr,
+                /* data from low level function info data vector */
+                size_t& curLLFInfoDataPos, size_t const& endLLFInfoDataPos,
+                Config::LowLevelFunctionToken* const tokenPtr, Config::LowLevelFunctionDataSize* const dataSizePtr,
+                /* data from statementByteData */
+                size_t& curStatementBytePos, size_t const& endStatementBytePos, char* stmtDataPtr,
+                /* data from statementData */
+                size_t& curStatementPos, size_t const& endStatementPos,
+                Config::ArgumentSize const* const numberOfPassiveArguments, EvalHandle const* const stmtEvalHandle,
+                Config::LowLevelFunctionDataSize* const stmtByteSize,
+                /* data from index handler */
+                size_t const& startAdjointPos, size_t const& endAdjointPos) {
+              CODI_UNUSED(endLLFByteDataPos, endLLFInfoDataPos, endStatementBytePos, endAdjointPos);
+
+              size_t curAdjointPos = startAdjointPos;
+              ByteDataView dataView = {};
+              LowLevelFunctionEntry<PrimalValueLinearTape, Real, Identifier> const* func = nullptr;
+
+              while (curStatementPos < endStatementPos) {
+                Config::ArgumentSize nPassiveValues = numberOfPassiveArguments[curStatementPos];
+
+                if (Config::StatementLowLevelFunctionTag == nPassiveValues) CODI_Unlikely {
+                  Config::LowLevelFunctionToken id = Base::prepareLowLevelFunction(
+                      true, curLLFByteDataPos, dataPtr, curLLFInfoDataPos, tokenPtr, dataSizePtr, dataView, func);
+
+                  if (!func->template has<LowLevelFunctionEntryCallKind::Primal>()) {
+                    CODI_EXCEPTION("Requested call is not supported for low level function with token '%d'.", (int)id);
+                  }
+
+                  bool declaresIds = func->template has<LowLevelFunctionEntryCallKind::IterateInputs>() &&
+                                     func->template has<LowLevelFunctionEntryCallKind::IterateOutputs>();
+                  if (Base::EXTERNAL_FUNCTION_TOKEN == id) {
+                    // The entry of external functions always provides the iteration, the functions might not.
+                    ByteDataView extView = dataView;
+                    using ExtFunc = ExternalFunction<PrimalValueLinearTape>;
+                    declaresIds = extView.template read<ExtFunc>(1)->hasIterateFunctions();
+                  }
+
+                  PrimalScheduleLevelData data = {identifierLevels, barrierLevel + 1, 0};
+                  if (declaresIds) {
+                    ByteDataView iterView = dataView;
+                    func->template call<LowLevelFunctionEntryCallKind::IterateInputs>(
+                        &tape, iterView, updatePrimalScheduleInputLevel, &data);
+                    iterView = dataView;
+                    func->template call<LowLevelFunctionEntryCallKind::IterateOutputs>(
+                        &tape, iterView, setPrimalScheduleOutputLevel, &data);
+                  } else {
+                    // Barrier, all following statements are placed on later levels.
+                    data.level = maxLevel + 1;
+                    barrierLevel = data.level;
+                  }
+
+                  addTask({EvalHandle(), nPassiveValues, primalSchedule.lowLevelFunctions.size(), nullptr}, data.level,
+                          false);
+                  primalSchedule.lowLevelFunctions.push_back({func, dataView});
+                } else if (Config::StatementInputTag == nPassiveValues) CODI_Unlikely {
+                  curAdjointPos += 1;
+                } else CODI_Likely {
+                  char* stmtData = &stmtDataPtr[curStatementBytePos];
+
+                  PrimalScheduleLevelData data = {identifierLevels, barrierLevel + 1, 0};
+                  StatementEvaluator::template call<StatementCall::IterateInputs, PrimalValueLinearTape>(
+                      stmtEvalHandle[curStatementPos], curAdjointPos, updatePrimalScheduleInputLevel, &data,
+                      nPassiveValues, stmtData);
+                  StatementEvaluator::template call<StatementCall::IterateOutputs, PrimalValueLinearTape>(
+                      stmtEvalHandle[curStatementPos], curAdjointPos, setPrimalScheduleOutputLevel, &data,
+                      nPassiveValues, stmtData);
+
+                  // Statements with passive values use the shared passive value slots of the primal vector.
+                  addTask({stmtEvalHandle[curStatementPos], nPassiveValues, curAdjointPos, stmtData}, data.level,
+                          0 == nPassiveValues);
+
+                  curAdjointPos += data.outputs;
+                  curStatementBytePos += stmtByteSize[curStatementPos];
+                }
+
+                curStatementPos += 1;
+              }
+            };
+
+        Base::llfByteData.evaluateForward(start, end, buildFunc, *this);
+
+        // Counting sort of the tasks by level.
+        primalSchedule.levelOffsets.assign(2 * maxLevel + 1, 0);
+        for (size_t key : taskKeys) {
+          primalSchedule.levelOffsets[key + 1] += 1;
+        }
+        for (size_t i = 1; i < primalSchedule.levelOffsets.size(); i += 1) {
+          primalSchedule.levelOffsets[i] += primalSchedule.levelOffsets[i - 1];
+        }
+
+        std::vector<size_t> insertPos(primalSchedule.levelOffsets.begin(), primalSchedule.levelOffsets.end() - 1);
+        primalSchedule.tasks.resize(unsortedTasks.size());
+        for (size_t i = 0; i < unsortedTasks.size(); i += 1) {
+          primalSchedule.tasks[insertPos[taskKeys[i]]] = unsortedTasks[i];
+          insertPos[taskKeys[i]] += 1;
+        }
+
+        // Levels with few parallel tasks are merged into blocks for a single thread.
+        for (size_t level = 0; level < maxLevel; level += 1) {
+          size_t parallelTasks =
+              primalSchedule.levelOffsets[2 * level + 2] - primalSchedule.levelOffsets[2 * level + 1];
+
+          if (PrimalScheduleMinParallelTasks <= parallelTasks) {
+            primalSchedule.blocks.push_back({level, level + 1, true});
+          } else if (!primalSchedule.blocks.empty() && !primalSchedule.blocks.back().parallel) {
+            primalSchedule.blocks.back().levelEnd = level + 1;
+          } else {
+            primalSchedule.blocks.push_back({level, level + 1, false});
+          }
+        }
+
+        primalSchedule.valid = true;
+        primalSchedule.start = start;
+        primalSchedule.end = end;
+      }
+
+      /// Evaluates one task of the level schedule.
+      CODI_INLINE void evaluatePrimalTask(PrimalScheduleTask const& task, Real* lhsPrimals,
+                                          VectorAccessInterface<Real, Identifier>* vectorAccess, Real* primalVector) {
+        if (Config::StatementLowLevelFunctionTag == task.nPassiveValues) CODI_Unlikely {
+          PrimalScheduleLowLevelFunction const& entry = primalSchedule.lowLevelFunctions[task.position];
+
+          ByteDataView dataView = entry.data;
+          entry.func->template call<LowLevelFunctionEntryCallKind::Primal>(this, dataView, vectorAccess);
+        } else CODI_Likely {
+          size_t linearAdjointPos = task.position;
+          StatementEvaluator::template call<StatementCall::Primal, PrimalValueLinearTape>(
+              task.evalHandle, *this, lhsPrimals, primalVector, linearAdjointPos, task.nPassiveValues, task.stmtData);
+        }
+      }
+
+      /// Evaluates the tasks [start, end) of the level schedule in order.
+      CODI_INLINE void evaluatePrimalTasks(size_t start, size_t end, Real* lhsPrimals,
+                                           VectorAccessInterface<Real, Identifier>* vectorAccess, Real* primalVector) {
+        for (size_t curTask = start; curTask < end; curTask += 1) {
+          evaluatePrimalTask(primalSchedule.tasks[curTask], lhsPrimals, vectorAccess, primalVector);
+        }
+      }
+
+    public:
+
       /*******************************************************************************/
       /// @name Functions from CustomIteratorTapeInterface
       /// @{
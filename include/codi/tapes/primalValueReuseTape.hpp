@@ -284,11 +284,23 @@ namespace codi {
 #endif
             );
           } else CODI_Likely {
-            curStatementBytePos -= stmtByteSize[curStatementPos];
-
-            StatementEvaluator::template call<StatementCall::Reverse, PrimalValueReuseTape>(
-                stmtEvalHandle[curStatementPos], tape, lhsAdjoints.data(), primalVector, adjointVector,
-                linearAdjointPos, numberOfPassiveArguments[curStatementPos], &stmtDataPtr[curStatementBytePos]);
+            size_t runStartPos = Base::findStatementRunStart(curStatementPos, endStatementPos, numberOfPassiveArguments,
+                                                             stmtEvalHandle);
+
+            if (runStartPos == curStatementPos) CODI_Likely {
+              curStatementBytePos -= stmtByteSize[curStatementPos];
+
+              StatementEvaluator::template call<StatementCall::Reverse, PrimalValueReuseTape>(
+                  stmtEvalHandle[curStatementPos], tape, lhsAdjoints.data(), primalVector, adjointVector, linearAdjointPos,
+                  numberOfPassiveArguments[curStatementPos], &stmtDataPtr[curStatementBytePos]);
+            } else {
+              curStatementPos += 1;  // The run evaluation starts with the current statement.
+
+              StatementEvaluator::template call<StatementCall::ReverseRun, PrimalValueReuseTape>(
+                  stmtEvalHandle[runStartPos], tape, lhsAdjoints.data(), primalVector, adjointVector, linearAdjointPos,
+                  curStatementPos, runStartPos, numberOfPassiveArguments, stmtByteSize, curStatementBytePos,
+                  stmtDataPtr);
+            }
           }
         }
       }
@@ -48,6 +48,7 @@ namespace codi {
     Primal,            ///< Evaluate primal expression.
     ResetPrimals,      ///< Restore the primal values.
     Reverse,           ///< Evaluate expression in a reverse mode.
+    ReverseRun,        ///< Evaluate consecutive statements with the same handle in a reverse mode.
     WriteInformation,  ///< Get write information.
     IterateInputs,     ///< Iterate over the inputs of the statement.
     IterateOutputs,    ///< Iterate over the outputs of the statement.
@@ -56,8 +57,8 @@ namespace codi {
 
 #define CODI_STMT_CALL_GEN_ARGS                                                                             \
   StatementCall::ClearAdjoints, StatementCall::Forward, StatementCall::Primal, StatementCall::ResetPrimals, \
-      StatementCall::Reverse, StatementCall::WriteInformation, StatementCall::IterateInputs,                \
-      StatementCall::IterateOutputs
+      StatementCall::Reverse, StatementCall::ReverseRun, StatementCall::WriteInformation,                   \
+      StatementCall::IterateInputs, StatementCall::IterateOutputs
 
   /**
    * @brief Tape side interface for StatementEvaluatorInterface.
@@ -0,0 +1,245 @@
+/*
+ * CoDiPack, a Code Differentiation Package
+ *
+ * Copyright (C) 2015-2026 Chair for Scientific Computing (SciComp), RPTU University Kaiserslautern-Landau
+ * Homepage: http://scicomp.rptu.de
+ * Contact:  Prof. Nicolas R. Gauger (codi@scicomp.uni-kl.de)
+ *
+ * Lead developers: Max Sagebaum, Johannes Blühdorn (SciComp, RPTU University Kaiserslautern-Landau)
+ *
+ * This file is part of CoDiPack (http://scicomp.rptu.de/software/codi).
+ *
+ * CoDiPack is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * CoDiPack is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * See the GNU General Public License for more details.
+ * You should have received a copy of the GNU
+ * General Public License along with CoDiPack.
+ * If not, see <http://www.gnu.org/licenses/>.
+ *
+ * For other licensing options please contact us.
+ *
+ * Authors:
+ *  - SciComp, RPTU University Kaiserslautern-Landau:
+ *    - Max Sagebaum
+ *    - Johannes Blühdorn
+ *    - Former members:
+ *      - Tim Albring
+ */
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <tuple>
+#include <type_traits>
+
+#include "../../expressions/activeType.hpp"
+#include "../../misc/exceptions.hpp"
+#include "../../misc/macros.hpp"
+#include "../misc/assignStatement.hpp"
+#include "innerStatementEvaluator.hpp"
+#include "statementEvaluatorInterface.hpp"
+
+/** \copydoc codi::Namespace */
+namespace codi {
+
+  /**
+   * @brief Statement registry without statements.
+   *
+   * All statements of a SwitchStatementEvaluator with this registry are evaluated by the fallback path.
+   *
+   * @tparam T_Tape  The tape that records the statements.
+   */
+  template<typename T_Tape>
+  struct EmptyStatementRegistry {
+    public:
+
+      using Statements = std::tuple<>;  ///< List of AssignStatement types.
+  };
+
+  /// Storage of the statements that are not in the registry of a SwitchStatementEvaluator.
+  struct SwitchStatementEvaluatorFallbackStore {
+    public:
+
+      using Handle = uint16_t;  ///< See SwitchStatementEvaluator.
+
+      static size_t constexpr MaxHandles = size_t(1) << (8 * sizeof(Handle));  ///< Number of possible handles.
+
+      /// Data of the InnerStatementEvaluator for each fallback handle.
+      static std::array<InnerPrimalTapeStatementData const*, MaxHandles>& getData() {
+        static std::array<InnerPrimalTapeStatementData const*, MaxHandles> data = {};
+
+        return data;
+      }
+
+      /// Add a statement. Fallback handles are distributed from the largest handle downwards.
+      static Handle add(InnerPrimalTapeStatementData const* stmtData, size_t const& registeredHandles) {
+        static std::atomic<size_t> count(0);
+
+        size_t pos = count.fetch_add(1);
+        if (pos + registeredHandles >= MaxHandles) {
+          CODI_EXCEPTION("Too many statements for the 16 bit handles of the SwitchStatementEvaluator.");
+        }
+
+        Handle handle = (Handle)(MaxHandles - 1 - pos);
+        getData()[handle] = stmtData;
+
+        return handle;
+      }
+  };
+
+  /**
+   * @brief Evaluation of the statements in a switch over a closed, compile time registry of statements.
+   *
+   * The registry is a template `T_Registry<Tape>` which defines `Statements` as a `std::tuple` of the AssignStatement
+   * types that are recorded by the tape. The position of a statement in this tuple is its handle. Handles are stored
+   * as 16 bit integers, which saves six bytes per statement in the tape compared to the pointer handles of the other
+   * evaluators. The tape evaluation dispatches the handles with switch statements, which the compiler translates into
+   * jump tables. The full evaluation of the statement is inlined into the tape evaluation, like for the
+   * DirectStatementEvaluator, but without a function pointer call.
+   *
+   * Statements that are not in the registry, e.g. the statements from manual Jacobian pushes, are still supported.
+   * They get handles from the top of the handle range and are evaluated like in the InnerStatementEvaluator.
+   *
+   * The registry can be generated with the primal tape writers, see PrimalBaseTapeWriter. The generated header contains
+   * the template `<name>StatementRegistry` with all statements of the written tape.
+   *
+   * See StatementEvaluatorInterface for details.
+   *
+   * @tparam T_Registry  Template with the tape as argument. Has to define `Statements` as a `std::tuple` of
+   *                     AssignStatement types.
+   */
+  template<template<typename> class T_Registry = EmptyStatementRegistry>
+  struct SwitchStatementEvaluator : public StatementEvaluatorInterface {
+    public:
+
+      /// Registered statements for a tape.
+      template<typename Tape>
+      using Statements = typename T_Registry<Tape>::Statements;
+
+      /// Number of cases in one switch statement. Larger registries are split with a binary search.
+      static size_t constexpr SwitchSize = 16;
+      static_assert(16 == SwitchSize, "The switch in callRegistered has SwitchSize cases.");
+
+      /*******************************************************************************/
+      /// @name StatementEvaluatorInterface implementation
+      /// @{
+
+      using Handle = uint16_t;  ///< Position in the registry or fallback handle.
+
+      /// \copydoc StatementEvaluatorInterface::call
+      template<StatementCall type, typename Tape, typename... Args>
+      static void call(Handle const& h, Args&&... args) {
+        size_t constexpr registered = std::tuple_size<Statements<Tape>>::value;
+
+        if constexpr (0 != registered) {
+          if (h < registered) CODI_Likely {
+            callRegistered<type, Tape, 0, registered>(h, std::forward<Args>(args)...);
+            return;
+          }
+        }
+
+        InnerStatementEvaluator::template call<type, Tape>(SwitchStatementEvaluatorFallbackStore::getData()[h],
+                                                           std::forward<Args>(args)...);
+      }
+
+      /// \copydoc StatementEvaluatorInterface::createHandle
+      template<typename Tape, typename Generator, typename Stmt>
+      static Handle createHandle() {
+        size_t constexpr registered = std::tuple_size<Statements<Tape>>::value;
+        size_t constexpr pos = RegistryPosition<Stmt, Statements<Tape>>::value;
+
+        static_assert(registered < SwitchStatementEvaluatorFallbackStore::MaxHandles,
+                      "Too many statements in the registry for 16 bit handles.");
+
+        if constexpr (std::is_same<Tape, Generator>::value && pos < registered) {
+          return (Handle)pos;
+        } else {
+          static Handle const handle = SwitchStatementEvaluatorFallbackStore::add(
+              &InnerStatementEvaluatorStaticStore<Generator, Stmt>::staticStore, registered);
+
+          return handle;
+        }
+      }
+
+      /// @}
+
+    private:
+
+      /// Position of Stmt in the tuple Registered, the tuple size if Stmt is not registered.
+      template<typename Stmt, typename Registered>
+      struct RegistryPosition;
+
+      /// Stmt is not in the tuple.
+      template<typename Stmt>
+      struct RegistryPosition<Stmt, std::tuple<>> : public std::integral_constant<size_t, 0> {};
+
+      /// Check the first statement and recurse on the others.
+      template<typename Stmt, typename First, typename... Other>
+      struct RegistryPosition<Stmt, std::tuple<First, Other...>>
+          : public std::integral_constant<size_t, std::is_same<Stmt, First>::value
+                                                      ? 0
+                                                      : 1 + RegistryPosition<Stmt, std::tuple<Other...>>::value> {};
+
+      /// Full evaluation of the registered statement at position pos.
+      template<StatementCall type, typename Tape, size_t pos, size_t end, typename... Args>
+      CODI_INLINE static void callStatement(Args&&... args) {
+        if constexpr (pos < end) {
+          using Stmt = typename std::tuple_element<pos, Statements<Tape>>::type;
+
+          Tape::template StatementCallGenerator<type, Stmt>::evaluate(std::forward<Args>(args)...);
+        } else {
+          CODI_UNUSED(args...);
+        }
+      }
+
+      /// Dispatch of the handles in [begin, end).
+      template<StatementCall type, typename Tape, size_t begin, size_t end, typename... Args>
+      CODI_INLINE static void callRegistered(Handle const& h, Args&&... args) {
+        if constexpr (end - begin > SwitchSize) {
+          size_t constexpr mid = begin + SwitchSize * ((end - begin + 2 * SwitchSize - 1) / (2 * SwitchSize));
+
+          if (h < mid) {
+            callRegistered<type, Tape, begin, mid>(h, std::forward<Args>(args)...);
+          } else {
+            callRegistered<type, Tape, mid, end>(h, std::forward<Args>(args)...);
+          }
+        } else {
+#define CODI_SWITCH_CASE(i)                                             \
+  case i:                                                               \
+    callStatement<type, Tape, begin + i, end>(std::forward<Args>(args)...); \
+    break;
+
+          switch (h - begin) {
+            CODI_SWITCH_CASE(0)
+            CODI_SWITCH_CASE(1)
+            CODI_SWITCH_CASE(2)
+            CODI_SWITCH_CASE(3)
+            CODI_SWITCH_CASE(4)
+            CODI_SWITCH_CASE(5)
+            CODI_SWITCH_CASE(6)
+            CODI_SWITCH_CASE(7)
+            CODI_SWITCH_CASE(8)
+            CODI_SWITCH_CASE(9)
+            CODI_SWITCH_CASE(10)
+            CODI_SWITCH_CASE(11)
+            CODI_SWITCH_CASE(12)
+            CODI_SWITCH_CASE(13)
+            CODI_SWITCH_CASE(14)
+            CODI_SWITCH_CASE(15)
+            default:
+              break;
+          }
+
+#undef CODI_SWITCH_CASE
+        }
+      }
+  };
+}
@@ -104,6 +104,12 @@ namespace codi {
         CODI_UNUSED(start, end, data);
       }
 
+      /// Do nothing.
+      template<typename Adjoint>
+      void evaluateConcurrent(Position const& start, Position const& end, Adjoint* data) {
+        CODI_UNUSED(start, end, data);
+      }
+
       /// Do nothing.
       template<typename Adjoint>
       void evaluateForward(Position const& start, Position const& end, Adjoint* data) {
@@ -282,13 +288,16 @@ namespace codi {
       /// @name ManualStatementPushTapeInterface interface implementation
       /// @{
 
+      /// The number of arguments is not used.
+      static bool constexpr SupportsWideStatements = true;
+
       /// Do nothing.
       void pushJacobiManual(Real const& jacobian, Real const& value, ActiveTypeTapeData const& index) {
         CODI_UNUSED(jacobian, value, index);
       }
 
       /// Set tag on lhs.
-      void storeManual(Real const& lhsValue, ActiveTypeTapeData& lhsIndex, Config::ArgumentSize const& size) {
+      void storeManual(Real const& lhsValue, ActiveTypeTapeData& lhsIndex, size_t const& size) {
         CODI_UNUSED(lhsValue, size);
 
         Base::setTag(lhsIndex.tag);
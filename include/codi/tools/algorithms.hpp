@@ -177,7 +177,7 @@ namespace codi {
 
         using CustomGT = GradientTraits::TraitsImplementation<Adjoint>;
 
-        size_t constexpr gradDim = CustomGT::dim;
+        size_t const gradDim = AdjointVectorTraits::getVectorSize(adjoints);
 
         EvaluationType evalType = getEvaluationChoice(inputSize, outputSize);
         if (EvaluationType::Forward == evalType) {
@@ -194,7 +194,7 @@ namespace codi {
               for (size_t curDim = 0; curDim < gradDim && j + curDim < inputSize; curDim += 1) {
                 jac(outputSize - i - 1, j + curDim) = CustomGT::at(adjoints[output[outputSize - i - 1]], curDim);
                 if (tape.isIdentifierActive(output[i])) {
-                  CustomGT::at(adjoints[output[outputSize - i - 1]], curDim) = typename GT::Real();
+                  CustomGT::at(adjoints[output[outputSize - i - 1]], curDim) = typename CustomGT::Real();
                 }
               }
             }
@@ -599,11 +599,13 @@ namespace codi {
       static CODI_INLINE void setGradientOnIdentifierCustomAdjoints(Tape& tape, size_t const pos,
                                                                     Identifier const* identifiers, size_t const size,
                                                                     T value, Adjoints& adjoints) {
-        size_t constexpr gradDim = GT::dim;
+        using CustomGT = GradientTraits::TraitsImplementation<AdjointVectorTraits::Gradient<Adjoints>>;
+
+        size_t const gradDim = AdjointVectorTraits::getVectorSize(adjoints);
 
         for (size_t curDim = 0; curDim < gradDim && pos + curDim < size; curDim += 1) {
           if (CODI_ENABLE_CHECK(ActiveChecks, tape.isIdentifierActive(identifiers[pos + curDim]))) {
-            GT::at(adjoints[identifiers[pos + curDim]], curDim) = value;
+            CustomGT::at(adjoints[identifiers[pos + curDim]], curDim) = value;
           }
         }
       }
@@ -0,0 +1,161 @@
+/*
+ * CoDiPack, a Code Differentiation Package
+ *
+ * Copyright (C) 2015-2026 Chair for Scientific Computing (SciComp), RPTU University Kaiserslautern-Landau
+ * Homepage: http://scicomp.rptu.de
+ * Contact:  Prof. Nicolas R. Gauger (codi@scicomp.uni-kl.de)
+ *
+ * Lead developers: Max Sagebaum, Johannes Blühdorn (SciComp, RPTU University Kaiserslautern-Landau)
+ *
+ * This file is part of CoDiPack (http://scicomp.rptu.de/software/codi).
+ *
+ * CoDiPack is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * CoDiPack is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * See the GNU General Public License for more details.
+ * You should have received a copy of the GNU
+ * General Public License along with CoDiPack.
+ * If not, see <http://www.gnu.org/licenses/>.
+ *
+ * For other licensing options please contact us.
+ *
+ * Authors:
+ *  - SciComp, RPTU University Kaiserslautern-Landau:
+ *    - Max Sagebaum
+ *    - Johannes Blühdorn
+ *    - Former members:
+ *      - Tim Albring
+ */
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "../../config.h"
+#include "../../misc/macros.hpp"
+
+/** \copydoc codi::Namespace */
+namespace codi {
+
+  /**
+   * @brief Hash map from identifiers to identifiers that keeps its memory across clear() calls.
+   *
+   * Used for the remapping of identifiers, e.g., in the PreaccumulationHelper. The map uses open addressing with linear
+   * probing in a table whose size is a power of two. Each entry stores the generation in which it was inserted. clear()
+   * starts a new generation and does not touch the table, entries of older generations count as empty.
+   *
+   * @tparam T_Identifier  Identifier type, usually chosen as Tape::Identifier.
+   */
+  template<typename T_Identifier>
+  struct IdentifierMap {
+    public:
+      using Identifier = CODI_DD(T_Identifier, int);  ///< See IdentifierMap.
+
+    private:
+
+      /// Table entry.
+      struct Entry {
+          Identifier key;       ///< Key of the entry.
+          Identifier value;     ///< Associated value.
+          uint32_t generation;  ///< Generation of the insertion. Zero for entries that were never used.
+      };
+
+      static size_t constexpr MinBits = 6;  ///< Initial table size is 2^(MinBits + 1).
+
+      std::vector<Entry> entries;  ///< Hash table.
+      size_t bits;                 ///< Table size is 2^bits.
+      size_t count;                ///< Number of entries of the current generation.
+      uint32_t generation;         ///< Current generation.
+
+    public:
+
+      /// Constructor. Memory is allocated on the first insertion.
+      IdentifierMap() : entries(), bits(0), count(0), generation(1) {}
+
+      /// Remove all entries. Keeps the memory.
+      CODI_INLINE void clear() {
+        count = 0;
+        generation += 1;
+
+        if (0 == generation) CODI_Unlikely {
+          // Wrap around, reset the generations of all entries.
+          for (Entry& entry : entries) {
+            entry.generation = 0;
+          }
+          generation = 1;
+        }
+      }
+
+      /// Number of entries.
+      CODI_INLINE size_t size() const {
+        return count;
+      }
+
+      /// Associate key with value if the key is not in the map. Returns the value associated with the key and true if
+      /// the insertion took place.
+      CODI_INLINE std::pair<Identifier, bool> insert(Identifier const& key, Identifier const& value) {
+        if (entries.size() < 2 * (count + 1)) CODI_Unlikely {
+          grow();
+        }
+
+        Entry& entry = entries[findSlot(key)];
+        if (generation == entry.generation) {
+          return {entry.value, false};
+        } else {
+          entry.key = key;
+          entry.value = value;
+          entry.generation = generation;
+          count += 1;
+
+          return {value, true};
+        }
+      }
+
+      /// Value associated with the key. The key has to be in the map.
+      CODI_INLINE Identifier const& operator[](Identifier const& key) const {
+        codiAssert(0 != count);
+
+        Entry const& entry = entries[findSlot(key)];
+        codiAssert(generation == entry.generation);
+
+        return entry.value;
+      }
+
+    private:
+
+      CODI_INLINE size_t findSlot(Identifier const& key) const {
+        size_t const mask = entries.size() - 1;
+
+        // Fibonacci hashing, the upper bits of the product are used.
+        size_t pos = (size_t)(((uint64_t)key * UINT64_C(0x9E3779B97F4A7C15)) >> (64 - bits));
+        while (generation == entries[pos].generation && key != entries[pos].key) {
+          pos = (pos + 1) & mask;
+        }
+
+        return pos;
+      }
+
+      void grow() {
+        std::vector<Entry> oldEntries(std::max(entries.size(), (size_t)1 << MinBits) * 2, Entry{});
+        std::swap(entries, oldEntries);
+        bits = 0;
+        while (((size_t)1 << bits) < entries.size()) {
+          bits += 1;
+        }
+
+        for (Entry const& entry : oldEntries) {
+          if (generation == entry.generation) {
+            entries[findSlot(entry.key)] = entry;
+          }
+        }
+      }
+  };
+}
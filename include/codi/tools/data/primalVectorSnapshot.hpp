@@ -0,0 +1,174 @@
+/*
+ * CoDiPack, a Code Differentiation Package
+ *
+ * Copyright (C) 2015-2026 Chair for Scientific Computing (SciComp), RPTU University Kaiserslautern-Landau
+ * Homepage: http://scicomp.rptu.de
+ * Contact:  Prof. Nicolas R. Gauger (codi@scicomp.uni-kl.de)
+ *
+ * Lead developers: Max Sagebaum, Johannes Blühdorn (SciComp, RPTU University Kaiserslautern-Landau)
+ *
+ * This file is part of CoDiPack (http://scicomp.rptu.de/software/codi).
+ *
+ * CoDiPack is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * CoDiPack is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * See the GNU General Public License for more details.
+ * You should have received a copy of the GNU
+ * General Public License along with CoDiPack.
+ * If not, see <http://www.gnu.org/licenses/>.
+ *
+ * For other licensing options please contact us.
+ *
+ * Authors:
+ *  - SciComp, RPTU University Kaiserslautern-Landau:
+ *    - Max Sagebaum
+ *    - Johannes Blühdorn
+ *    - Former members:
+ *      - Tim Albring
+ */
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+#include "../../config.h"
+#include "../../misc/macros.hpp"
+#include "../../tapes/interfaces/fullTapeInterface.hpp"
+
+/** \copydoc codi::Namespace */
+namespace codi {
+
+  /**
+   * @brief Snapshot of the primal value vector of a primal value tape that restores only the reverted entries.
+   *
+   * Reverse evaluations of primal value tapes with index reuse revert the primal values of the left hand sides, see
+   * PrimalValueBaseTape::iterateRevertedPrimals(). capture() copies the primal vector and marks in a bitmap all blocks
+   * of BlockSize entries that contain such a primal value. restore() copies only the marked blocks, so a primal vector
+   * that was used in a reverse evaluation is reset to the captured state with an effort proportional to the number of
+   * reverted entries instead of the size of the primal vector.
+   *
+   * Together with PrimalValueBaseTape::evaluateWithPrimals(), repeated reverse evaluations for different seeds do not
+   * require a primal evaluation or a full copy of the primal vector in between. The primal vector of the tape is not
+   * modified, each thread can use its own working vector for concurrent reverse evaluations.
+   *
+   * \code{.cpp}
+   *   codi::PrimalVectorSnapshot<Tape> snapshot;
+   *   snapshot.capture(tape);
+   *
+   *   std::vector<Real> primals;
+   *   snapshot.initialize(primals);
+   *   for (...) {
+   *     // Seed the adjoints.
+   *     tape.evaluateWithPrimals(tape.getPosition(), tape.getZeroPosition(), primals.data(), adjoints.data());
+   *     snapshot.restore(primals.data());
+   *   }
+   * \endcode
+   *
+   * For tapes with linear index management, no blocks are marked since the reverse evaluation does not change the
+   * primal values.
+   *
+   * @tparam T_Tape  A primal value tape, see PrimalValueBaseTape.
+   */
+  template<typename T_Tape>
+  struct PrimalVectorSnapshot {
+    public:
+
+      using Tape = CODI_DD(T_Tape, CODI_DEFAULT_TAPE);  ///< See PrimalVectorSnapshot.
+      using Real = typename Tape::Real;                 ///< See TapeTypesInterface.
+      using Identifier = typename Tape::Identifier;     ///< See TapeTypesInterface.
+      using Position = typename Tape::Position;         ///< See TapeTypesInterface.
+
+      static size_t constexpr BlockSize = 64;  ///< Number of primal values that are restored together.
+
+    private:
+
+      static size_t constexpr BitsPerWord = 64;
+
+      std::vector<Real> values;           ///< Captured primal values.
+      std::vector<uint64_t> dirtyBitmap;  ///< One bit per block, set if the block contains a reverted primal value.
+      std::vector<size_t> dirtyBlocks;    ///< Indices of the marked blocks.
+
+    public:
+
+      /// Capture the primal vector of the tape and mark the blocks that a reverse evaluation from start to end
+      /// reverts. start and end are given as for the reverse evaluation.
+      void capture(Tape& tape, Position const& start, Position const& end) {
+        Real const* primals = tape.getPrimalVector();
+        values.assign(primals, primals + tape.getParameter(TapeParameters::PrimalSize));
+
+        size_t blockCount = getBlockCount();
+        dirtyBitmap.assign((blockCount + BitsPerWord - 1) / BitsPerWord, 0);
+        dirtyBlocks.clear();
+
+        bool complete = tape.iterateRevertedPrimals(start, end, [this](Identifier const& identifier) {
+          codiAssert((size_t)identifier < values.size());
+
+          size_t block = (size_t)identifier / BlockSize;
+          dirtyBitmap[block / BitsPerWord] |= (uint64_t)1 << (block % BitsPerWord);
+        });
+
+        if (!complete) {
+          std::fill(dirtyBitmap.begin(), dirtyBitmap.end(), ~(uint64_t)0);
+        }
+
+        for (size_t word = 0; word < dirtyBitmap.size(); word += 1) {
+          if (0 != dirtyBitmap[word]) {
+            for (size_t bit = 0; bit < BitsPerWord; bit += 1) {
+              size_t block = word * BitsPerWord + bit;
+              if (block < blockCount && 0 != (dirtyBitmap[word] & ((uint64_t)1 << bit))) {
+                dirtyBlocks.push_back(block);
+              }
+            }
+          }
+        }
+      }
+
+      /// Capture the primal vector of the tape and mark the blocks that a reverse evaluation of the whole tape
+      /// reverts.
+      void capture(Tape& tape) {
+        capture(tape, tape.getPosition(), tape.getZeroPosition());
+      }
+
+      /// Set primals to the captured primal values. Resizes the vector if required.
+      void initialize(std::vector<Real>& primals) const {
+        primals.assign(values.begin(), values.end());
+      }
+
+      /// Copy the marked blocks into primals. primals needs to have the size of the captured primal vector.
+      void restore(Real* primals) const {
+        for (size_t block : dirtyBlocks) {
+          size_t begin = block * BlockSize;
+          size_t end = std::min(begin + BlockSize, values.size());
+
+          std::copy(values.begin() + begin, values.begin() + end, &primals[begin]);
+        }
+      }
+
+      /// Copy the marked blocks into the primal vector of the tape.
+      void restore(Tape& tape) const {
+        restore(tape.getPrimalVector());
+      }
+
+      /// Captured primal values.
+      std::vector<Real> const& getValues() const {
+        return values;
+      }
+
+      /// Number of blocks of the captured primal vector.
+      size_t getBlockCount() const {
+        return (values.size() + BlockSize - 1) / BlockSize;
+      }
+
+      /// Number of blocks that restore() copies.
+      size_t getDirtyBlockCount() const {
+        return dirtyBlocks.size();
+      }
+  };
+}
@@ -0,0 +1,653 @@
+/*
+ * CoDiPack, a Code Differentiation Package
+ *
+ * Copyright (C) 2015-2026 Chair for Scientific Computing (SciComp), RPTU University Kaiserslautern-Landau
+ * Homepage: http://scicomp.rptu.de
+ * Contact:  Prof. Nicolas R. Gauger (codi@scicomp.uni-kl.de)
+ *
+ * Lead developers: Max Sagebaum, Johannes Blühdorn (SciComp, RPTU University Kaiserslautern-Landau)
+ *
+ * This file is part of CoDiPack (http://scicomp.rptu.de/software/codi).
+ *
+ * CoDiPack is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * CoDiPack is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * See the GNU General Public License for more details.
+ * You should have received a copy of the GNU
+ * General Public License along with CoDiPack.
+ * If not, see <http://www.gnu.org/licenses/>.
+ *
+ * For other licensing options please contact us.
+ *
+ * Authors:
+ *  - SciComp, RPTU University Kaiserslautern-Landau:
+ *    - Max Sagebaum
+ *    - Johannes Blühdorn
+ *    - Former members:
+ *      - Tim Albring
+ */
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <vector>
+
+#include "../../config.h"
+#include "../../misc/macros.hpp"
+#include "../../tapes/misc/adjointVectorAccess.hpp"
+#include "../../traits/adjointVectorTraits.hpp"
+#include "../../traits/atomicTraits.hpp"
+#include "../../traits/gradientTraits.hpp"
+#include "../../traits/realTraits.hpp"
+
+/** \copydoc codi::Namespace */
+namespace codi {
+
+  template<typename T_Real, size_t T_maxDim>
+  struct RuntimeDirection;
+
+  /**
+   * @brief Lazy product of a scalar and the entries of a runtime direction.
+   *
+   * Created by the multiplication operators of RuntimeDirection and RuntimeDirectionRef. Consumed by the update
+   * operators, which perform a fused multiply-add without temporary directions.
+   *
+   * @tparam T_Real  Type of the vector entries.
+   */
+  template<typename T_Real>
+  struct RuntimeDirectionScaled {
+    public:
+
+      using Real = CODI_DD(T_Real, double);  ///< See RuntimeDirectionScaled.
+
+      Real factor;         ///< Scalar factor.
+      Real const* values;  ///< Entries of the direction.
+      size_t size;         ///< Number of entries. Zero represents the zero direction.
+  };
+
+  /**
+   * @brief Reference to one row of a RuntimeDirectionAdjoints block.
+   *
+   * Returned by the access operator of RuntimeDirectionAdjoints. Assignments and updates write directly into the
+   * contiguous adjoint block.
+   *
+   * @tparam T_Real    Type of the vector entries.
+   * @tparam T_maxDim  Maximum dimension of the vector mode, see RuntimeDirection.
+   */
+  template<typename T_Real, size_t T_maxDim>
+  struct RuntimeDirectionRef {
+    public:
+
+      using Real = CODI_DD(T_Real, double);              ///< See RuntimeDirectionRef.
+      static size_t constexpr maxDim = T_maxDim;         ///< See RuntimeDirectionRef.
+      using Direction = RuntimeDirection<Real, maxDim>;  ///< Value type of the row.
+
+      Real* values;  ///< Start of the row in the adjoint block.
+      size_t size;   ///< Dimension of the row.
+
+      /// Constructor
+      CODI_INLINE RuntimeDirectionRef(Real* values, size_t size) : values(values), size(size) {}
+
+      /// Copy constructor, references the same row.
+      RuntimeDirectionRef(RuntimeDirectionRef const& other) = default;
+
+      /// Per reference element access.
+      CODI_INLINE Real& operator[](size_t const& i) const {
+        return values[i];
+      }
+
+      /// Assign a direction. A direction without entries resets the row.
+      CODI_INLINE RuntimeDirectionRef const& operator=(Direction const& v) const {
+        if (0 == v.getDimension()) {
+          for (size_t i = 0; i < size; ++i) {
+            values[i] = Real();
+          }
+        } else {
+          codiAssert(v.getDimension() == size);
+          for (size_t i = 0; i < size; ++i) {
+            values[i] = v[i];
+          }
+        }
+
+        return *this;
+      }
+
+      /// Assign the entries of another row.
+      CODI_INLINE RuntimeDirectionRef const& operator=(RuntimeDirectionRef const& other) const {
+        codiAssert(other.size == size);
+        for (size_t i = 0; i < size; ++i) {
+          values[i] = other.values[i];
+        }
+
+        return *this;
+      }
+
+      /// Set all entries to the given value.
+      CODI_INLINE RuntimeDirectionRef const& operator=(Real const& s) const {
+        for (size_t i = 0; i < size; ++i) {
+          values[i] = s;
+        }
+
+        return *this;
+      }
+
+      /// Fused multiply-add update.
+      CODI_INLINE RuntimeDirectionRef const& operator+=(RuntimeDirectionScaled<Real> const& v) const {
+        if (0 != v.size) {
+          codiAssert(v.size == size);
+          Real* CODI_RESTRICT const target = values;
+          Real const* CODI_RESTRICT const source = v.values;
+          for (size_t i = 0; i < size; ++i) {
+            target[i] += v.factor * source[i];
+          }
+        }
+
+        return *this;
+      }
+
+      /// Update operator.
+      CODI_INLINE RuntimeDirectionRef const& operator+=(Direction const& v) const {
+        if (0 != v.getDimension()) {
+          codiAssert(v.getDimension() == size);
+          Real* CODI_RESTRICT const target = values;
+          Real const* CODI_RESTRICT const source = &v[0];
+          for (size_t i = 0; i < size; ++i) {
+            target[i] += source[i];
+          }
+        }
+
+        return *this;
+      }
+  };
+
+  /**
+   * @brief Vector mode direction whose dimension is chosen at runtime.
+   *
+   * Used as the entry type of RuntimeDirectionAdjoints. The entries are stored inline up to the capacity T_maxDim, only
+   * the first getDimension() entries are used. Copies and updates only touch the used entries, no heap memory is
+   * involved. A default constructed direction has dimension zero and represents the zero direction of any dimension.
+   *
+   * The type is not intended as the gradient type of active CoDiPack types. It is used with custom adjoint vectors,
+   * see RuntimeDirectionAdjoints.
+   *
+   * @tparam T_Real    Type of the vector entries.
+   * @tparam T_maxDim  Maximum dimension of the vector mode.
+   */
+  template<typename T_Real, size_t T_maxDim>
+  struct RuntimeDirection {
+    public:
+
+      using Real = CODI_DD(T_Real, double);       ///< See RuntimeDirection.
+      static size_t constexpr maxDim = T_maxDim;  ///< See RuntimeDirection.
+
+      using Ref = RuntimeDirectionRef<Real, maxDim>;  ///< Reference type of RuntimeDirectionAdjoints rows.
+
+    protected:
+      size_t size;
+      Real vector[maxDim];
+
+    public:
+
+      /// Constructor, creates the zero direction.
+      CODI_INLINE RuntimeDirection() : size(0) {}
+
+      /// Constructor, creates a direction with the given dimension and all entries set to s.
+      CODI_INLINE RuntimeDirection(size_t dim, Real const& s) : size(dim) {
+        codiAssert(dim <= maxDim);
+        for (size_t i = 0; i < size; ++i) {
+          vector[i] = s;
+        }
+      }
+
+      /// Constructor
+      CODI_INLINE RuntimeDirection(RuntimeDirection const& v) : size(v.size) {
+        for (size_t i = 0; i < size; ++i) {
+          vector[i] = v.vector[i];
+        }
+      }
+
+      /// Constructor, copies the entries of an adjoint row.
+      CODI_INLINE RuntimeDirection(Ref const& v) : size(v.size) {
+        codiAssert(size <= maxDim);
+        for (size_t i = 0; i < size; ++i) {
+          vector[i] = v.values[i];
+        }
+      }
+
+      /// Number of used entries.
+      CODI_INLINE size_t getDimension() const {
+        return size;
+      }
+
+      /// Per reference element access.
+      CODI_INLINE Real& operator[](size_t const& i) {
+        return vector[i];
+      }
+
+      /// Per value element access.
+      CODI_INLINE Real const& operator[](size_t const& i) const {
+        return vector[i];
+      }
+
+      /// Assignment operator.
+      CODI_INLINE RuntimeDirection& operator=(RuntimeDirection const& v) {
+        size = v.size;
+        for (size_t i = 0; i < size; ++i) {
+          vector[i] = v.vector[i];
+        }
+
+        return *this;
+      }
+
+      /// Fused multiply-add update. A zero direction takes over the dimension of the update.
+      CODI_INLINE RuntimeDirection& operator+=(RuntimeDirectionScaled<Real> const& v) {
+        if (0 == size) {
+          size = v.size;
+          for (size_t i = 0; i < size; ++i) {
+            vector[i] = v.factor * v.values[i];
+          }
+        } else if (0 != v.size) {
+          codiAssert(v.size == size);
+          for (size_t i = 0; i < size; ++i) {
+            vector[i] += v.factor * v.values[i];
+          }
+        }
+
+        return *this;
+      }
+
+      /// Update operator. A zero direction takes over the dimension of the update.
+      CODI_INLINE RuntimeDirection& operator+=(RuntimeDirection const& v) {
+        if (0 == size) {
+          *this = v;
+        } else if (0 != v.size) {
+          codiAssert(v.size == size);
+          for (size_t i = 0; i < size; ++i) {
+            vector[i] += v.vector[i];
+          }
+        }
+
+        return *this;
+      }
+  };
+
+  template<typename Real, size_t maxDim>
+  size_t constexpr RuntimeDirection<Real, maxDim>::maxDim;
+
+  template<typename Real, size_t maxDim>
+  size_t constexpr RuntimeDirectionRef<Real, maxDim>::maxDim;
+
+  /// Multiplication with a scalar. Evaluated lazily by the update operators.
+  template<typename Real, size_t maxDim>
+  CODI_INLINE RuntimeDirectionScaled<Real> operator*(Real const& s, RuntimeDirection<Real, maxDim> const& v) {
+    return RuntimeDirectionScaled<Real>{s, &v[0], v.getDimension()};
+  }
+
+  /// Multiplication with a scalar. Evaluated lazily by the update operators.
+  template<typename Real, size_t maxDim>
+  CODI_INLINE RuntimeDirectionScaled<Real> operator*(Real const& s, RuntimeDirectionRef<Real, maxDim> const& v) {
+    return RuntimeDirectionScaled<Real>{s, v.values, v.size};
+  }
+
+  /**
+   * @brief Adjoint vector for vector mode evaluations whose dimension is chosen at runtime.
+   *
+   * All adjoints are stored in one contiguous, row-major block of size() * getDimension() entries that is owned by this
+   * object. There is no memory allocation per entry and the update loops run over contiguous memory. The access
+   * operator returns a RuntimeDirectionRef to the row of an identifier, the entry type is RuntimeDirection.
+   *
+   * Can be used as custom adjoints for the evaluation of Jacobian tapes, see
+   * CustomAdjointVectorEvaluationTapeInterface, and for Jacobian computations with custom adjoints, see
+   * Algorithms::computeJacobianCustomAdjoints(). In the latter case, getDimension() directions are evaluated per tape
+   * sweep.
+   *
+   * The user is responsible for providing an adequate size, usually the largest created identifier plus one. No bounds
+   * checking is performed.
+   *
+   * @tparam T_Real    Type of the vector entries, usually chosen as Tape::Real.
+   * @tparam T_maxDim  Maximum dimension of the vector mode, see RuntimeDirection.
+   */
+  template<typename T_Real, size_t T_maxDim = 64>
+  struct RuntimeDirectionAdjoints {
+    public:
+
+      using Real = CODI_DD(T_Real, double);       ///< See RuntimeDirectionAdjoints.
+      static size_t constexpr maxDim = T_maxDim;  ///< See RuntimeDirectionAdjoints.
+
+      using value_type = RuntimeDirection<Real, maxDim>;  ///< Entry type.
+      using Ref = RuntimeDirectionRef<Real, maxDim>;      ///< Row reference type.
+
+    protected:
+
+      size_t dim;                ///< Number of entries per row.
+      size_t rows;               ///< Number of rows.
+      std::vector<Real> values;  ///< Row-major adjoint block.
+
+    public:
+
+      /// Constructor
+      RuntimeDirectionAdjoints(size_t dim, size_t size = 0) : dim(dim), rows(size), values(dim * size) {
+        codiAssert(0 < dim && dim <= maxDim);
+      }
+
+      /// Access operator, returns a reference to the row of the identifier.
+      template<typename Identifier>
+      CODI_INLINE Ref operator[](Identifier const& identifier) const {
+        return Ref(const_cast<Real*>(&values[(size_t)identifier * dim]), dim);
+      }
+
+      /// Number of entries per row.
+      CODI_INLINE size_t getDimension() const {
+        return dim;
+      }
+
+      /// Number of rows.
+      CODI_INLINE size_t size() const {
+        return rows;
+      }
+
+      /// Pointer to the adjoint block.
+      CODI_INLINE Real* data() {
+        return values.data();
+      }
+
+      /// Change the number of rows. New rows are zero.
+      void resize(size_t size) {
+        rows = size;
+        values.resize(dim * size);
+      }
+
+      /// Change the number of entries per row. All entries are reset to zero, the memory is reused if possible.
+      void setDimension(size_t newDim) {
+        codiAssert(0 < newDim && newDim <= maxDim);
+        dim = newDim;
+        values.assign(dim * rows, Real());
+      }
+
+      /// Set all entries to zero.
+      void setZero() {
+        std::fill(values.begin(), values.end(), Real());
+      }
+  };
+
+  template<typename Real, size_t maxDim>
+  size_t constexpr RuntimeDirectionAdjoints<Real, maxDim>::maxDim;
+
+  /**
+   * @brief Specialization of AdjointVectorAccess for RuntimeDirectionAdjoints.
+   *
+   * Works on the rows of the adjoint block. The temporary storage for indirect access is allocated on first use with
+   * the runtime dimension.
+   *
+   * @tparam T_Real        The computation type of a tape, usually chosen as ActiveType::Real.
+   * @tparam T_Identifier  The adjoint/tangent identification of a tape, usually chosen as ActiveType::Identifier.
+   * @tparam T_AdjReal     See RuntimeDirectionAdjoints.
+   * @tparam T_maxDim      See RuntimeDirectionAdjoints.
+   */
+  template<typename T_Real, typename T_Identifier, typename T_AdjReal, size_t T_maxDim>
+  struct AdjointVectorAccess<T_Real, T_Identifier, RuntimeDirectionAdjoints<T_AdjReal, T_maxDim>&>
+      : public VectorAccessInterface<T_Real, T_Identifier> {
+    public:
+      using Real = CODI_DD(T_Real, double);                                 ///< See AdjointVectorAccess.
+      using Identifier = CODI_DD(T_Identifier, int);                        ///< See AdjointVectorAccess.
+      using AdjointVector = RuntimeDirectionAdjoints<T_AdjReal, T_maxDim>;  ///< See AdjointVectorAccess.
+      using AdjReal = typename AdjointVector::Real;                         ///< Type of the adjoint entries.
+
+    protected:
+
+      AdjointVector& adjointVector;  ///< Reference to the adjoint block.
+
+    private:
+
+      std::vector<AdjReal> lhs;  ///< Temporary storage for indirect adjoint or tangent updates.
+      size_t lhsPos;             ///< Defines which lhs is currently used.
+
+      std::vector<Real> buffer;  ///< Temporary storage for getAdjointVec.
+
+      CODI_INLINE AdjReal* curLhs() {
+        if (lhs.empty()) {
+          lhs.resize(Config::MaxArgumentSize * getVectorSize());
+        }
+        return &lhs[lhsPos * getVectorSize()];
+      }
+
+    public:
+
+      /// Constructor.
+      AdjointVectorAccess(AdjointVector& adjointVector) : adjointVector(adjointVector), lhs(), lhsPos(0), buffer() {}
+
+      /*******************************************************************************/
+      /// @name Misc
+
+      /// \copydoc codi::VectorAccessInterface::getVectorSize
+      size_t getVectorSize() const {
+        return adjointVector.getDimension();
+      }
+
+      /// \copydoc codi::VectorAccessInterface::isLhsZero
+      bool isLhsZero() const {
+        if (lhs.empty()) {
+          return true;
+        }
+
+        AdjReal const* const cur = &lhs[lhsPos * getVectorSize()];
+        for (size_t i = 0; i < getVectorSize(); ++i) {
+          if (!RealTraits::isTotalZero(cur[i])) {
+            return false;
+          }
+        }
+        return true;
+      }
+
+      /// \copydoc codi::VectorAccessInterface::clone
+      VectorAccessInterface<Real, Identifier>* clone() const {
+        return new AdjointVectorAccess(this->adjointVector);
+      }
+
+      /*******************************************************************************/
+      /// @name Indirect adjoint access
+
+      /// \copydoc codi::VectorAccessInterface::setLhsAdjoint
+      void setLhsAdjoint(Identifier const& index) {
+        AdjReal* const cur = curLhs();
+        AdjReal* const row = adjointVector[index].values;
+        for (size_t i = 0; i < getVectorSize(); ++i) {
+          cur[i] = row[i];
+          row[i] = AdjReal();
+        }
+      }
+
+      /// \copydoc codi::VectorAccessInterface::updateAdjointWithLhs
+      void updateAdjointWithLhs(Identifier const& index, Real const& jacobian) {
+        AdjReal const* const cur = curLhs();
+        AdjReal* const row = adjointVector[index].values;
+        for (size_t i = 0; i < getVectorSize(); ++i) {
+          row[i] += jacobian * cur[i];
+        }
+      }
+
+      /*******************************************************************************/
+      /// @name Indirect tangent access
+
+      /// \copydoc codi::VectorAccessInterface::setLhsTangent
+      void setLhsTangent(Identifier const& index) {
+        AdjReal* const cur = curLhs();
+        AdjReal* const row = adjointVector[index].values;
+        for (size_t i = 0; i < getVectorSize(); ++i) {
+          row[i] = cur[i];
+          cur[i] = AdjReal();
+        }
+      }
+
+      /// \copydoc codi::VectorAccessInterface::updateTangentWithLhs
+      void updateTangentWithLhs(Identifier const& index, Real const& jacobian) {
+        AdjReal* const cur = curLhs();
+        AdjReal const* const row = adjointVector[index].values;
+        for (size_t i = 0; i < getVectorSize(); ++i) {
+          cur[i] += jacobian * row[i];
+        }
+      }
+
+      /*******************************************************************************/
+      /// @name Indirect adjoint/tangent access for functions with multiple outputs
+
+      /// \copydoc codi::VectorAccessInterface::setActiveVariableForIndirectAccess
+      void setActiveVariableForIndirectAccess(size_t pos) {
+        codiAssert(pos < Config::MaxArgumentSize);
+        lhsPos = pos;
+      }
+
+      /*******************************************************************************/
+      /// @name Direct adjoint access
+
+      /// \copydoc codi::VectorAccessInterface::resetAdjoint
+      void resetAdjoint(Identifier const& index, size_t dim) {
+        adjointVector[index][dim] = AdjReal();
+      }
+
+      /// \copydoc codi::VectorAccessInterface::resetAdjointVec
+      void resetAdjointVec(Identifier const& index) {
+        adjointVector[index] = AdjReal();
+      }
+
+      /// \copydoc codi::VectorAccessInterface::getAdjoint
+      Real getAdjoint(Identifier const& index, size_t dim) {
+        return (Real)adjointVector[index][dim];
+      }
+
+      /// \copydoc codi::VectorAccessInterface::getAdjointVec
+      void getAdjointVec(Identifier const& index, Real* const vec) {
+        AdjReal const* const row = adjointVector[index].values;
+        for (size_t i = 0; i < getVectorSize(); ++i) {
+          vec[i] = (Real)row[i];
+        }
+      }
+
+      /// \copydoc codi::VectorAccessInterface::getAdjointVec
+      Real const* getAdjointVec(Identifier const& index) {
+        buffer.resize(getVectorSize());
+        getAdjointVec(index, buffer.data());
+        return buffer.data();
+      }
+
+      /// \copydoc codi::VectorAccessInterface::updateAdjoint
+      void updateAdjoint(Identifier const& index, size_t dim, Real const& adjoint) {
+        adjointVector[index][dim] += adjoint;
+      }
+
+      /// \copydoc codi::VectorAccessInterface::updateAdjointVec
+      void updateAdjointVec(Identifier const& index, Real const* const vec) {
+        AdjReal* const row = adjointVector[index].values;
+        for (size_t i = 0; i < getVectorSize(); ++i) {
+          row[i] += vec[i];
+        }
+      }
+
+      /*******************************************************************************/
+      /// @name Primal access
+
+      /// \copydoc codi::VectorAccessInterface::setPrimal <br><br>
+      /// Implementation: Not implemented, empty function.
+      void setPrimal(Identifier const& index, Real const& primal) {
+        CODI_UNUSED(index, primal);
+      }
+
+      /// \copydoc codi::VectorAccessInterface::getPrimal <br><br>
+      /// Implementation: Not implemented, returns zero.
+      Real getPrimal(Identifier const& index) {
+        CODI_UNUSED(index);
+
+        return Real();
+      }
+
+      /// \copydoc codi::VectorAccessInterface::setPrimal <br><br>
+      /// Implementation: Always returns false.
+      bool hasPrimals() {
+        return false;
+      }
+  };
+
+#ifndef DOXYGEN_DISABLE
+  template<typename T_Real, size_t T_maxDim>
+  struct RealTraits::IsTotalZero<RuntimeDirection<T_Real, T_maxDim>> {
+    public:
+
+      using Type = RuntimeDirection<T_Real, T_maxDim>;
+
+      static CODI_INLINE bool isTotalZero(Type const& v) {
+        for (size_t i = 0; i < v.getDimension(); ++i) {
+          if (!codi::RealTraits::isTotalZero(v[i])) {
+            return false;
+          }
+        }
+        return true;
+      }
+  };
+
+  template<typename T_Real, size_t T_maxDim>
+  struct RealTraits::IsTotalFinite<RuntimeDirection<T_Real, T_maxDim>> {
+    public:
+
+      using Type = RuntimeDirection<T_Real, T_maxDim>;
+
+      static CODI_INLINE bool isTotalFinite(Type const& v) {
+        for (size_t i = 0; i < v.getDimension(); ++i) {
+          if (!codi::RealTraits::isTotalFinite(v[i])) {
+            return false;
+          }
+        }
+        return true;
+      }
+  };
+
+  namespace GradientTraits {
+
+    template<typename T_Real, size_t T_maxDim>
+    struct TraitsImplementation<RuntimeDirection<T_Real, T_maxDim>> {
+      public:
+
+        using Gradient = RuntimeDirection<T_Real, T_maxDim>;
+        using Ref = typename Gradient::Ref;
+        using Real = T_Real;
+
+        static size_t constexpr dim = T_maxDim;
+
+        CODI_INLINE static Real& at(Gradient& gradient, size_t dim) {
+          return gradient[dim];
+        }
+
+        CODI_INLINE static Real const& at(Gradient const& gradient, size_t dim) {
+          return gradient[dim];
+        }
+
+        CODI_INLINE static Real& at(Ref const& gradient, size_t dim) {
+          return gradient[dim];
+        }
+
+        CODI_INLINE static std::array<AtomicTraits::RemoveAtomic<Real>, dim> toArray(Gradient const& gradient) {
+          std::array<AtomicTraits::RemoveAtomic<Real>, dim> result = {};
+          for (size_t i = 0; i < gradient.getDimension(); ++i) {
+            result[i] = at(gradient, i);
+          }
+          return result;
+        }
+    };
+  }
+
+  namespace AdjointVectorTraits {
+    template<typename T_Real, size_t T_maxDim>
+    struct VectorSizeImplementation<RuntimeDirectionAdjoints<T_Real, T_maxDim>> {
+      public:
+        static size_t get(RuntimeDirectionAdjoints<T_Real, T_maxDim> const& adjoints) {
+          return adjoints.getDimension();
+        }
+    };
+  }
+#endif
+}
@@ -0,0 +1,205 @@
+/*
+ * CoDiPack, a Code Differentiation Package
+ *
+ * Copyright (C) 2015-2026 Chair for Scientific Computing (SciComp), RPTU University Kaiserslautern-Landau
+ * Homepage: http://scicomp.rptu.de
+ * Contact:  Prof. Nicolas R. Gauger (codi@scicomp.uni-kl.de)
+ *
+ * Lead developers: Max Sagebaum, Johannes Blühdorn (SciComp, RPTU University Kaiserslautern-Landau)
+ *
+ * This file is part of CoDiPack (http://scicomp.rptu.de/software/codi).
+ *
+ * CoDiPack is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * CoDiPack is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * See the GNU General Public License for more details.
+ * You should have received a copy of the GNU
+ * General Public License along with CoDiPack.
+ * If not, see <http://www.gnu.org/licenses/>.
+ *
+ * For other licensing options please contact us.
+ *
+ * Authors:
+ *  - SciComp, RPTU University Kaiserslautern-Landau:
+ *    - Max Sagebaum
+ *    - Johannes Blühdorn
+ *    - Former members:
+ *      - Tim Albring
+ */
+#pragma once
+
+#include <vector>
+
+#include "../../config.h"
+#include "../../expressions/lhsExpressionInterface.hpp"
+#include "../../misc/exceptions.hpp"
+#include "../../misc/macros.hpp"
+#include "../../tapes/interfaces/fullTapeInterface.hpp"
+#include "../../tapes/misc/externalFunction.hpp"
+#include "../../tapes/misc/vectorAccessInterface.hpp"
+
+/** \copydoc codi::Namespace */
+namespace codi {
+
+  /**
+   * @brief Overlaps the completion of external functions with the reverse evaluation of independent statements.
+   *
+   * The typical use case is the adjoint communication of halo exchanges. In the reverse sweep, an external function
+   * for a send has to receive the adjoints of the sent values and add them to the adjoints of these values. The
+   * statements that were recorded between the computation of the sent values and the send do not depend on these
+   * adjoints, so the receive only needs to be completed before the reverse sweep reaches the statements that computed
+   * the sent values.
+   *
+   * The helper records two kinds of entries on the tape:
+   *  - A dependency cut, recorded with addCut(). It has to be recorded after all values that are used by the
+   *    following asynchronous functions have been computed.
+   *  - An asynchronous function, recorded with pushAsyncFunction(). In the reverse sweep, its start function is called
+   *    when the sweep reaches the entry, e.g., to post the adjoint receives and sends. Its finish function is called
+   *    when the sweep reaches the cut, e.g., to wait for the communication and update the adjoints.
+   *
+   * The finish functions of a cut are called in the order in which the asynchronous functions have been started.
+   * Finish functions may only add to adjoints, since the statements between the cut and the asynchronous function have
+   * already been evaluated. A reverse evaluation that contains an asynchronous function has to contain its cut, too.
+   *
+   * The helper only supports reverse evaluations. Forward and primal evaluations of a tape with these entries throw an
+   * exception.
+   *
+   * \snippet examples/Example_37_Overlapping_adjoint_communication.cpp Async functions
+   *
+   * @tparam T_Type  The CoDiPack type on which the evaluations take place.
+   */
+  template<typename T_Type>
+  struct AsyncReverseHelper {
+    public:
+
+      /// See AsyncReverseHelper.
+      using Type = CODI_DD(T_Type, CODI_DEFAULT_LHS_EXPRESSION);
+
+      using Real = typename Type::Real;                               ///< See LhsExpressionInterface.
+      using Identifier = typename Type::Identifier;                   ///< See LhsExpressionInterface.
+      using Tape = CODI_DD(typename Type::Tape, CODI_DEFAULT_TAPE);  ///< See LhsExpressionInterface.
+
+      using VectorAccess = VectorAccessInterface<Real, Identifier>;  ///< See VectorAccessInterface.
+
+      /// Start and finish function of an asynchronous function.
+      using CallFunction = typename ExternalFunction<Tape>::CallFunction;
+      /// Deletion function for the user data.
+      using DeleteFunction = typename ExternalFunction<Tape>::DeleteFunction;
+
+      /// Dependency cut on the tape. Owned by the tape.
+      struct Cut {
+        private:
+
+          friend struct AsyncReverseHelper;
+
+          struct Pending {
+              CallFunction finish;
+              void* data;
+          };
+
+          std::vector<Pending> pending;  ///< Started functions that are not yet finished.
+      };
+
+    private:
+
+      struct AsyncData {
+          CallFunction start;
+          CallFunction finish;
+          DeleteFunction deleteData;
+          void* data;
+          Cut* cut;
+      };
+
+    public:
+
+      /**
+       * @brief Record a dependency cut.
+       *
+       * @return The cut for the following calls of pushAsyncFunction(). It is deleted together with the tape entry.
+       *         nullptr if the tape is not active.
+       */
+      static Cut* addCut() {
+        Tape& tape = Type::getTape();
+        if (!tape.isActive()) {
+          return nullptr;
+        }
+
+        Cut* cut = new Cut();
+        tape.pushExternalFunction(ExternalFunction<Tape>::create(evaluateCut, cut, deleteCut));
+
+        return cut;
+      }
+
+      /**
+       * @brief Record an asynchronous function.
+       *
+       * If the tape is not active, nothing is recorded and \c data is deleted directly.
+       *
+       * @param cut         The cut at which the function is finished. It has to be recorded before with addCut().
+       * @param start       Called when the reverse sweep reaches this entry.
+       * @param finish      Called when the reverse sweep reaches the cut.
+       * @param data        User data for the start, finish and delete functions.
+       * @param deleteData  Called when the tape entry is deleted. Can be nullptr.
+       */
+      static void pushAsyncFunction(Cut* cut, CallFunction start, CallFunction finish, void* data,
+                                    DeleteFunction deleteData = nullptr) {
+        Tape& tape = Type::getTape();
+        if (!tape.isActive()) {
+          if (nullptr != deleteData) {
+            deleteData(&tape, data);
+          }
+          return;
+        }
+
+        if (nullptr == cut) {
+          CODI_EXCEPTION("Asynchronous functions require a cut that has been recorded on the active tape.");
+        }
+
+        AsyncData* asyncData = new AsyncData{start, finish, deleteData, data, cut};
+        tape.pushExternalFunction(ExternalFunction<Tape>::create(evaluateAsync, asyncData, deleteAsync));
+      }
+
+    private:
+
+      static void evaluateAsync(Tape* tape, void* d, VectorAccess* adjointInterface) {
+        AsyncData* asyncData = static_cast<AsyncData*>(d);
+
+        if (nullptr != asyncData->start) {
+          asyncData->start(tape, asyncData->data, adjointInterface);
+        }
+        asyncData->cut->pending.push_back({asyncData->finish, asyncData->data});
+      }
+
+      static void deleteAsync(Tape* tape, void* d) {
+        AsyncData* asyncData = static_cast<AsyncData*>(d);
+
+        if (nullptr != asyncData->deleteData) {
+          asyncData->deleteData(tape, asyncData->data);
+        }
+        delete asyncData;
+      }
+
+      static void evaluateCut(Tape* tape, void* d, VectorAccess* adjointInterface) {
+        Cut* cut = static_cast<Cut*>(d);
+
+        for (typename Cut::Pending& pending : cut->pending) {
+          if (nullptr != pending.finish) {
+            pending.finish(tape, pending.data, adjointInterface);
+          }
+        }
+        cut->pending.clear();
+      }
+
+      static void deleteCut(Tape* tape, void* d) {
+        CODI_UNUSED(tape);
+
+        delete static_cast<Cut*>(d);
+      }
+  };
+}
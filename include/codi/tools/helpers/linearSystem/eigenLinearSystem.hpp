@@ -245,6 +245,76 @@ namespace codi {
         *t = *b_d - *A_d * *x;
       }
 
+      /// @}
+
+    protected:
+
+      /// Solves for all right hand sides at once with an Eigen decomposition or a transposed view of it.
+      template<typename Solver>
+      static void solveMultiple(Solver const& solver, std::vector<VectorReal*> const& b,
+                                std::vector<VectorReal*> const& x) {
+        using Real = typename InterfaceTypes::Real;
+        using MultiVectorReal = Eigen::Matrix<Real, Eigen::Dynamic, Eigen::Dynamic>;
+
+        if (b.empty()) {
+          return;
+        }
+
+        MultiVectorReal rhs(b[0]->size(), b.size());
+        for (size_t i = 0; i < b.size(); i += 1) {
+          rhs.col(i) = *b[i];
+        }
+
+        MultiVectorReal sol = solver.solve(rhs);
+        for (size_t i = 0; i < x.size(); i += 1) {
+          *x[i] = sol.col(i);
+        }
+      }
+  };
+
+  /// Eigen implementation of LinearSystemInterface for dense matrices based on a partial pivoting LU decomposition.
+  /// The decomposition from the primal solve is reused in all AD solves. No methods have to be implemented by the user.
+  template<typename T_Type, template<typename> class T_Matrix, template<typename> class T_Vector>
+  struct EigenLinearSystemLU : public EigenLinearSystem<T_Type, T_Matrix, T_Vector> {
+    public:
+      using Base = EigenLinearSystem<T_Type, T_Matrix, T_Vector>;  ///< Base class abbreviation.
+
+      using MatrixReal = typename Base::MatrixReal;  ///< See LinearSystemInterfaceTypes.
+      using VectorReal = typename Base::VectorReal;  ///< See LinearSystemInterfaceTypes.
+
+      using Factorization = Eigen::PartialPivLU<MatrixReal>;  ///< See LinearSystemInterface.
+
+      /// \copydoc codi::LinearSystemInterface::solveSystem
+      void solveSystem(MatrixReal const* A, VectorReal const* b, VectorReal* x) {
+        *x = A->partialPivLu().solve(*b);
+      }
+
+      /*******************************************************************************/
+      /// @name Implementation for the reuse of a factorization.
+      /// @{
+
+      /// \copydoc codi::LinearSystemInterface::factorize
+      Factorization* factorize(MatrixReal const* A) {
+        return new Factorization(*A);
+      }
+
+      /// \copydoc codi::LinearSystemInterface::deleteFactorization
+      void deleteFactorization(Factorization* factorization) {
+        delete factorization;
+      }
+
+      /// \copydoc codi::LinearSystemInterface::solveWithFactorization
+      void solveWithFactorization(Factorization const* factorization, std::vector<VectorReal*> const& b,
+                                  std::vector<VectorReal*> const& x) {
+        Base::solveMultiple(*factorization, b, x);
+      }
+
+      /// \copydoc codi::LinearSystemInterface::solveTransposedWithFactorization
+      void solveTransposedWithFactorization(Factorization const* factorization, std::vector<VectorReal*> const& b,
+                                            std::vector<VectorReal*> const& x) {
+        Base::solveMultiple(factorization->transpose(), b, x);
+      }
+
       /// @}
   };
 
@@ -373,6 +443,108 @@ namespace codi {
 
       /// @}
   };
+
+  /// Eigen implementation of LinearSystemInterface for sparse matrices based on the iterative BiCGSTAB solver. The
+  /// tolerance and the maximum number of iterations are taken from the hints. Use the hint WarmStart to start the AD
+  /// solves from the solutions of the last tape evaluation. No methods have to be implemented by the user.
+  template<typename T_Type, template<typename> class T_Matrix, template<typename> class T_Vector>
+  struct SparseEigenLinearSystemIterative : public SparseEigenLinearSystem<T_Type, T_Matrix, T_Vector> {
+    public:
+      using Base = SparseEigenLinearSystem<T_Type, T_Matrix, T_Vector>;  ///< Base class abbreviation.
+
+      using MatrixReal = typename Base::MatrixReal;  ///< See LinearSystemInterfaceTypes.
+      using VectorReal = typename Base::VectorReal;  ///< See LinearSystemInterfaceTypes.
+
+      using Solver = Eigen::BiCGSTAB<MatrixReal>;  ///< Iterative solver of Eigen.
+
+      /// \copydoc codi::LinearSystemInterface::solveSystem
+      void solveSystem(MatrixReal const* A, VectorReal const* b, VectorReal* x) {
+        x->setZero();
+        solveSystemIterative(A, b, x, 0.0, 0);
+      }
+
+      /*******************************************************************************/
+      /// @name Implementation for iterative solvers.
+      /// @{
+
+      /// \copydoc codi::LinearSystemInterface::solveSystemIterative
+      int solveSystemIterative(MatrixReal const* A, VectorReal const* b, VectorReal* x, double tolerance,
+                               int maxIterations) {
+        Solver solver;
+        if (0.0 != tolerance) {
+          solver.setTolerance(tolerance);
+        }
+        if (0 != maxIterations) {
+          solver.setMaxIterations(maxIterations);
+        }
+
+        solver.compute(*A);
+        *x = solver.solveWithGuess(*b, *x);
+
+        return (int)solver.iterations();
+      }
+
+      /// @}
+  };
+
+  #if EIGEN_VERSION_AT_LEAST(3, 4, 0)
+  /// Eigen implementation of LinearSystemInterface for sparse matrices based on a sparse LU decomposition. The
+  /// decomposition from the primal solve is reused in all AD solves. No methods have to be implemented by the user.
+  template<typename T_Type, template<typename> class T_Matrix, template<typename> class T_Vector>
+  struct SparseEigenLinearSystemLU : public SparseEigenLinearSystem<T_Type, T_Matrix, T_Vector> {
+    public:
+      using Base = SparseEigenLinearSystem<T_Type, T_Matrix, T_Vector>;  ///< Base class abbreviation.
+
+      using MatrixReal = typename Base::MatrixReal;  ///< See LinearSystemInterfaceTypes.
+      using VectorReal = typename Base::VectorReal;  ///< See LinearSystemInterfaceTypes.
+
+      /// See LinearSystemInterface.
+      using Factorization = Eigen::SparseLU<MatrixReal, Eigen::COLAMDOrdering<typename MatrixReal::StorageIndex>>;
+
+      /// \copydoc codi::LinearSystemInterface::solveSystem
+      void solveSystem(MatrixReal const* A, VectorReal const* b, VectorReal* x) {
+        Factorization* factorization = factorize(A);
+        *x = factorization->solve(*b);
+        deleteFactorization(factorization);
+      }
+
+      /*******************************************************************************/
+      /// @name Implementation for the reuse of a factorization.
+      /// @{
+
+      /// \copydoc codi::LinearSystemInterface::factorize
+      Factorization* factorize(MatrixReal const* A) {
+        Factorization* factorization = new Factorization();
+        factorization->compute(*A);
+
+        if (Eigen::Success != factorization->info()) {
+          CODI_EXCEPTION("Sparse LU factorization failed: %s", factorization->lastErrorMessage().c_str());
+        }
+
+        return factorization;
+      }
+
+      /// \copydoc codi::LinearSystemInterface::deleteFactorization
+      void deleteFactorization(Factorization* factorization) {
+        delete factorization;
+      }
+
+      /// \copydoc codi::LinearSystemInterface::solveWithFactorization
+      void solveWithFactorization(Factorization const* factorization, std::vector<VectorReal*> const& b,
+                                  std::vector<VectorReal*> const& x) {
+        Base::solveMultiple(*factorization, b, x);
+      }
+
+      /// \copydoc codi::LinearSystemInterface::solveTransposedWithFactorization
+      void solveTransposedWithFactorization(Factorization const* factorization, std::vector<VectorReal*> const& b,
+                                            std::vector<VectorReal*> const& x) {
+        // The transposed view of SparseLU can only be created from a non-const object.
+        Base::solveMultiple(const_cast<Factorization*>(factorization)->transpose(), b, x);
+      }
+
+      /// @}
+  };
+  #endif
 }
 
 #endif
@@ -51,11 +51,74 @@ namespace codi {
     PrimalEvaluation,
     ProvidePrimalSolution,
     RecomputePrimalInForwardEvaluation,
+    WarmStart,
     MaxElement
   };
 
-  /// All hints for the LinearSystemSolverHelper.
-  using LinearSystemSolverHints = EnumBitset<LinearSystemSolverFlags>;
+  /**
+   * @brief All hints for the LinearSystemSolverHelper.
+   *
+   * In addition to the flags, the hints carry the controls for iterative solvers. A value of zero for the tolerance or
+   * the maximum number of iterations selects the default of the solver.
+   *
+   * \code{.cpp}
+   *   LinearSystemSolverHints hints = LinearSystemSolverHints::ALL();
+   *   hints.setTolerance(1e-12).setMaxIterations(500);
+   * \endcode
+   */
+  struct LinearSystemSolverHints : public EnumBitset<LinearSystemSolverFlags> {
+    public:
+
+      using Base = EnumBitset<LinearSystemSolverFlags>;  ///< Base class abbreviation.
+
+      double tolerance;   ///< Tolerance for iterative solvers. Zero selects the solver default.
+      int maxIterations;  ///< Maximum number of iterations for iterative solvers. Zero selects the solver default.
+
+      /// Constructor all false.
+      CODI_INLINE LinearSystemSolverHints() : Base(), tolerance(0.0), maxIterations(0) {}
+
+      /// Constructor from a bitset. Uses the solver defaults for the iterative controls.
+      CODI_INLINE LinearSystemSolverHints(Base const& flags) : Base(flags), tolerance(0.0), maxIterations(0) {}
+
+      /// Constructor which sets one flag to true.
+      CODI_INLINE LinearSystemSolverHints(LinearSystemSolverFlags flag)
+          : Base(flag), tolerance(0.0), maxIterations(0) {}
+
+      /// Set the tolerance for iterative solvers.
+      CODI_INLINE LinearSystemSolverHints& setTolerance(double t) {
+        tolerance = t;
+        return *this;
+      }
+
+      /// Set the maximum number of iterations for iterative solvers.
+      CODI_INLINE LinearSystemSolverHints& setMaxIterations(int m) {
+        maxIterations = m;
+        return *this;
+      }
+
+      /// Constructor for hints with all flags set to true.
+      CODI_INLINE static LinearSystemSolverHints ALL() {
+        return LinearSystemSolverHints(Base::ALL());
+      }
+
+      /// Constructor for hints with all flags set to false.
+      CODI_INLINE static LinearSystemSolverHints NONE() {
+        return LinearSystemSolverHints(Base::NONE());
+      }
+  };
+
+  /// Add a flag to the hints. The iterative controls are kept.
+  CODI_INLINE LinearSystemSolverHints operator|(LinearSystemSolverHints const& a, LinearSystemSolverFlags b) {
+    LinearSystemSolverHints r = a;
+    r |= b;
+
+    return r;
+  }
+
+  /// Add a flag to the hints. The iterative controls are kept.
+  CODI_INLINE LinearSystemSolverHints operator|(LinearSystemSolverFlags a, LinearSystemSolverHints const& b) {
+    return b | a;
+  }
 
   /// Return a hints structure when to enums are ored.
   CODI_INLINE LinearSystemSolverHints operator|(LinearSystemSolverFlags a, LinearSystemSolverFlags b) {
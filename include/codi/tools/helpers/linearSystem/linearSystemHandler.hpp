@@ -35,6 +35,7 @@
 
 #pragma once
 
+#include <iostream>
 #include <vector>
 
 #include "../../../config.h"
@@ -49,6 +50,64 @@
 /** \copydoc codi::Namespace */
 namespace codi {
 
+  /**
+   * @brief Statistics for the iterative solves of the LinearSystemSolverHandler.
+   *
+   * The handler adds all solves that are performed with LinearSystemInterface::solveSystemIterative. A solve that
+   * starts from the solution of the last evaluation is a warm started solve. The saved iterations are the difference
+   * to the iterations of the first (cold started) solve of the same system and direction.
+   *
+   * The global instance is shared by all handlers. The counters are not synchronized between threads.
+   */
+  struct LinearSystemSolverStatistics {
+    public:
+
+      size_t solves;             ///< Number of iterative solves.
+      size_t warmStartedSolves;  ///< Number of iterative solves that started from a previous solution.
+      size_t iterations;         ///< Total number of iterations.
+      size_t iterationsSaved;    ///< Iterations saved by the warm starts.
+
+      /// Constructor.
+      LinearSystemSolverStatistics() : solves(0), warmStartedSolves(0), iterations(0), iterationsSaved(0) {}
+
+      /// Add a solve that started from zero or from a user provided guess.
+      void addSolve(int solveIterations) {
+        solves += 1;
+        iterations += solveIterations;
+      }
+
+      /// Add a solve that started from the solution of the last evaluation.
+      void addWarmStartedSolve(int solveIterations, int coldIterations) {
+        addSolve(solveIterations);
+        warmStartedSolves += 1;
+        if (coldIterations > solveIterations) {
+          iterationsSaved += coldIterations - solveIterations;
+        }
+      }
+
+      /// Reset all counters to zero.
+      void reset() {
+        *this = LinearSystemSolverStatistics();
+      }
+
+      /// Output the statistics in a human readable format.
+      template<typename Stream = std::ostream>
+      void printStatistics(Stream& out = std::cout) const {
+        out << "Linear system solver statistics\n";
+        out << "  Iterative solves    : " << solves << "\n";
+        out << "  Warm started solves : " << warmStartedSolves << "\n";
+        out << "  Iterations          : " << iterations << "\n";
+        out << "  Iterations saved    : " << iterationsSaved << "\n";
+      }
+
+      /// Statistics of all linear system solver handlers.
+      static LinearSystemSolverStatistics& getGlobal() {
+        static LinearSystemSolverStatistics statistics;
+
+        return statistics;
+      }
+  };
+
   /**
    *  Solves Ax=b and registers an external function on the tape which solves the specific AD mode equations.
    *
@@ -61,6 +120,14 @@ namespace codi {
    *
    *  The hints steer the algorithm, see LinearSystemInterface for details.
    *
+   *  If the LinearSystemInterface implementation provides the factorization methods, the factorization from the primal
+   *  solve is stored with the external function. All directions of the vector mode are then solved in one multi right
+   *  hand side solve in the forward and reverse evaluations.
+   *
+   *  If the implementation provides LinearSystemInterface::solveSystemIterative, all solves are performed with it. With
+   *  the hint WarmStart, the adjoint and tangent solutions are kept with the external function and are used as the
+   *  initial guesses in the next evaluation of the tape. See LinearSystemSolverStatistics for the collected data.
+   *
    *  See \ref Example_21_Special_handling_of_linear_system_solvers for an example use of this class.
    *
    *  @tparam T_LinearSystem  Implementation of LinearSystemInterface.
@@ -80,6 +147,7 @@ namespace codi {
       using Vector = typename LinearSystem::Vector;                      ///< See LinearSystemInterfaceTypes.
       using VectorReal = typename LinearSystem::VectorReal;              ///< See LinearSystemInterfaceTypes.
       using VectorIdentifier = typename LinearSystem::VectorIdentifier;  ///< See LinearSystemInterfaceTypes.
+      using Factorization = typename LinearSystem::Factorization;        ///< See LinearSystemInterface.
 
     private:
 
@@ -293,6 +361,14 @@ namespace codi {
 
           VectorReal* oldPrimals;
 
+          Factorization* factorization;
+
+          std::vector<VectorReal*> adjointSolutions;
+          std::vector<VectorReal*> tangentSolutions;
+          std::vector<int> adjointColdIterations;
+          std::vector<int> tangentColdIterations;
+          int primalColdIterations;
+
           LinearSystem lsi;
           LinearSystemSolverHints hints;
 
@@ -304,6 +380,12 @@ namespace codi {
                 x_v(NULL),
                 x_id(NULL),
                 oldPrimals(NULL),
+                factorization(NULL),
+                adjointSolutions(),
+                tangentSolutions(),
+                adjointColdIterations(),
+                tangentColdIterations(),
+                primalColdIterations(0),
                 lsi(lsi),
                 hints(hints) {}
 
@@ -329,9 +411,153 @@ namespace codi {
             if (NULL != oldPrimals) {
               lsi.deleteVectorReal(oldPrimals);
             }
+            if (NULL != factorization) {
+              lsi.deleteFactorization(factorization);
+            }
+            for (VectorReal* vec : adjointSolutions) {
+              lsi.deleteVectorReal(vec);
+            }
+            for (VectorReal* vec : tangentSolutions) {
+              lsi.deleteVectorReal(vec);
+            }
           }
       };
 
+      /// True if the iterative solver is used. A factorization takes precedence.
+      static bool UseIterativeSolve() {
+        return Overloads::IsIterativeSolveImplemented() && !Overloads::IsFactorizationImplemented();
+      }
+
+      /// True if the hint WarmStart is set and can be applied. For Real types with derivative parts, the stored
+      /// solution carries the tangents of a different evaluation. Since the iterative solvers check the convergence
+      /// only on the primal values, these tangents would not be corrected. Such types are always cold started.
+      static bool UseWarmStart(ExtFuncData* data) {
+        return UseIterativeSolve() && 0 == RealTraits::MaxDerivativeOrder<Real>() &&
+               data->hints.test(LinearSystemSolverFlags::WarmStart);
+      }
+
+      /// Set value_v to zero.
+      static void setZero(Real& value_v, Identifier const& value_id) {
+        CODI_UNUSED(value_id);
+
+        value_v = Real();
+      }
+
+      /// Create one real vector for each dimension of the vector mode.
+      template<typename V>
+      static std::vector<VectorReal*> createVectorsReal(LinearSystem& lsi, V* vec, size_t maxDim) {
+        std::vector<VectorReal*> vectors(maxDim);
+        for (size_t curDim = 0; curDim < maxDim; curDim += 1) {
+          vectors[curDim] = lsi.createVectorReal(vec);
+        }
+
+        return vectors;
+      }
+
+      /// Delete the vectors from createVectorsReal.
+      static void deleteVectorsReal(LinearSystem& lsi, std::vector<VectorReal*>& vectors) {
+        for (VectorReal* vec : vectors) {
+          lsi.deleteVectorReal(vec);
+        }
+        vectors.clear();
+      }
+
+      /**
+       * Solves mat x[i] = b[i] for all right hand sides with the iterative solver.
+       *
+       * If warm is true, x contains the initial guesses and the iterations are compared to coldIterations. Otherwise
+       * the solves start from zero and the iterations are recorded in coldIterations (if not NULL).
+       */
+      static void solveAllIterative(ExtFuncData* data, MatrixReal const* mat, std::vector<VectorReal*> const& b,
+                                    std::vector<VectorReal*> const& x, int* coldIterations, bool warm) {
+        LinearSystemSolverStatistics& statistics = LinearSystemSolverStatistics::getGlobal();
+
+        for (size_t i = 0; i < b.size(); i += 1) {
+          if (!warm) {
+            data->lsi.iterateVector(setZero, x[i], data->x_id);
+          }
+
+          int iterations =
+              data->lsi.solveSystemIterative(mat, b[i], x[i], data->hints.tolerance, data->hints.maxIterations);
+
+          if (warm) {
+            statistics.addWarmStartedSolve(iterations, coldIterations[i]);
+          } else {
+            statistics.addSolve(iterations);
+            if (NULL != coldIterations) {
+              coldIterations[i] = iterations;
+            }
+          }
+        }
+      }
+
+      /// Solves A_v x[i] = b[i] for all right hand sides. Uses the stored factorization if available.
+      static void solveAll(ExtFuncData* data, std::vector<VectorReal*> const& b, std::vector<VectorReal*> const& x) {
+        if (NULL != data->factorization) {
+          data->lsi.solveWithFactorization(data->factorization, b, x);
+        } else if (UseIterativeSolve()) {
+          solveAllIterative(data, data->A_v, b, x, NULL, false);
+        } else {
+          for (size_t i = 0; i < b.size(); i += 1) {
+            data->lsi.solveSystem(data->A_v, b[i], x[i]);
+          }
+        }
+      }
+
+      /// Solves A_v^T x[i] = b[i] for all right hand sides. Uses the stored factorization if available.
+      static void solveAllTransposed(ExtFuncData* data, std::vector<VectorReal*> const& b,
+                                     std::vector<VectorReal*> const& x) {
+        if (NULL != data->factorization) {
+          data->lsi.solveTransposedWithFactorization(data->factorization, b, x);
+        } else if (UseIterativeSolve()) {
+          solveAllIterative(data, data->A_v_trans, b, x, NULL, false);
+        } else {
+          for (size_t i = 0; i < b.size(); i += 1) {
+            data->lsi.solveSystem(data->A_v_trans, b[i], x[i]);
+          }
+        }
+      }
+
+      /// Solves A_v x_v = b_v in the primal reevaluations. With the hint WarmStart, an iterative solve starts from the
+      /// last solution.
+      static void solvePrimal(ExtFuncData* data, VectorReal* b_v) {
+        if (UseIterativeSolve()) {
+          solveAllIterative(data, data->A_v, {b_v}, {data->x_v}, &data->primalColdIterations, UseWarmStart(data));
+        } else {
+          solveAll(data, {b_v}, {data->x_v});
+        }
+      }
+
+      /// True if the adjoint and tangent solutions are kept for warm starts in the next evaluation.
+      static bool KeepSolutions(ExtFuncData* data) {
+        return UseWarmStart(data);
+      }
+
+      /// Provide the kept solutions for all directions. Returns true if they are from the last evaluation, otherwise
+      /// they are created and the solves need to start from zero.
+      template<typename V>
+      static bool prepareSolutions(ExtFuncData* data, std::vector<VectorReal*>& solutions,
+                                   std::vector<int>& coldIterations, V* vec, size_t maxDim) {
+        if (solutions.size() == maxDim) {
+          return true;
+        }
+
+        // First evaluation or the vector dimension has changed.
+        deleteVectorsReal(data->lsi, solutions);
+        solutions = createVectorsReal(data->lsi, vec, maxDim);
+        coldIterations.assign(maxDim, 0);
+
+        return false;
+      }
+
+      /// Renew the stored factorization after A_v has been updated.
+      static void updateFactorization(ExtFuncData* data) {
+        if (NULL != data->factorization) {
+          data->lsi.deleteFactorization(data->factorization);
+          data->factorization = data->lsi.factorize(data->A_v);
+        }
+      }
+
       /** Reverse mode algorithm
        *  Computes:
        *  s = A^T^-1 * x_b
@@ -354,25 +580,42 @@ namespace codi {
               "Linear system reverse mode called without hint 'LinearSystemSolverFlags::ReverseEvaluation'.");
         }
 
-        VectorReal* x_b = data->lsi.createVectorReal(data->x_id);
-        VectorReal* s = data->lsi.createVectorReal(data->b_id);
+        size_t maxDim = adjointInterface->getVectorSize();
+        bool const keepSolutions = KeepSolutions(data);
+        bool warm = false;
+        std::vector<VectorReal*> x_b = createVectorsReal(data->lsi, data->x_id, maxDim);
+        std::vector<VectorReal*> s;
+        if (keepSolutions) {
+          warm = prepareSolutions(data, data->adjointSolutions, data->adjointColdIterations, data->b_id, maxDim);
+          s = data->adjointSolutions;
+        } else {
+          s = createVectorsReal(data->lsi, data->b_id, maxDim);
+        }
 
         if (NULL != data->oldPrimals) {
           data->lsi.iterateVector(SetPrimal(0, adjointInterface), data->oldPrimals, data->x_id);
         }
 
-        size_t maxDim = adjointInterface->getVectorSize();
         for (size_t curDim = 0; curDim < maxDim; curDim += 1) {
-          data->lsi.iterateVector(ExtractAdjoint(curDim, adjointInterface), x_b, data->x_id);
+          data->lsi.iterateVector(ExtractAdjoint(curDim, adjointInterface), x_b[curDim], data->x_id);
+        }
 
-          data->lsi.solveSystem(data->A_v_trans, x_b, s);
+        // All directions are solved at once, which allows for a multi right hand side solve with the factorization.
+        if (keepSolutions) {
+          solveAllIterative(data, data->A_v_trans, x_b, s, data->adjointColdIterations.data(), warm);
+        } else {
+          solveAllTransposed(data, x_b, s);
+        }
 
-          data->lsi.iterateDyadic(UpdateAdjointDyadic(curDim, adjointInterface), data->A_id, s, data->x_v);
-          data->lsi.iterateVector(UpdateAdjoint(curDim, adjointInterface), s, data->b_id);
+        for (size_t curDim = 0; curDim < maxDim; curDim += 1) {
+          data->lsi.iterateDyadic(UpdateAdjointDyadic(curDim, adjointInterface), data->A_id, s[curDim], data->x_v);
+          data->lsi.iterateVector(UpdateAdjoint(curDim, adjointInterface), s[curDim], data->b_id);
         }
 
-        data->lsi.deleteVectorReal(x_b);
-        data->lsi.deleteVectorReal(s);
+        deleteVectorsReal(data->lsi, x_b);
+        if (!keepSolutions) {
+          deleteVectorsReal(data->lsi, s);
+        }
       }
 
       /** Forward mode algorithm
@@ -397,12 +640,22 @@ namespace codi {
         bool const updatePrimals =
             IsPrimalValueTape && data->hints.test(LinearSystemSolverFlags::RecomputePrimalInForwardEvaluation);
 
+        size_t maxDim = adjointInterface->getVectorSize();
+        bool const keepSolutions = KeepSolutions(data);
+        bool warm = false;
+
         MatrixReal* A_d = data->lsi.createMatrixReal(data->A_id);
-        VectorReal* b_v = data->lsi.createVectorReal(data->b_id);  // b_v is also used as a temporary.
+        VectorReal* b_v = data->lsi.createVectorReal(data->b_id);
         VectorReal* b_d = data->lsi.createVectorReal(data->b_id);
-        VectorReal* x_d = data->lsi.createVectorReal(data->x_id);
+        std::vector<VectorReal*> t = createVectorsReal(data->lsi, data->b_id, maxDim);
+        std::vector<VectorReal*> x_d;
+        if (keepSolutions) {
+          warm = prepareSolutions(data, data->tangentSolutions, data->tangentColdIterations, data->x_id, maxDim);
+          x_d = data->tangentSolutions;
+        } else {
+          x_d = createVectorsReal(data->lsi, data->x_id, maxDim);
+        }
 
-        size_t maxDim = adjointInterface->getVectorSize();
         for (size_t curDim = 0; curDim < maxDim; curDim += 1) {
           if (0 == curDim && updatePrimals) {
             data->lsi.iterateMatrix(GetPrimalAndGetTangent(curDim, adjointInterface), data->A_v, A_d, data->A_id);
@@ -419,30 +672,42 @@ namespace codi {
               data->lsi.deleteMatrixReal(data->A_v_trans);
               data->A_v_trans = data->lsi.transposeMatrix(data->A_v);
             }
+            updateFactorization(data);
 
-            data->lsi.solveSystem(data->A_v, b_v, data->x_v);
+            solvePrimal(data, b_v);
           }
 
-          data->lsi.subtractMultiply(b_v, b_d, A_d, data->x_v);  // Use of b_v as temporary.
+          data->lsi.subtractMultiply(t[curDim], b_d, A_d, data->x_v);
+        }
 
-          data->lsi.solveSystem(data->A_v, b_v /* temporary */, x_d);
+        // All directions are solved at once, which allows for a multi right hand side solve with the factorization.
+        if (keepSolutions) {
+          solveAllIterative(data, data->A_v, t, x_d, data->tangentColdIterations.data(), warm);
+        } else {
+          solveAll(data, t, x_d);
+        }
 
+        for (size_t curDim = 0; curDim < maxDim; curDim += 1) {
           if (updatePrimals) {
             if (NULL != data->oldPrimals) {
               data->lsi.iterateVector(SetPrimalAndSetTangentAndUpdateOldPrimal(curDim, adjointInterface), data->x_v,
-                                      x_d, data->x_id, data->oldPrimals);
+                                      x_d[curDim], data->x_id, data->oldPrimals);
             } else {
-              data->lsi.iterateVector(SetPrimalAndSetTangent(curDim, adjointInterface), data->x_v, x_d, data->x_id);
+              data->lsi.iterateVector(SetPrimalAndSetTangent(curDim, adjointInterface), data->x_v, x_d[curDim],
+                                      data->x_id);
             }
           } else {
-            data->lsi.iterateVector(SetTangent(curDim, adjointInterface), x_d, data->x_id);
+            data->lsi.iterateVector(SetTangent(curDim, adjointInterface), x_d[curDim], data->x_id);
           }
         }
 
         data->lsi.deleteMatrixReal(A_d);
         data->lsi.deleteVectorReal(b_v);
         data->lsi.deleteVectorReal(b_d);
-        data->lsi.deleteVectorReal(x_d);
+        deleteVectorsReal(data->lsi, t);
+        if (!keepSolutions) {
+          deleteVectorsReal(data->lsi, x_d);
+        }
       }
 
       /** Primal algorithm
@@ -463,7 +728,8 @@ namespace codi {
         data->lsi.iterateMatrix(GetPrimal(0, adjointInterface), data->A_v, data->A_id);
         data->lsi.iterateVector(GetPrimal(0, adjointInterface), b_v, data->b_id);
 
-        data->lsi.solveSystem(data->A_v, b_v, data->x_v);
+        updateFactorization(data);
+        solvePrimal(data, b_v);
 
         if (NULL != data->A_v_trans) {
           // Only renew trans if it already exists.
@@ -513,15 +779,29 @@ namespace codi {
           lsi.iterateVector(getOutput, x, x_v);
         }
 
-        if (Overloads::IsSolvePrimalImplemented()) {
+        Factorization* factorization = NULL;
+        int primalIterations = 0;
+        if (Overloads::IsFactorizationImplemented()) {
+          factorization = lsi.factorize(A_v);
+          lsi.solveWithFactorization(factorization, {b_v}, {x_v});
+        } else if (Overloads::IsSolvePrimalImplemented()) {
           lsi.solveSystemPrimal(A_v, b_v, x_v);
+        } else if (UseIterativeSolve()) {
+          // The provided solution is only used as the initial guess for types without derivative parts, see
+          // UseWarmStart.
+          if (!hints.test(LinearSystemSolverFlags::ProvidePrimalSolution) ||
+              0 != RealTraits::MaxDerivativeOrder<Real>()) {
+            lsi.iterateVector(setZero, x_v, x_id);
+          }
+          primalIterations = lsi.solveSystemIterative(A_v, b_v, x_v, hints.tolerance, hints.maxIterations);
+          LinearSystemSolverStatistics::getGlobal().addSolve(primalIterations);
         } else {
           lsi.solveSystem(A_v, b_v, x_v);
         }
 
         if (tape.isActive()) {
           MatrixReal* A_v_trans = NULL;
-          if (hints.test(LinearSystemSolverFlags::ReverseEvaluation)) {
+          if (hints.test(LinearSystemSolverFlags::ReverseEvaluation) && !Overloads::IsFactorizationImplemented()) {
             A_v_trans = lsi.transposeMatrix(A_v);
           }
 
@@ -540,12 +820,19 @@ namespace codi {
             data->A_v = A_v;
             A_v = NULL;  // Do not delete A_v
           }
+          if (hints.test(LinearSystemSolverFlags::ReverseEvaluation) ||
+              hints.test(LinearSystemSolverFlags::ForwardEvaluation) ||
+              hints.test(LinearSystemSolverFlags::PrimalEvaluation)) {
+            data->factorization = factorization;
+            factorization = NULL;  // Do not delete the factorization
+          }
           data->A_v_trans = A_v_trans;
           data->A_id = A_id;
           data->b_id = b_id;
           data->x_v = x_v;
           data->x_id = x_id;
           data->oldPrimals = oldPrimals;
+          data->primalColdIterations = primalIterations;
 
           tape.pushExternalFunction(ExternalFunction<Tape>::create(solve_b, data, deleteData, solve_d, solve_p));
 
@@ -565,6 +852,10 @@ namespace codi {
           lsi.deleteVectorReal(x_v);
           lsi.deleteVectorIdentifier(x_id);
         }
+
+        if (NULL != factorization) {
+          lsi.deleteFactorization(factorization);
+        }
       }
   };
 
@@ -621,6 +912,7 @@ namespace codi {
       using Vector = typename LinearSystem::Vector;                      ///< See LinearSystemInterfaceTypes.
       using VectorReal = typename LinearSystem::VectorReal;              ///< See LinearSystemInterfaceTypes.
       using VectorIdentifier = typename LinearSystem::VectorIdentifier;  ///< See LinearSystemInterfaceTypes.
+      using Factorization = typename LinearSystem::Factorization;        ///< See LinearSystemInterface.
 
     private:
 
@@ -649,6 +941,20 @@ namespace codi {
         value_v = value.getValue();
       }
 
+      /// Set value_v to zero.
+      static void setZero(Real& value_v, Type const& value) {
+        CODI_UNUSED(value);
+
+        value_v = Real();
+      }
+
+      /// Cold started iterative solve of A_v x_v = b_v.
+      static void solveIterative(LinearSystem& lsi, MatrixReal const* A_v, VectorReal const* b_v, VectorReal* x_v,
+                                 LinearSystemSolverHints const& hints) {
+        int iterations = lsi.solveSystemIterative(A_v, b_v, x_v, hints.tolerance, hints.maxIterations);
+        LinearSystemSolverStatistics::getGlobal().addSolve(iterations);
+      }
+
       /// Get the primals into value_v and tangents into value_d from value.
       struct GetPrimalAndGetTangent : public DimFunctor {
         public:
@@ -699,21 +1005,27 @@ namespace codi {
        *  x_d = A^-1 * (b_d - A_d * x_v)
        */
       void solve(LinearSystem lsi, Matrix* A, Vector* b, Vector* x, LinearSystemSolverHints hints) {
-        CODI_UNUSED(hints);
+        size_t maxDim = GradientTraits::dim<Gradient>();
+        bool const useIterativeSolve =
+            Overloads::IsIterativeSolveImplemented() && !Overloads::IsFactorizationImplemented();
 
         MatrixReal* A_v = lsi.createMatrixReal(A);
         MatrixReal* A_d = lsi.createMatrixReal(A);
         VectorReal* b_v = lsi.createVectorReal(b);
         VectorReal* b_d = lsi.createVectorReal(b);
         VectorReal* x_v = lsi.createVectorReal(x);
-        VectorReal* x_d = lsi.createVectorReal(x);
-
-        size_t maxDim = GradientTraits::dim<Gradient>();
+        std::vector<VectorReal*> t(maxDim);
+        std::vector<VectorReal*> x_d(maxDim);
+        for (size_t curDim = 0; curDim < maxDim; curDim += 1) {
+          t[curDim] = lsi.createVectorReal(b);
+          x_d[curDim] = lsi.createVectorReal(x);
+        }
 
         if (hints.test(LinearSystemSolverFlags::ProvidePrimalSolution)) {
           lsi.iterateVector(getOutput, x, x_v);
         }
 
+        Factorization* factorization = NULL;
         for (size_t curDim = 0; curDim < maxDim; curDim += 1) {
           if (0 == curDim) {
             lsi.iterateMatrix(GetPrimalAndGetTangent(curDim), A, A_v, A_d);
@@ -725,25 +1037,46 @@ namespace codi {
 
           if (0 == curDim) {  // Solve primal system only once.
             // Solve Ax = b
-            if (Overloads::IsSolvePrimalImplemented()) {
+            if (Overloads::IsFactorizationImplemented()) {
+              factorization = lsi.factorize(A_v);
+              lsi.solveWithFactorization(factorization, {b_v}, {x_v});
+            } else if (Overloads::IsSolvePrimalImplemented()) {
               lsi.solveSystemPrimal(A_v, b_v, x_v);
+            } else if (useIterativeSolve) {
+              if (!hints.test(LinearSystemSolverFlags::ProvidePrimalSolution) ||
+                  0 != RealTraits::MaxDerivativeOrder<Real>()) {
+                lsi.iterateVector(setZero, x_v, x);
+              }
+              solveIterative(lsi, A_v, b_v, x_v, hints);
             } else {
               lsi.solveSystem(A_v, b_v, x_v);
             }
           }
 
-          // temp(x_d) = b_d - A_d * x
-          lsi.subtractMultiply(x_d, b_d, A_d, x_v);
-
-          std::swap(b_d, x_d);  // Move temporary to b_d.
+          // t = b_d - A_d * x
+          lsi.subtractMultiply(t[curDim], b_d, A_d, x_v);
+        }
 
-          // Solve A x_d = temp
-          lsi.solveSystem(A_v, b_d, x_d);
+        // Solve A x_d = t for all directions.
+        if (NULL != factorization) {
+          lsi.solveWithFactorization(factorization, t, x_d);
+          lsi.deleteFactorization(factorization);
+        } else if (useIterativeSolve) {
+          for (size_t curDim = 0; curDim < maxDim; curDim += 1) {
+            lsi.iterateVector(setZero, x_d[curDim], x);
+            solveIterative(lsi, A_v, t[curDim], x_d[curDim], hints);
+          }
+        } else {
+          for (size_t curDim = 0; curDim < maxDim; curDim += 1) {
+            lsi.solveSystem(A_v, t[curDim], x_d[curDim]);
+          }
+        }
 
+        for (size_t curDim = 0; curDim < maxDim; curDim += 1) {
           if (0 == curDim) {
-            lsi.iterateVector(SetPrimalAndSetTangent(curDim), x, x_v, x_d);
+            lsi.iterateVector(SetPrimalAndSetTangent(curDim), x, x_v, x_d[curDim]);
           } else {
-            lsi.iterateVector(SetTangent(curDim), x, x_d);
+            lsi.iterateVector(SetTangent(curDim), x, x_d[curDim]);
           }
         }
 
@@ -752,7 +1085,10 @@ namespace codi {
         lsi.deleteVectorReal(b_v);
         lsi.deleteVectorReal(b_d);
         lsi.deleteVectorReal(x_v);
-        lsi.deleteVectorReal(x_d);
+        for (size_t curDim = 0; curDim < maxDim; curDim += 1) {
+          lsi.deleteVectorReal(t[curDim]);
+          lsi.deleteVectorReal(x_d[curDim]);
+        }
       }
   };
 #endif
@@ -84,6 +84,8 @@ namespace codi {
    *                           solveSystemPrimal methods (only during the primal computation, not in the external
    *                           function implementations).
    *  - RecomputePrimalInForwardEvaluation: In the AD forward mode also solve the primal linear system again.
+   *  - WarmStart: Keep the solutions of the AD solves with the external function and use them as initial guesses in
+   *               the next evaluation. Only used if #solveSystemIterative is implemented.
    *
    *  See \ref Example_21_Special_handling_of_linear_system_solvers for an example with the Eigen implementation.
    *
@@ -102,6 +104,22 @@ namespace codi {
    *      - #subtractMultiply
    *    - Other:
    *      - #solveSystemPrimal
+   *    - Factorization reuse:
+   *      - #factorize, #deleteFactorization
+   *      - #solveWithFactorization, #solveTransposedWithFactorization
+   *    - Iterative solvers:
+   *      - #solveSystemIterative
+   *
+   *   If the factorization methods are implemented, the implementation has to define the type \c Factorization.
+   *   The handler then factorizes the matrix once in the primal solve and keeps the factorization in the external
+   *   function data. The reverse and forward evaluations solve all directions of the vector mode in one call with this
+   *   factorization. The transposed matrix is no longer required for the reverse mode in this case.
+   *
+   *   If #solveSystemIterative is implemented (and no factorization is provided), the handler calls it for all solves
+   *   with the tolerance and maximum number of iterations from the hints. With the WarmStart hint, the adjoint and
+   *   tangent solutions of each recorded system are kept with its external function and provide the initial guesses
+   *   for the next tape evaluation. The primal reevaluations start from the last primal solution. The number of
+   *   iterations and the iterations saved by the warm starts are collected in LinearSystemSolverStatistics.
    *
    * @tparam T_InterfaceTypes  The definition of LinearSystemInterfaceTypes for the implementation.
    */
@@ -120,6 +138,9 @@ namespace codi {
       using VectorReal = typename InterfaceTypes::VectorReal;              ///< See LinearSystemInterfaceTypes.
       using VectorIdentifier = typename InterfaceTypes::VectorIdentifier;  ///< See LinearSystemInterfaceTypes.
 
+      /// Factorization of a MatrixReal. Needs to be defined by implementations that provide the factorization methods.
+      using Factorization = void;
+
       /*******************************************************************************/
       /// @name Mandatory: Implementations for matrix and vector creation and deletion.
       /// @{
@@ -232,6 +253,48 @@ namespace codi {
         CODI_UNUSED(A, b, x);
       }
 
+      /// @}
+      /*******************************************************************************/
+      /// @name Optional: Implementations for the reuse of a factorization.
+      /// @{
+
+      /// Factorize the matrix. The factorization is used for all further solves with this matrix.
+      Factorization* factorize(MatrixReal const* A) {
+        CODI_UNUSED(A);
+        return NULL;
+      }
+
+      /// Delete a factorization.
+      void deleteFactorization(Factorization* factorization) {
+        CODI_UNUSED(factorization);
+      }
+
+      /// Solves A x[i] = b[i] for all right hand sides with the factorization of A. b and x have the same size.
+      void solveWithFactorization(Factorization const* factorization, std::vector<VectorReal*> const& b,
+                                  std::vector<VectorReal*> const& x) {
+        CODI_UNUSED(factorization, b, x);
+      }
+
+      /// Solves A^T x[i] = b[i] for all right hand sides with the factorization of A. b and x have the same size.
+      void solveTransposedWithFactorization(Factorization const* factorization, std::vector<VectorReal*> const& b,
+                                            std::vector<VectorReal*> const& x) {
+        CODI_UNUSED(factorization, b, x);
+      }
+
+      /// @}
+      /*******************************************************************************/
+      /// @name Optional: Implementation for iterative solvers.
+      /// @{
+
+      /// Solves Ax = b for x with an iterative method. On entry, x contains the initial guess.
+      /// A tolerance or maxIterations of zero selects the default of the solver.
+      /// @return The number of performed iterations.
+      int solveSystemIterative(MatrixReal const* A, VectorReal const* b, VectorReal* x, double tolerance,
+                               int maxIterations) {
+        CODI_UNUSED(A, b, x, tolerance, maxIterations);
+        return 0;
+      }
+
       /// @}
   };
 }
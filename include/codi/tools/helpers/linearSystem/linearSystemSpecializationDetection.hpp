@@ -35,6 +35,7 @@
 
 #pragma once
 
+#include <type_traits>
 #include <vector>
 
 #include "../../../config.h"
@@ -109,13 +110,23 @@ namespace codi {
         return &LinearSystem::solveSystemPrimal != &Interface::solveSystemPrimal;
       }
 
+      /// Checks if solveSystemIterative is specialized in LinearSystem.
+      CODI_INLINE static bool IsIterativeSolveImplemented() {
+        return &LinearSystem::solveSystemIterative != &Interface::solveSystemIterative;
+      }
+
 #ifdef __GNUC__
   #pragma GCC diagnostic pop
 #endif
 
+      /// Checks if the factorization methods are specialized in LinearSystem, that is, if it defines a Factorization.
+      CODI_INLINE static constexpr bool IsFactorizationImplemented() {
+        return !std::is_same<typename LinearSystem::Factorization, void>::value;
+      }
+
       /// True if all functions for the reverse mode support are specialized.
       CODI_INLINE static bool SupportsReverseMode() {
-        return IsDyadicImplemented() && IsTransposeImplemented();
+        return IsDyadicImplemented() && (IsTransposeImplemented() || IsFactorizationImplemented());
       }
 
       /// True if all functions for the forward mode support are specialized.
@@ -0,0 +1,470 @@
+/*
+ * CoDiPack, a Code Differentiation Package
+ *
+ * Copyright (C) 2015-2026 Chair for Scientific Computing (SciComp), RPTU University Kaiserslautern-Landau
+ * Homepage: http://scicomp.rptu.de
+ * Contact:  Prof. Nicolas R. Gauger (codi@scicomp.uni-kl.de)
+ *
+ * Lead developers: Max Sagebaum, Johannes Blühdorn (SciComp, RPTU University Kaiserslautern-Landau)
+ *
+ * This file is part of CoDiPack (http://scicomp.rptu.de/software/codi).
+ *
+ * CoDiPack is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * CoDiPack is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * See the GNU General Public License for more details.
+ * You should have received a copy of the GNU
+ * General Public License along with CoDiPack.
+ * If not, see <http://www.gnu.org/licenses/>.
+ *
+ * For other licensing options please contact us.
+ *
+ * Authors:
+ *  - SciComp, RPTU University Kaiserslautern-Landau:
+ *    - Max Sagebaum
+ *    - Johannes Blühdorn
+ *    - Former members:
+ *      - Tim Albring
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include "../../config.h"
+#include "../../misc/macros.hpp"
+#include "../../traits/tapeTraits.hpp"
+#include "../algorithms.hpp"
+#include "../data/customAdjoints.hpp"
+#include "../data/jacobian.hpp"
+#include "preaccumulationHelper.hpp"
+
+/** \copydoc codi::Namespace */
+namespace codi {
+
+  /**
+   * @brief Preaccumulation of many small, independent code regions at once.
+   *
+   * A region is started with start() as for the PreaccumulationHelper and ended with finishBatched(), which only
+   * records the region. preaccumulateBatch() computes the Jacobians of all recorded regions and replaces the regions
+   * on the tape with them.
+   *
+   * \snippet documentation/examples/Example_35_Batched_preaccumulation.cpp Batched preaccumulation
+   *
+   * Consecutive regions with the same structure, that is, the same statements and identifiers up to a renumbering,
+   * are evaluated together. The local reverse sweeps of up to maxLanes such regions are performed at once on
+   * interleaved local adjoints, so that the innermost loops run over the regions and can be vectorized by the compiler.
+   * This is the typical situation in loops over mesh cells or edges that evaluate the same function for every
+   * element.
+   *
+   * The regions of a batch have to be recorded directly after each other, and values computed in a region must not
+   * be used before preaccumulateBatch() is called. In particular, outputs of a region must not be inputs of another
+   * region in the same batch. The output values have to stay valid until preaccumulateBatch() is called.
+   *
+   * Regions are batched on Jacobian tapes. Regions with external functions or low level functions are preaccumulated
+   * individually. For all other tapes, finishBatched() preaccumulates each region directly with finish().
+   *
+   * The helper works on the tape of the calling thread. See PreaccumulationHelperPool for the use in parallel codes.
+   *
+   * @tparam T_Type  The CoDiPack type on which the evaluations take place.
+   */
+  template<typename T_Type, typename = void>
+  struct PreaccumulationBatchHelper : public PreaccumulationHelper<T_Type> {
+    public:
+
+      /// Finish the preaccumulation region and perform the preaccumulation directly. See `addOutput()` for outputs.
+      template<typename... Outputs>
+      void finishBatched(Outputs&... outputs) {
+        this->finish(false, outputs...);
+      }
+
+      /// Does nothing, all regions are already preaccumulated.
+      void preaccumulateBatch() {}
+  };
+
+  /// Specialization of PreaccumulationBatchHelper for Jacobian tapes.
+  template<typename T_Type>
+  struct PreaccumulationBatchHelper<T_Type, TapeTraits::EnableIfJacobianTape<typename T_Type::Tape>>
+      : public PreaccumulationHelper<T_Type> {
+    public:
+
+      /// See PreaccumulationBatchHelper.
+      using Type = CODI_DD(T_Type, CODI_DEFAULT_LHS_EXPRESSION);
+
+      using Base = PreaccumulationHelper<Type>;  ///< Base class abbreviation.
+
+      using Real = typename Type::Real;              ///< See LhsExpressionInterface.
+      using Identifier = typename Type::Identifier;  ///< See LhsExpressionInterface.
+      using Gradient = typename Type::Gradient;      ///< See LhsExpressionInterface.
+      using TapeData = typename Type::TapeData;      ///< See LhsExpressionInterface.
+
+      /// See LhsExpressionInterface.
+      using Tape = CODI_DD(typename Type::Tape, CODI_DEFAULT_TAPE);
+      using Position = typename Tape::Position;  ///< See PositionalEvaluationTapeInterface.
+
+      size_t maxLanes;  ///< Maximum number of regions with the same structure that are evaluated together.
+
+    protected:
+
+      /// Statements of a region with identifiers renumbered in the order of their appearance. Local identifier 0 is the
+      /// passive identifier.
+      struct RegionStructure {
+        public:
+          std::vector<Identifier> inputs;      ///< Local identifiers of the inputs.
+          std::vector<Identifier> outputs;     ///< Local identifiers of the outputs.
+          std::vector<size_t> statementSizes;  ///< Number of arguments of each statement.
+          std::vector<Identifier> lhs;         ///< Local identifier of the left hand side of each statement.
+          std::vector<Identifier> rhs;         ///< Local identifiers of the arguments of all statements.
+          size_t numberOfIdentifiers;          ///< Number of local identifiers, including the passive one.
+          bool supported;                      ///< False if the region contains low level functions.
+
+          /// Remove all entries.
+          void clear() {
+            inputs.clear();
+            outputs.clear();
+            statementSizes.clear();
+            lhs.clear();
+            rhs.clear();
+            numberOfIdentifiers = 1;
+            supported = true;
+          }
+
+          /// True if both regions can be evaluated together.
+          bool isSameAs(RegionStructure const& o) const {
+            return numberOfIdentifiers == o.numberOfIdentifiers && inputs == o.inputs && outputs == o.outputs &&
+                   statementSizes == o.statementSizes && lhs == o.lhs && rhs == o.rhs;
+          }
+      };
+
+      /// Collects the structure and the Jacobians of a region, see CallbacksInterface.
+      struct RegionCallbacks {
+        public:
+          PreaccumulationBatchHelper& helper;  ///< Helper that receives the data.
+
+          /// Constructor.
+          RegionCallbacks(PreaccumulationBatchHelper& helper) : helper(helper) {}
+
+          /// Record the statement with local identifiers.
+          template<typename JacobianReal>
+          void handleStatement(Identifier& lhsIdentifier, size_t const& size, JacobianReal const* jacobians,
+                               Identifier const* rhsIdentifiers) {
+            RegionStructure& structure = helper.regionStructure;
+
+            for (size_t curArg = 0; curArg < size; curArg += 1) {
+              structure.rhs.push_back(helper.toLocalIdentifier(rhsIdentifiers[curArg]));
+              helper.regionJacobians.push_back((Real)jacobians[curArg]);
+            }
+            structure.lhs.push_back(helper.toLocalIdentifier(lhsIdentifier));
+            structure.statementSizes.push_back(size);
+          }
+
+          /// Low level functions can not be batched.
+          template<typename Func, typename DataView>
+          void handleLowLevelFunction(Func const& func, DataView& data) {
+            CODI_UNUSED(func, data);
+
+            helper.regionStructure.supported = false;
+          }
+      };
+
+      Position batchStart;                  ///< Start of the first region in the batch.
+      std::vector<Position> regionStarts;   ///< Start positions of the regions.
+      std::vector<Position> regionEnds;     ///< End positions of the regions.
+      std::vector<size_t> inputOffsets;     ///< Offsets of the regions in batchInputData, one more than regions.
+      std::vector<size_t> outputOffsets;    ///< Offsets of the regions in batchOutputData, one more than regions.
+      std::vector<size_t> jacobianOffsets;  ///< Offsets of the regions in batchJacobians, one more than regions.
+
+      std::vector<Identifier> batchInputData;    ///< Input identifiers of all regions.
+      std::vector<TapeData> batchInputTapeData;  ///< Input tape data of all regions.
+      std::vector<Identifier> batchOutputData;   ///< Output identifiers of all regions.
+      std::vector<Type*> batchOutputValues;      ///< Output value pointers of all regions.
+      std::vector<Real> batchJacobians;          ///< Row major Jacobians of all regions.
+
+      RegionStructure regionStructure;    ///< Structure of the region that is currently processed.
+      RegionStructure groupStructure;     ///< Structure of the regions that are evaluated together.
+      std::vector<Real> regionJacobians;  ///< Jacobians of the statements of the current region.
+      std::vector<Real> groupJacobians;   ///< Jacobians of the statements of the group, region major.
+      std::vector<Real> laneJacobians;    ///< Jacobians of the statements of the group, statement major.
+      std::vector<Real> laneAdjoints;     ///< Local adjoints of the group, one lane per region.
+      std::vector<Real> lhsAdjoints;      ///< Adjoints of the left hand side of a statement, one lane per region.
+      Jacobian<Real> regionJacobian;      ///< Jacobian of a region that is not batched.
+
+    public:
+
+      /// Constructor.
+      PreaccumulationBatchHelper()
+          : Base(),
+            maxLanes(32),
+            batchStart(),
+            regionStarts(),
+            regionEnds(),
+            inputOffsets(1, 0),
+            outputOffsets(1, 0),
+            jacobianOffsets(1, 0),
+            batchInputData(),
+            batchInputTapeData(),
+            batchOutputData(),
+            batchOutputValues(),
+            batchJacobians(),
+            regionStructure(),
+            groupStructure(),
+            regionJacobians(),
+            groupJacobians(),
+            laneJacobians(),
+            laneAdjoints(),
+            lhsAdjoints(),
+            regionJacobian(0, 0) {}
+
+      /// Finish the preaccumulation region. The preaccumulation is deferred to preaccumulateBatch(). See `addOutput()`
+      /// for outputs.
+      template<typename... Outputs>
+      void finishBatched(Outputs&... outputs) {
+        Tape& tape = Type::getTape();
+
+        if (tape.isActive()) {
+          this->addOutputRecursive(outputs...);
+
+          if (regionStarts.empty()) {
+            batchStart = this->startPos;
+          } else {
+            codiAssert(regionEnds.back() == this->startPos);  // Regions have to be recorded directly after each other.
+          }
+
+          regionStarts.push_back(this->startPos);
+          regionEnds.push_back(tape.getPosition());
+
+          batchInputData.insert(batchInputData.end(), this->inputData.begin(), this->inputData.end());
+          batchInputTapeData.insert(batchInputTapeData.end(), this->inputTapeData.begin(), this->inputTapeData.end());
+          batchOutputData.insert(batchOutputData.end(), this->outputData.begin(), this->outputData.end());
+          batchOutputValues.insert(batchOutputValues.end(), this->outputValues.begin(), this->outputValues.end());
+
+          inputOffsets.push_back(batchInputData.size());
+          outputOffsets.push_back(batchOutputData.size());
+          jacobianOffsets.push_back(jacobianOffsets.back() + this->inputData.size() * this->outputData.size());
+        }
+      }
+
+      /// Perform the preaccumulation of all regions that were finished with finishBatched() and store their Jacobians
+      /// on the tape.
+      void preaccumulateBatch() {
+        if (regionStarts.empty()) {
+          return;
+        }
+
+        Tape& tape = Type::getTape();
+        bool const wasActive = tape.isActive();
+        tape.setPassive();
+
+        computeBatchJacobians();
+
+        tape.resetTo(batchStart, false);
+
+        storeBatchJacobians();
+
+        if (wasActive) {
+          tape.setActive();
+        }
+
+        clearBatch();
+      }
+
+      /// Number of regions that are waiting for preaccumulateBatch().
+      size_t getBatchSize() const {
+        return regionStarts.size();
+      }
+
+    protected:
+
+      /// Remap a tape identifier to a local identifier.
+      CODI_INLINE Identifier toLocalIdentifier(Identifier const& identifier) {
+        if (Type::getTape().getPassiveIndex() == identifier) {
+          return Identifier();
+        }
+
+        auto result = this->identifierMap.insert(identifier, (Identifier)regionStructure.numberOfIdentifiers);
+        if (result.second) {  // insertion took place
+          regionStructure.numberOfIdentifiers += 1;
+        }
+
+        return result.first;
+      }
+
+      void computeBatchJacobians() {
+        batchJacobians.resize(jacobianOffsets.back());
+
+        size_t const regions = regionStarts.size();
+        size_t groupBegin = 0;
+        size_t groupSize = 0;
+
+        for (size_t curRegion = 0; curRegion < regions; curRegion += 1) {
+          extractRegion(curRegion);
+
+          if (0 != groupSize && (!regionStructure.supported || maxLanes <= groupSize ||
+                                 !regionStructure.isSameAs(groupStructure))) {
+            evaluateGroup(groupBegin, groupSize);
+            groupSize = 0;
+          }
+
+          if (!regionStructure.supported) {
+            evaluateRegion(curRegion);
+            continue;
+          }
+
+          if (0 == groupSize) {
+            std::swap(groupStructure, regionStructure);
+            groupJacobians.clear();
+            groupBegin = curRegion;
+          }
+
+          groupJacobians.insert(groupJacobians.end(), regionJacobians.begin(), regionJacobians.end());
+          groupSize += 1;
+        }
+
+        if (0 != groupSize) {
+          evaluateGroup(groupBegin, groupSize);
+        }
+      }
+
+      /// Collect the structure and the statement Jacobians of a region in regionStructure and regionJacobians.
+      void extractRegion(size_t const region) {
+        regionStructure.clear();
+        regionJacobians.clear();
+        this->identifierMap.clear();
+
+        for (size_t curIn = inputOffsets[region]; curIn < inputOffsets[region + 1]; curIn += 1) {
+          regionStructure.inputs.push_back(toLocalIdentifier(batchInputData[curIn]));
+        }
+
+        Type::getTape().iterateForward(RegionCallbacks(*this), regionStarts[region], regionEnds[region]);
+
+        for (size_t curOut = outputOffsets[region]; curOut < outputOffsets[region + 1]; curOut += 1) {
+          regionStructure.outputs.push_back(toLocalIdentifier(batchOutputData[curOut]));
+        }
+      }
+
+      /// Perform the reverse sweeps for all regions of the group at once.
+      void evaluateGroup(size_t const groupBegin, size_t const lanes) {
+        RegionStructure const& structure = groupStructure;
+        size_t const entries = structure.rhs.size();
+        size_t const inputs = structure.inputs.size();
+        size_t const outputs = structure.outputs.size();
+
+        // Interleave the Jacobians of the regions such that the entries for one argument are contiguous.
+        laneJacobians.resize(entries * lanes);
+        for (size_t curLane = 0; curLane < lanes; curLane += 1) {
+          for (size_t curEntry = 0; curEntry < entries; curEntry += 1) {
+            laneJacobians[curEntry * lanes + curLane] = groupJacobians[curLane * entries + curEntry];
+          }
+        }
+
+        laneAdjoints.assign(structure.numberOfIdentifiers * lanes, Real());
+        lhsAdjoints.resize(lanes);
+
+        for (size_t curOut = 0; curOut < outputs; curOut += 1) {
+          Real* outputAdjoint = &laneAdjoints[structure.outputs[curOut] * lanes];
+          for (size_t curLane = 0; curLane < lanes; curLane += 1) {
+            outputAdjoint[curLane] = Real(1.0);
+          }
+
+          size_t curEntry = entries;
+          for (size_t curStmt = structure.lhs.size(); curStmt > 0; curStmt -= 1) {
+            Real* lhsAdjoint = &laneAdjoints[structure.lhs[curStmt - 1] * lanes];
+            for (size_t curLane = 0; curLane < lanes; curLane += 1) {
+              lhsAdjoints[curLane] = lhsAdjoint[curLane];
+              lhsAdjoint[curLane] = Real();
+            }
+
+            size_t const size = structure.statementSizes[curStmt - 1];
+            curEntry -= size;
+            for (size_t curArg = curEntry; curArg < curEntry + size; curArg += 1) {
+              Real* rhsAdjoint = &laneAdjoints[structure.rhs[curArg] * lanes];
+              Real const* jacobian = &laneJacobians[curArg * lanes];
+              for (size_t curLane = 0; curLane < lanes; curLane += 1) {
+                rhsAdjoint[curLane] += jacobian[curLane] * lhsAdjoints[curLane];
+              }
+            }
+          }
+
+          for (size_t curIn = 0; curIn < inputs; curIn += 1) {
+            Real* inputAdjoint = &laneAdjoints[structure.inputs[curIn] * lanes];
+            for (size_t curLane = 0; curLane < lanes; curLane += 1) {
+              batchJacobians[jacobianOffsets[groupBegin + curLane] + curOut * inputs + curIn] = inputAdjoint[curLane];
+              inputAdjoint[curLane] = Real();
+            }
+          }
+
+          // Remove adjoints on identifiers that are not inputs.
+          std::fill(laneAdjoints.begin(), laneAdjoints.end(), Real());
+        }
+      }
+
+      /// Preaccumulate a single region with mapped adjoints.
+      void evaluateRegion(size_t const region) {
+        size_t const inputs = inputOffsets[region + 1] - inputOffsets[region];
+        size_t const outputs = outputOffsets[region + 1] - outputOffsets[region];
+
+        regionJacobian.resize(outputs, inputs);
+
+        MappedAdjoints<Identifier, Gradient> mappedAdjoints;
+        Algorithms<Type, false>::computeJacobianCustomAdjoints(
+            regionStarts[region], regionEnds[region], batchInputData.data() + inputOffsets[region], inputs,
+            batchOutputData.data() + outputOffsets[region], outputs, regionJacobian, mappedAdjoints);
+
+        for (size_t curOut = 0; curOut < outputs; curOut += 1) {
+          for (size_t curIn = 0; curIn < inputs; curIn += 1) {
+            batchJacobians[jacobianOffsets[region] + curOut * inputs + curIn] = regionJacobian(curOut, curIn);
+          }
+        }
+      }
+
+      /// Store the Jacobians of all regions on the tape with the storage logic of the PreaccumulationHelper.
+      void storeBatchJacobians() {
+        Tape& tape = Type::getTape();
+
+        for (size_t curRegion = 0; curRegion < regionStarts.size(); curRegion += 1) {
+          this->inputData.assign(batchInputData.begin() + inputOffsets[curRegion],
+                                 batchInputData.begin() + inputOffsets[curRegion + 1]);
+          this->inputTapeData.assign(batchInputTapeData.begin() + inputOffsets[curRegion],
+                                     batchInputTapeData.begin() + inputOffsets[curRegion + 1]);
+          this->outputData.assign(batchOutputData.begin() + outputOffsets[curRegion],
+                                  batchOutputData.begin() + outputOffsets[curRegion + 1]);
+          this->outputValues.assign(batchOutputValues.begin() + outputOffsets[curRegion],
+                                    batchOutputValues.begin() + outputOffsets[curRegion + 1]);
+
+          size_t const inputs = this->inputData.size();
+          size_t const outputs = this->outputData.size();
+
+          this->resizeJacobian();
+          for (size_t curOut = 0; curOut < outputs; curOut += 1) {
+            for (size_t curIn = 0; curIn < inputs; curIn += 1) {
+              this->jacobian(curOut, curIn) = batchJacobians[jacobianOffsets[curRegion] + curOut * inputs + curIn];
+            }
+          }
+
+          this->storeJacobian();
+
+          EventSystem<Tape>::notifyPreaccFinishListeners(tape);
+        }
+      }
+
+      void clearBatch() {
+        regionStarts.clear();
+        regionEnds.clear();
+        inputOffsets.resize(1);
+        outputOffsets.resize(1);
+        jacobianOffsets.resize(1);
+        batchInputData.clear();
+        batchInputTapeData.clear();
+        batchOutputData.clear();
+        batchOutputValues.clear();
+      }
+  };
+}
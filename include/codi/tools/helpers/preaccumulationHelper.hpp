@@ -35,6 +35,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <vector>
 
 #include "../../config.h"
@@ -46,6 +47,7 @@
 #include "../../traits/tapeTraits.hpp"
 #include "../algorithms.hpp"
 #include "../data/customAdjoints.hpp"
+#include "../data/identifierMap.hpp"
 #include "../data/jacobian.hpp"
 
 /** \copydoc codi::Namespace */
@@ -100,12 +102,21 @@ namespace codi {
       std::vector<Gradient> localAdjoints;  ///< Vector of local adjoint variables. Persists across preaccumulations to
                                             ///< reduce the number of allocations, can be freed anytime if needed.
 
+      /// finishLocalAdjoints() uses a local adjoint vector for tapes without editing support if the vector is at most
+      /// this many times larger than the number of identifiers in the region. Otherwise, a map is used.
+      size_t localAdjointVectorRatio;
+
     protected:
 
       Position startPos;                        ///< Starting position for the region.
+      Identifier startLargestIdentifier;        ///< Largest identifier of the tape at the start of the region.
       std::vector<Gradient> storedAdjoints;     ///< If adjoints of inputs should be stored, before the preaccumulation.
       JacobianCountNonZerosRow<Real> jacobian;  ///< Jacobian for the preaccumulation.
 
+      IdentifierMap<Identifier> identifierMap;  ///< Remapping of identifiers in the preprocessed tape.
+      std::vector<Identifier> newInputData;     ///< Remapped input identifiers in the preprocessed tape.
+      std::vector<Identifier> newOutputData;    ///< Remapped output identifiers in the preprocessed tape.
+
     public:
 
       /// Constructor
@@ -115,9 +126,14 @@ namespace codi {
             outputData(),
             outputValues(),
             localAdjoints(),
+            localAdjointVectorRatio(16),
             startPos(),
+            startLargestIdentifier(),
             storedAdjoints(),
-            jacobian(0, 0) {}
+            jacobian(0, 0),
+            identifierMap(),
+            newInputData(),
+            newOutputData() {}
 
       /// Add multiple additional inputs. Inputs need to be of type `Type`. Called after start().
       template<typename... Inputs>
@@ -143,6 +159,7 @@ namespace codi {
           outputValues.clear();
 
           startPos = tape.getPosition();
+          startLargestIdentifier = tape.getParameter(TapeParameters::LargestIdentifier);
 
           addInputRecursive(inputs...);
         }
@@ -222,17 +239,13 @@ namespace codi {
       }
 
       /// Finish the preaccumulation region and perform the preaccumulation. Uses local adjoints instead of adjoints
-      /// from the tape. Behaves either like finishLocalMappedAdjoints or like finishLocalAdjointVectorPreprocessTape,
-      /// depending on which is more efficient given the numbers of inputs and outputs. See `addOutput()` for outputs.
+      /// from the tape. Behaves like finishLocalAdjointVectorPreprocessTape if the tape supports editing. Otherwise,
+      /// behaves like finishLocalAdjointVector if the local adjoint vector is small compared to the region, see
+      /// localAdjointVectorRatio, and like finishLocalMappedAdjoints if not. See `addOutput()` for outputs.
       template<typename... Outputs>
       void finishLocalAdjoints(Outputs&... outputs) {
         auto coreRoutine = [this]() {
-          if (std::min(inputData.size(), outputData.size()) > 1) {
-            computeJacobianLocalAdjointVectorPreprocessTapeIfAvailable<Tape>();  // otherwise
-                                                                                 // computeJacobianLocalMappedAdjoints
-          } else {
-            computeJacobianLocalMappedAdjoints();
-          }
+          computeJacobianLocalAdjointsAuto<Tape>();
         };
 
         finishInternal(coreRoutine, outputs...);
@@ -263,7 +276,7 @@ namespace codi {
         finishInternal(coreRoutine, outputs...);
       }
 
-    private:
+    protected:
 
       // Tape supports editing -> use a map to edit its identifiers. Disabled by SFINAE otherwise.
       template<typename Tape>
@@ -277,6 +290,29 @@ namespace codi {
         computeJacobianLocalMappedAdjoints();
       }
 
+      // Tape supports editing -> remap its identifiers. Disabled by SFINAE otherwise.
+      template<typename Tape>
+      TapeTraits::EnableIfSupportsEditing<Tape> computeJacobianLocalAdjointsAuto() {
+        computeJacobianLocalAdjointVectorPreprocessTape();
+      }
+
+      // Tape does not support editing -> choose between a local adjoint vector and a map for the adjoints. Disabled by
+      // SFINAE otherwise.
+      template<typename Tape>
+      TapeTraits::EnableIfNoEditing<Tape> computeJacobianLocalAdjointsAuto() {
+        Identifier largestIdentifier = Type::getTape().getParameter(TapeParameters::LargestIdentifier);
+
+        size_t requiredVectorSize = largestIdentifier + 1;
+        size_t regionSize = (largestIdentifier - startLargestIdentifier) + inputData.size() + outputData.size();
+
+        if (requiredVectorSize <= this->localAdjoints.size() ||
+            requiredVectorSize <= localAdjointVectorRatio * regionSize) {
+          computeJacobianLocalAdjointVector();
+        } else {
+          computeJacobianLocalMappedAdjoints();
+        }
+      }
+
       // Tape supports editing -> use a map to edit its identifiers. Disabled by SFINAE otherwise.
       template<typename Tape>
       TapeTraits::EnableIfSupportsEditing<Tape> computeJacobianLocalAdjointVectorOffsetIfAvailable() {
@@ -467,23 +503,20 @@ namespace codi {
 
         resizeJacobian();
 
-        // Used internally for remapping identifiers.
-        using IdentifierMap = std::map<typename Tape::Identifier, typename Tape::Identifier>;
-
-        // Build a map of identifiers, remapping identifiers in the recording to contiguous ones.
-        auto nextIdentifier = typename Tape::Identifier() + 1;
-        IdentifierMap oldToNewIdentifierMap;
+        // Build a map of identifiers, remapping identifiers in the recording to contiguous ones. The map, the remapped
+        // inputs and outputs, and the local adjoints are members so that their memory is reused.
+        Identifier nextIdentifier = Identifier() + 1;
+        identifierMap.clear();
 
         // If needed, inserts the old identifier into the map and associates it with the next identifier. Either way,
         // returns the associated new identifier.
-        auto accessOldToNewIdentifierMap = [&](typename Tape::Identifier const& oldIdentifier) ->
-            typename Tape::Identifier const& {
-              auto result = oldToNewIdentifierMap.insert({oldIdentifier, nextIdentifier});
-              if (result.second) {  // insertion took place
-                ++nextIdentifier;
-              }
-              return result.first->second;
-            };
+        auto accessOldToNewIdentifierMap = [&](Identifier const& oldIdentifier) -> Identifier {
+          auto result = identifierMap.insert(oldIdentifier, nextIdentifier);
+          if (result.second) {  // insertion took place
+            ++nextIdentifier;
+          }
+          return result.first;
+        };
 
         // Remap input identifiers explicitly to account for inputs that are actually not used in the recording.
         for (auto const& oldIdentifier : inputData) {
@@ -495,7 +528,7 @@ namespace codi {
           accessOldToNewIdentifierMap(oldIdentifier);
         }
 
-        auto editIdentifier = [&](typename Tape::Identifier& oldIdentifier) {
+        auto editIdentifier = [&](Identifier& oldIdentifier) {
           oldIdentifier = accessOldToNewIdentifierMap(oldIdentifier);
         };
 
@@ -503,29 +536,29 @@ namespace codi {
         tape.editIdentifiers(editIdentifier, startPos, endPos);
 
         // Build new vectors of input and output identifiers.
-        std::vector<typename Tape::Identifier> newInputData;
-        newInputData.reserve(inputData.size());
+        newInputData.clear();
         for (auto const& identifier : inputData) {
-          newInputData.push_back(oldToNewIdentifierMap[identifier]);
+          newInputData.push_back(identifierMap[identifier]);
         }
 
-        std::vector<typename Tape::Identifier> newOutputData;
-        newOutputData.reserve(outputData.size());
+        newOutputData.clear();
         for (auto const& identifier : outputData) {
-          newOutputData.push_back(oldToNewIdentifierMap[identifier]);
+          newOutputData.push_back(identifierMap[identifier]);
         }
 
-        // The association with the original input/output identifiers and Jacobian entries is made by position, so we no
-        // longer need the identifier map.
-        oldToNewIdentifierMap.clear();
-
-        // Create local adjoints. nextIdentifier holds the local adjoint vector size.
-        std::vector<typename Tape::Gradient> localAdjoints(nextIdentifier);
+        // Reuse the local adjoints. nextIdentifier holds the required size.
+        if (this->localAdjoints.size() < (size_t)nextIdentifier) {
+          this->localAdjoints.resize(nextIdentifier);
+        }
 
         // Preaccumulation with remapped identifiers on local adjoints.
         Algorithms<Type, false>::computeJacobianCustomAdjoints(startPos, endPos, newInputData.data(),
                                                                newInputData.size(), newOutputData.data(),
-                                                               newOutputData.size(), jacobian, localAdjoints.data());
+                                                               newOutputData.size(), jacobian,
+                                                               this->localAdjoints.data());
+
+        // Adjoints of inputs that were not declared are not reset by the Jacobian computation.
+        std::fill(this->localAdjoints.begin(), this->localAdjoints.begin() + nextIdentifier, Gradient());
 
         tape.resetTo(startPos, false);
       }
@@ -559,10 +592,14 @@ namespace codi {
             //          \bar t_2 += \bar w                                 (1 entry)
             //          \bar u_i += df/du_i * \bar w for i = 507 ... 530   (24 entries)
             //
+            // Tapes that support wide statements store up to Config::MaxWideArgumentSize nonzeros in one statement.
+            //
+            bool const storeWide = Tape::SupportsWideStatements && nonZerosLeft >= (int)Config::MinWideArgumentSize &&
+                                   nonZerosLeft <= (int)Config::MaxWideArgumentSize;
             while (nonZerosLeft > 0) {
               // Calculate the number of Jacobians for this statement.
               int jacobiansForStatement = nonZerosLeft;
-              if (jacobiansForStatement > (int)Config::MaxArgumentSize) {
+              if (!storeWide && jacobiansForStatement > (int)Config::MaxArgumentSize) {
                 jacobiansForStatement = (int)Config::MaxArgumentSize - 1;
                 if (staggeringActive) {  // Except in the first round, one Jacobian is reserved for the staggering.
                   jacobiansForStatement -= 1;
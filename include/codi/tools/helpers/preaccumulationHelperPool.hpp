@@ -0,0 +1,99 @@
+/*
+ * CoDiPack, a Code Differentiation Package
+ *
+ * Copyright (C) 2015-2026 Chair for Scientific Computing (SciComp), RPTU University Kaiserslautern-Landau
+ * Homepage: http://scicomp.rptu.de
+ * Contact:  Prof. Nicolas R. Gauger (codi@scicomp.uni-kl.de)
+ *
+ * Lead developers: Max Sagebaum, Johannes Blühdorn (SciComp, RPTU University Kaiserslautern-Landau)
+ *
+ * This file is part of CoDiPack (http://scicomp.rptu.de/software/codi).
+ *
+ * CoDiPack is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * CoDiPack is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * See the GNU General Public License for more details.
+ * You should have received a copy of the GNU
+ * General Public License along with CoDiPack.
+ * If not, see <http://www.gnu.org/licenses/>.
+ *
+ * For other licensing options please contact us.
+ *
+ * Authors:
+ *  - SciComp, RPTU University Kaiserslautern-Landau:
+ *    - Max Sagebaum
+ *    - Johannes Blühdorn
+ *    - Former members:
+ *      - Tim Albring
+ */
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "../../config.h"
+#include "../../misc/macros.hpp"
+#include "../parallel/threadInformationInterface.hpp"
+#include "preaccumulationHelper.hpp"
+
+/** \copydoc codi::Namespace */
+namespace codi {
+
+  /**
+   * @brief One preaccumulation helper for each thread.
+   *
+   * The preaccumulation helpers work on the tape of the calling thread, e.g., the thread-local tapes of a
+   * ParallelActiveType. They keep their memory across preaccumulations, so each thread should reuse its own helper
+   * instead of creating a new one for every region. The pool creates the helper of a thread on its first call of get(),
+   * which then returns the same helper for all further calls from this thread.
+   *
+   * \snippet documentation/examples/Example_35_Batched_preaccumulation.cpp Helper pool
+   *
+   * The pool has to be created before the parallel region and shared by all threads.
+   *
+   * @tparam T_Type               The CoDiPack type on which the evaluations take place.
+   * @tparam T_ThreadInformation  Thread information facilities. See ThreadInformationInterface.
+   * @tparam T_Helper             The helper type, e.g., PreaccumulationHelper or PreaccumulationBatchHelper.
+   */
+  template<typename T_Type, typename T_ThreadInformation = DefaultThreadInformation,
+           typename T_Helper = PreaccumulationHelper<T_Type>>
+  struct PreaccumulationHelperPool {
+    public:
+
+      /// See PreaccumulationHelperPool.
+      using Type = CODI_DD(T_Type, CODI_DEFAULT_LHS_EXPRESSION);
+      /// See PreaccumulationHelperPool.
+      using ThreadInformation = CODI_DD(T_ThreadInformation, DefaultThreadInformation);
+      using Helper = CODI_DD(T_Helper, PreaccumulationHelper<Type>);  ///< See PreaccumulationHelperPool.
+
+    private:
+
+      // Each thread only accesses its own entry. The helpers are allocated by their threads.
+      std::vector<std::unique_ptr<Helper>> helpers;
+
+    public:
+
+      /// Constructor.
+      PreaccumulationHelperPool() : helpers(ThreadInformation::getMaxThreads()) {}
+
+      /// Helper of the calling thread.
+      CODI_INLINE Helper& get() {
+        int const threadId = ThreadInformation::getThreadId();
+        codiAssert(threadId < (int)helpers.size());
+
+        std::unique_ptr<Helper>& helper = helpers[threadId];
+        if (nullptr == helper) CODI_Unlikely {
+          helper.reset(new Helper());
+        }
+
+        return *helper;
+      }
+  };
+}
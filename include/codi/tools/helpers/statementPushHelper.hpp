@@ -34,6 +34,9 @@
  */
 #pragma once
 
+#include <array>
+#include <vector>
+
 #include "../../config.h"
 #include "../../expressions/lhsExpressionInterface.hpp"
 #include "../../misc/macros.hpp"
@@ -146,10 +149,21 @@ namespace codi {
       /// See LhsExpressionInterface.
       using Tape = typename Type::Tape;
 
+      /// Maximum number of arguments of a statement. Larger if the tape supports wide statements, see
+      /// Config::WideStatements.
+      static size_t constexpr MaxStatementSize =
+          Tape::SupportsWideStatements ? Config::MaxWideArgumentSize : Config::MaxArgumentSize;
+
     protected:
-      TapeData indexData[Config::MaxArgumentSize];  ///< Storage for the identifiers of the arguments.
-      Real jacobianData[Config::MaxArgumentSize];   ///< Storage for the Jacobians of the arguments.
-      size_t dataPos;                               ///< Current number of arguments.
+
+      /// Fixed size storage for narrow statements, growing storage for wide statements.
+      template<typename T>
+      using Storage = typename std::conditional<Tape::SupportsWideStatements, std::vector<T>,
+                                                std::array<T, Config::MaxArgumentSize>>::type;
+
+      Storage<TapeData> indexData;  ///< Storage for the identifiers of the arguments.
+      Storage<Real> jacobianData;   ///< Storage for the Jacobians of the arguments.
+      size_t dataPos;               ///< Current number of arguments.
 
     public:
 
@@ -166,14 +180,16 @@ namespace codi {
       void pushArgument(Type const& arg, Real const& jacobian) {
         Tape& tape = Type::getTape();
 
-        if (Config::MaxArgumentSize <= dataPos) {
-          CODI_EXCEPTION("Adding more than %zu arguments to a statement.", Config::MaxArgumentSize);
+        if (MaxStatementSize <= dataPos) {
+          CODI_EXCEPTION("Adding more than %zu arguments to a statement.", MaxStatementSize);
         }
 
         if (CODI_ENABLE_CHECK(Config::CheckTapeActivity, tape.isActive())) {
           if (CODI_ENABLE_CHECK(Config::CheckZeroIndex, 0 != arg.getIdentifier())) {
             if (CODI_ENABLE_CHECK(Config::IgnoreInvalidJacobians, RealTraits::isTotalFinite(jacobian))) {
               if (CODI_ENABLE_CHECK(Config::CheckJacobianIsZero, !RealTraits::isTotalZero(jacobian))) {
+                growStorage(indexData, dataPos);
+                growStorage(jacobianData, dataPos);
                 indexData[dataPos] = arg.getTapeData();
                 jacobianData[dataPos] = jacobian;
                 dataPos += 1;
@@ -188,7 +204,24 @@ namespace codi {
         Tape& tape = Type::getTape();
 
         if (CODI_ENABLE_CHECK(Config::CheckTapeActivity, tape.isActive())) {
-          if (0 != dataPos) {
+          if (Tape::SupportsWideStatements && Config::MaxArgumentSize <= dataPos &&
+              dataPos < Config::MinWideArgumentSize) CODI_Unlikely {
+            // Too large for a narrow and too small for a wide statement. Split off a temporary with the first
+            // arguments.
+            size_t constexpr firstSize = Config::MaxArgumentSize - 1;
+            Type temporary;
+
+            tape.storeManual(primal, temporary.getTapeData(), firstSize);
+            for (size_t i = 0; i < firstSize; ++i) {
+              tape.pushJacobianManual(jacobianData[i], 0.0, indexData[i]);
+            }
+
+            tape.storeManual(primal, lhs.getTapeData(), dataPos - firstSize + 1);
+            tape.pushJacobianManual(1.0, 0.0, temporary.getTapeData());
+            for (size_t i = firstSize; i < dataPos; ++i) {
+              tape.pushJacobianManual(jacobianData[i], 0.0, indexData[i]);
+            }
+          } else if (0 != dataPos) {
             tape.storeManual(primal, lhs.getTapeData(), dataPos);
 
             for (size_t i = 0; i < dataPos; ++i) {
@@ -201,6 +234,20 @@ namespace codi {
       }
 
       /// @}
+
+    private:
+
+      template<typename T>
+      CODI_INLINE static void growStorage(std::vector<T>& storage, size_t const& pos) {
+        if (storage.size() <= pos) {
+          storage.resize(std::max(2 * storage.size(), (size_t)Config::MaxArgumentSize));
+        }
+      }
+
+      template<typename T>
+      CODI_INLINE static void growStorage(std::array<T, Config::MaxArgumentSize>& storage, size_t const& pos) {
+        CODI_UNUSED(storage, pos);
+      }
   };
 
 #ifndef DOXYGEN_DISABLE
@@ -125,13 +125,14 @@ namespace codi {
       ///
       /// Calls applyToInput for all inputs, then applyPostInputLogic, afterwards applyToOutput, and finally
       ///  applyPostOutputLogic.
-      CODI_INLINE void handleStatement(Identifier& lhsIndex, codi::Config::ArgumentSize const& size,
-                                       Real const* jacobians, Identifier* rhsIdentifiers) {
+      template<typename JacobianReal>
+      CODI_INLINE void handleStatement(Identifier& lhsIndex, size_t const& size, JacobianReal const* jacobians,
+                                       Identifier* rhsIdentifiers) {
         CODI_UNUSED(jacobians);
 
         Impl& impl = cast();
 
-        for (codi::Config::ArgumentSize i = 0; i < size; i += 1) {
+        for (size_t i = 0; i < size; i += 1) {
           impl.applyToInput(rhsIdentifiers[i]);
         }
         impl.applyPostInputLogic();
@@ -0,0 +1,188 @@
+/*
+ * CoDiPack, a Code Differentiation Package
+ *
+ * Copyright (C) 2015-2026 Chair for Scientific Computing (SciComp), RPTU University Kaiserslautern-Landau
+ * Homepage: http://scicomp.rptu.de
+ * Contact:  Prof. Nicolas R. Gauger (codi@scicomp.uni-kl.de)
+ *
+ * Lead developers: Max Sagebaum, Johannes Blühdorn (SciComp, RPTU University Kaiserslautern-Landau)
+ *
+ * This file is part of CoDiPack (http://scicomp.rptu.de/software/codi).
+ *
+ * CoDiPack is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * CoDiPack is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * See the GNU General Public License for more details.
+ * You should have received a copy of the GNU
+ * General Public License along with CoDiPack.
+ * If not, see <http://www.gnu.org/licenses/>.
+ *
+ * For other licensing options please contact us.
+ *
+ * Authors:
+ *  - SciComp, RPTU University Kaiserslautern-Landau:
+ *    - Max Sagebaum
+ *    - Johannes Blühdorn
+ *    - Former members:
+ *      - Tim Albring
+ */
+#pragma once
+
+#include <cmath>
+
+#include "../../config.h"
+#include "../../misc/macros.hpp"
+
+/** \copydoc codi::Namespace */
+namespace codi {
+
+  /**
+   * @brief Dense linear algebra kernels for the low level functions in tools/lowlevelFunctions/linearAlgebra.
+   *
+   * The kernels work on plain arrays, matrices are stored in row major order. They do not depend on Eigen and are
+   * written as simple loops over contiguous memory such that the compiler can vectorize them. Reductions use four
+   * independent accumulators, a single accumulator would prevent the vectorization without fast math flags.
+   *
+   * Kernels with an \c add argument either overwrite the result (false) or update it (true).
+   */
+  namespace BlasKernels {
+
+    /// \f$ r \mathrel{(+)}= a x \f$ with \f$ r, x \in \R^n \f$.
+    template<typename T>
+    CODI_INLINE void axpy(T* r, T const& a, T const* x, int n, bool add) {
+      if (add) {
+        for (int i = 0; i < n; i += 1) {
+          r[i] += a * x[i];
+        }
+      } else {
+        for (int i = 0; i < n; i += 1) {
+          r[i] = a * x[i];
+        }
+      }
+    }
+
+    /// \f$ r \mathrel{(+)}= x \f$ with \f$ r, x \in \R^n \f$.
+    template<typename T>
+    CODI_INLINE void copy(T* r, T const* x, int n, bool add) {
+      if (add) {
+        for (int i = 0; i < n; i += 1) {
+          r[i] += x[i];
+        }
+      } else {
+        for (int i = 0; i < n; i += 1) {
+          r[i] = x[i];
+        }
+      }
+    }
+
+    /// \f$ x^T y \f$ with \f$ x, y \in \R^n \f$.
+    template<typename T>
+    CODI_INLINE T dot(T const* x, T const* y, int n) {
+      T s0 = T();
+      T s1 = T();
+      T s2 = T();
+      T s3 = T();
+
+      int i = 0;
+      for (; i + 3 < n; i += 4) {
+        s0 += x[i + 0] * y[i + 0];
+        s1 += x[i + 1] * y[i + 1];
+        s2 += x[i + 2] * y[i + 2];
+        s3 += x[i + 3] * y[i + 3];
+      }
+      for (; i < n; i += 1) {
+        s0 += x[i] * y[i];
+      }
+
+      return (s0 + s1) + (s2 + s3);
+    }
+
+    /// \f$ \sum_i x_i \f$ with \f$ x \in \R^n \f$.
+    template<typename T>
+    CODI_INLINE T sum(T const* x, int n) {
+      T s0 = T();
+      T s1 = T();
+      T s2 = T();
+      T s3 = T();
+
+      int i = 0;
+      for (; i + 3 < n; i += 4) {
+        s0 += x[i + 0];
+        s1 += x[i + 1];
+        s2 += x[i + 2];
+        s3 += x[i + 3];
+      }
+      for (; i < n; i += 1) {
+        s0 += x[i];
+      }
+
+      return (s0 + s1) + (s2 + s3);
+    }
+
+    /// \f$ \|x\|_2 \f$ with \f$ x \in \R^n \f$.
+    template<typename T>
+    CODI_INLINE T norm2(T const* x, int n) {
+      using std::sqrt;
+
+      return sqrt(dot(x, x, n));
+    }
+
+    /// \f$ y \mathrel{(+)}= A x \f$ with \f$ A \in \R^{n \times m} \f$, \f$ x \in \R^m \f$ and \f$ y \in \R^n \f$.
+    template<typename T>
+    CODI_INLINE void gemv(T* y, T const* A, T const* x, int n, int m, bool add) {
+      for (int i = 0; i < n; i += 1) {
+        T value = dot(&A[i * m], x, m);
+        if (add) {
+          y[i] += value;
+        } else {
+          y[i] = value;
+        }
+      }
+    }
+
+    /// \f$ y \mathrel{(+)}= A^T x \f$ with \f$ A \in \R^{n \times m} \f$, \f$ x \in \R^n \f$ and \f$ y \in \R^m \f$.
+    template<typename T>
+    CODI_INLINE void gemvTransposed(T* y, T const* A, T const* x, int n, int m, bool add) {
+      if (!add) {
+        for (int j = 0; j < m; j += 1) {
+          y[j] = T();
+        }
+      }
+
+      // Row wise updates keep the inner loop on contiguous memory.
+      for (int i = 0; i < n; i += 1) {
+        axpy(y, x[i], &A[i * m], m, true);
+      }
+    }
+
+    /// \f$ A \mathrel{(+)}= x y^T \f$ with \f$ A \in \R^{n \times m} \f$, \f$ x \in \R^n \f$ and \f$ y \in \R^m \f$.
+    template<typename T>
+    CODI_INLINE void ger(T* A, T const* x, T const* y, int n, int m, bool add) {
+      for (int i = 0; i < n; i += 1) {
+        axpy(&A[i * m], x[i], y, m, add);
+      }
+    }
+
+    /**
+     * @brief Maximum number of CoDiPack values that can be handled by one low level function call.
+     *
+     * The data of a low level function is limited by Config::LowLevelFunctionDataSizeMax. Each value requires at most
+     * one primal value and one identifier on the tape, plus a small fixed overhead for the activity and the sizes.
+     *
+     * @tparam Type  CoDiPack type.
+     */
+    template<typename Type>
+    CODI_INLINE int maxValuesPerCall() {
+      size_t constexpr ValueSize = sizeof(typename Type::Real) + sizeof(typename Type::Identifier);
+      size_t constexpr Overhead = 64;
+
+      return (int)((Config::LowLevelFunctionDataSizeMax - Overhead) / ValueSize);
+    }
+  }
+}
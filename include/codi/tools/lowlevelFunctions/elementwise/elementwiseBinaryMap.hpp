@@ -0,0 +1,500 @@
+/*
+ * CoDiPack, a Code Differentiation Package
+ *
+ * Copyright (C) 2015-2026 Chair for Scientific Computing (SciComp), RPTU University Kaiserslautern-Landau
+ * Homepage: http://scicomp.rptu.de
+ * Contact:  Prof. Nicolas R. Gauger (codi@scicomp.uni-kl.de)
+ *
+ * Lead developers: Max Sagebaum, Johannes Blühdorn (SciComp, RPTU University Kaiserslautern-Landau)
+ *
+ * This file is part of CoDiPack (http://scicomp.rptu.de/software/codi).
+ *
+ * CoDiPack is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * CoDiPack is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * See the GNU General Public License for more details.
+ * You should have received a copy of the GNU
+ * General Public License along with CoDiPack.
+ * If not, see <http://www.gnu.org/licenses/>.
+ *
+ * For other licensing options please contact us.
+ *
+ * Authors:
+ *  - SciComp, RPTU University Kaiserslautern-Landau:
+ *    - Max Sagebaum
+ *    - Johannes Blühdorn
+ *    - Former members:
+ *      - Tim Albring
+ */
+#pragma once
+
+#include <algorithm>
+
+#include <codi/config.h>
+
+#include <codi/expressions/computeExpression.hpp>
+#include <codi/expressions/real/binaryOperators.hpp>
+#include <codi/misc/macros.hpp>
+#include <codi/tools/lowlevelFunctions/blasKernels.hpp>
+#include <codi/tools/lowlevelFunctions/generationHelperCoDiPack.hpp>
+#include <codi/tools/lowlevelFunctions/lowLevelFunctionCreationUtilities.hpp>
+
+/** \copydoc codi::Namespace */
+namespace codi {
+
+  /**
+   * @brief Low level function for the element-wise map \f$ r_i = f(a_i, b_i) \f$.
+   *
+   * Either argument can be a scalar that is used for all elements, which is indicated by a size of one. See
+   * ExtFunc_elementwiseUnaryMap for the general approach.
+   *
+   * @tparam T_Type       CoDiPack type.
+   * @tparam T_Operation  Implementation of BinaryJacobianOperation, e.g. OperationPow.
+   */
+  template<typename T_Type, template<typename> class T_Operation>
+  struct ExtFunc_elementwiseBinaryMap {
+      using Type = CODI_DD(T_Type, CODI_DEFAULT_LHS);  ///< See ExtFunc_elementwiseBinaryMap.
+      using Real = typename Type::Real;                ///< Real of the type.
+      using Identifier = typename Type::Identifier;    ///< Identifier of the type.
+      using Operation = T_Operation<Real>;             ///< Element-wise operation.
+
+      /// Abbreviation for vector access interface.
+      using AdjointVectorAccess = codi::VectorAccessInterface<Real, Identifier>*;
+      /// Abbreviation for tape.
+      using Tape = typename Type::Tape;
+
+      /// See LowLevelFunctionEntry.
+      using IterCallback = typename LowLevelFunctionEntry<Tape, Real, Identifier>::IterCallback;
+
+      /// Id for this function.
+      static codi::Config::LowLevelFunctionToken ID;
+
+    private:
+
+      using LLFH = codi::LowLevelFunctionCreationUtilities<2>;
+
+      using Trait_a = typename LLFH::ActiveStoreTrait<Type*>;
+      using Trait_b = typename LLFH::ActiveStoreTrait<Type*>;
+      using Trait_r = typename LLFH::ActiveStoreTrait<Type*>;
+      using Trait_n = typename LLFH::PassiveStoreTrait<int, int>;
+
+      using Gradient = typename Trait_a::Gradient;
+
+      /// Restored data of one tape entry.
+      struct Data {
+          typename Trait_a::ArgumentStore a_store = {};
+          typename Trait_b::ArgumentStore b_store = {};
+          typename Trait_r::ArgumentStore r_store = {};
+          typename Trait_n::Store n = {};
+          typename Trait_n::Store n_a = {};
+          typename Trait_n::Store n_b = {};
+
+          bool active_a = false;
+          bool active_b = false;
+
+          CODI_INLINE void restore(codi::ByteDataView& dataStore, codi::TemporaryMemory& allocator) {
+            typename LLFH::ActivityStoreType activityStore = {};
+
+            LLFH::restoreActivity(&dataStore, activityStore);
+            active_a = LLFH::getActivity(activityStore, 0);
+            active_b = LLFH::getActivity(activityStore, 1);
+            Trait_n::restore(&dataStore, allocator, 1, true, n);
+            Trait_n::restore(&dataStore, allocator, 1, true, n_a);
+            Trait_n::restore(&dataStore, allocator, 1, true, n_b);
+            Trait_a::restore(&dataStore, allocator, n_a, LLFH::createRestoreActions(true, false, active_a, true),
+                             a_store);
+            Trait_b::restore(&dataStore, allocator, n_b, LLFH::createRestoreActions(true, false, active_b, true),
+                             b_store);
+            Trait_r::restore(&dataStore, allocator, n, LLFH::createRestoreActions(false, true, false, true), r_store);
+          }
+
+          CODI_INLINE void getInputPrimals(AdjointVectorAccess adjoints) {
+            if (active_a) {
+              Trait_a::getPrimalsFromVector(adjoints, n_a, a_store.identifierIn(), a_store.primal());
+            }
+            if (active_b) {
+              Trait_b::getPrimalsFromVector(adjoints, n_b, b_store.identifierIn(), b_store.primal());
+            }
+          }
+      };
+
+      /// Index step for an argument of size \c size. Zero for scalar arguments.
+      CODI_INLINE static int stride(int size, int n) {
+        return (1 == size && 1 != n) ? 0 : 1;
+      }
+
+    public:
+
+      /// Function for forward interpretation.
+      CODI_INLINE static void forward(Tape* tape, codi::ByteDataView& dataStore, AdjointVectorAccess adjoints) {
+        codi::TemporaryMemory& allocator = tape->getTemporaryMemory();
+        codiAssert(allocator.isEmpty());  // No memory should be allocated. We would free it at the end.
+
+        Data data;
+        data.restore(dataStore, allocator);
+        int n = data.n;
+
+        if (Tape::HasPrimalValues) {
+          data.getInputPrimals(adjoints);
+        }
+
+        for (size_t curDim = 0; curDim < adjoints->getVectorSize(); curDim += 1) {
+          // Get input gradients.
+          if (data.active_a) {
+            Trait_a::getGradients(adjoints, data.n_a, false, data.a_store.identifierIn(), data.a_store.gradientIn(),
+                                  curDim);
+          }
+          if (data.active_b) {
+            Trait_b::getGradients(adjoints, data.n_b, false, data.b_store.identifierIn(), data.b_store.gradientIn(),
+                                  curDim);
+          }
+
+          callForward(data.a_store.primal(), data.active_a, data.a_store.gradientIn(), data.n_a,
+                      data.b_store.primal(), data.active_b, data.b_store.gradientIn(), data.n_b, data.r_store.primal(),
+                      data.r_store.gradientOut(), n);
+
+          if (Tape::HasPrimalValues && 0 == curDim) {
+            if (!Tape::LinearIndexHandling) {
+              // Update old primal values.
+              Trait_r::getPrimalsFromVector(adjoints, n, data.r_store.identifierOut(), data.r_store.oldPrimal());
+            }
+
+            // Set new primal values.
+            Trait_r::setPrimalsIntoVector(adjoints, n, data.r_store.identifierOut(), data.r_store.primal());
+          }
+
+          Trait_r::setGradients(adjoints, n, false, data.r_store.identifierOut(), data.r_store.gradientOut(),
+                                curDim);
+        }
+
+        allocator.free();
+      }
+
+      /// Forward function for derivative evaluation. Computes also the primal results.
+      CODI_INLINE static void callForward(Real const* a, bool active_a, Gradient const* a_d_in, int n_a, Real const* b,
+                                          bool active_b, Gradient const* b_d_in, int n_b, Real* r, Gradient* r_d_out,
+                                          int n) {
+        int s_a = stride(n_a, n);
+        int s_b = stride(n_b, n);
+
+        for (int i = 0; i < n; i += 1) {
+          r[i] = Operation::primal(a[i * s_a], b[i * s_b]);
+          r_d_out[i] = Gradient();
+          if (active_a) {
+            r_d_out[i] += Operation::gradientA(a[i * s_a], b[i * s_b], r[i]) * a_d_in[i * s_a];
+          }
+          if (active_b) {
+            r_d_out[i] += Operation::gradientB(a[i * s_a], b[i * s_b], r[i]) * b_d_in[i * s_b];
+          }
+        }
+      }
+
+      /// Function for reverse interpretation.
+      CODI_INLINE static void reverse(Tape* tape, codi::ByteDataView& dataStore, AdjointVectorAccess adjoints) {
+        codi::TemporaryMemory& allocator = tape->getTemporaryMemory();
+        codiAssert(allocator.isEmpty());  // No memory should be allocated. We would free it at the end.
+
+        Data data;
+        data.restore(dataStore, allocator);
+        int n = data.n;
+
+        if (Tape::HasPrimalValues) {
+          if (!Tape::LinearIndexHandling) {
+            // Restore old primal values from outputs.
+            Trait_r::setPrimalsIntoVector(adjoints, n, data.r_store.identifierOut(), data.r_store.oldPrimal());
+          }
+
+          data.getInputPrimals(adjoints);
+        }
+
+        // The partial derivatives do not depend on the dimension.
+        Real* jacobianA = allocator.alloc<Real>(n);
+        Real* jacobianB = allocator.alloc<Real>(n);
+        computeJacobian(data.a_store.primal(), data.active_a, data.n_a, data.b_store.primal(), data.active_b,
+                        data.n_b, jacobianA, jacobianB, n);
+
+        for (size_t curDim = 0; curDim < adjoints->getVectorSize(); curDim += 1) {
+          Trait_r::getGradients(adjoints, n, true, data.r_store.identifierOut(), data.r_store.gradientOut(), curDim);
+
+          callReverse(jacobianA, data.active_a, data.a_store.gradientIn(), data.n_a, jacobianB, data.active_b,
+                      data.b_store.gradientIn(), data.n_b, data.r_store.gradientOut(), n);
+
+          if (data.active_a) {
+            Trait_a::setGradients(adjoints, data.n_a, true, data.a_store.identifierIn(), data.a_store.gradientIn(),
+                                  curDim);
+          }
+          if (data.active_b) {
+            Trait_b::setGradients(adjoints, data.n_b, true, data.b_store.identifierIn(), data.b_store.gradientIn(),
+                                  curDim);
+          }
+        }
+
+        allocator.free();
+      }
+
+      /// Partial derivatives of all elements with respect to the active arguments.
+      CODI_INLINE static void computeJacobian(Real const* a, bool active_a, int n_a, Real const* b, bool active_b,
+                                              int n_b, Real* jacobianA, Real* jacobianB, int n) {
+        int s_a = stride(n_a, n);
+        int s_b = stride(n_b, n);
+
+        for (int i = 0; i < n; i += 1) {
+          Real r = Operation::primal(a[i * s_a], b[i * s_b]);
+          if (active_a) {
+            jacobianA[i] = Operation::gradientA(a[i * s_a], b[i * s_b], r);
+          }
+          if (active_b) {
+            jacobianB[i] = Operation::gradientB(a[i * s_a], b[i * s_b], r);
+          }
+        }
+      }
+
+      /// Reverse function for derivative evaluation.
+      CODI_INLINE static void callReverse(Real const* jacobianA, bool active_a, Gradient* a_b_in, int n_a,
+                                          Real const* jacobianB, bool active_b, Gradient* b_b_in, int n_b,
+                                          Gradient const* r_b_out, int n) {
+        if (active_a) {
+          reverseArgument(jacobianA, a_b_in, n_a, r_b_out, n);
+        }
+        if (active_b) {
+          reverseArgument(jacobianB, b_b_in, n_b, r_b_out, n);
+        }
+      }
+
+      /// Function for primal interpretation.
+      CODI_INLINE static void primal(Tape* tape, codi::ByteDataView& dataStore, AdjointVectorAccess adjoints) {
+        codi::TemporaryMemory& allocator = tape->getTemporaryMemory();
+        codiAssert(allocator.isEmpty());  // No memory should be allocated. We would free it at the end.
+
+        Data data;
+        data.restore(dataStore, allocator);
+        int n = data.n;
+
+        data.getInputPrimals(adjoints);
+
+        callPrimal(data.a_store.primal(), data.n_a, data.b_store.primal(), data.n_b, data.r_store.primal(), n);
+
+        if (!Tape::LinearIndexHandling) {
+          // Update old primal values.
+          Trait_r::getPrimalsFromVector(adjoints, n, data.r_store.identifierOut(), data.r_store.oldPrimal());
+        }
+
+        // Set new primal values.
+        Trait_r::setPrimalsIntoVector(adjoints, n, data.r_store.identifierOut(), data.r_store.primal());
+
+        allocator.free();
+      }
+
+      /// Primal computation function.
+      CODI_INLINE static void callPrimal(Real const* a, int n_a, Real const* b, int n_b, Real* r, int n) {
+        int s_a = stride(n_a, n);
+        int s_b = stride(n_b, n);
+
+        for (int i = 0; i < n; i += 1) {
+          r[i] = Operation::primal(a[i * s_a], b[i * s_b]);
+        }
+      }
+
+      /// Function for deletion of contents.
+      CODI_INLINE static void del(Tape* tape, codi::ByteDataView& dataStore) {
+        codi::TemporaryMemory& allocator = tape->getTemporaryMemory();
+        codiAssert(allocator.isEmpty());  // No memory should be allocated. We would free it at the end.
+
+        Data data;
+        data.restore(dataStore, allocator);
+
+        allocator.free();
+      }
+
+      /// Function for iteration over inputs.
+      CODI_INLINE static void iterateInputs(Tape* tape, codi::ByteDataView& dataStore, IterCallback func,
+                                            void* userData) {
+        codi::TemporaryMemory& allocator = tape->getTemporaryMemory();
+        codiAssert(allocator.isEmpty());  // No memory should be allocated. We would free it at the end.
+
+        Data data;
+        data.restore(dataStore, allocator);
+
+        if (data.active_a) {
+          for (int i = 0; i < data.n_a; i += 1) {
+            func(&data.a_store.identifierIn()[i], userData);
+          }
+        }
+        if (data.active_b) {
+          for (int i = 0; i < data.n_b; i += 1) {
+            func(&data.b_store.identifierIn()[i], userData);
+          }
+        }
+
+        allocator.free();
+      }
+
+      /// Function for iteration over outputs.
+      CODI_INLINE static void iterateOutputs(Tape* tape, codi::ByteDataView& dataStore, IterCallback func,
+                                             void* userData) {
+        codi::TemporaryMemory& allocator = tape->getTemporaryMemory();
+        codiAssert(allocator.isEmpty());  // No memory should be allocated. We would free it at the end.
+
+        Data data;
+        data.restore(dataStore, allocator);
+
+        for (int i = 0; i < data.n; i += 1) {
+          func(&data.r_store.identifierOut()[i], userData);
+        }
+
+        allocator.free();
+      }
+
+      /// Store on tape.
+      CODI_INLINE static void evalAndStore(Type const* a, int n_a, Type const* b, int n_b, Type* r, int n) {
+        Tape& tape = Type::getTape();
+        codi::TemporaryMemory& allocator = tape.getTemporaryMemory();
+
+        typename LLFH::ActivityStoreType activityStore = {};
+        typename Trait_a::ArgumentStore a_store = {};
+        typename Trait_b::ArgumentStore b_store = {};
+        typename Trait_r::ArgumentStore r_store = {};
+
+        // Detect activity.
+        bool active_a = Trait_a::isActive(a, n_a);
+        bool active_b = Trait_b::isActive(b, n_b);
+        bool active = active_a | active_b;
+
+        if (active) {
+          // Store function.
+          registerOnTape();
+
+          // Count data size.
+          size_t dataSize = LLFH::countActivitySize();
+          dataSize += 3 * Trait_n::countSize(n, 1, true);
+          dataSize += Trait_a::countSize(a, n_a, LLFH::createStoreActions(active, true, false, active_a, true));
+          dataSize += Trait_b::countSize(b, n_b, LLFH::createStoreActions(active, true, false, active_b, true));
+          dataSize += Trait_r::countSize(r, n, LLFH::createStoreActions(active, false, true, false, true));
+
+          // Reserve data.
+          codi::ByteDataView dataStore = {};
+          tape.pushLowLevelFunction(ID, dataSize, dataStore);
+
+          // Store data.
+          LLFH::setActivity(activityStore, 0, active_a);
+          LLFH::setActivity(activityStore, 1, active_b);
+          LLFH::storeActivity(&dataStore, activityStore);
+          Trait_n::store(&dataStore, allocator, n, 1, true);
+          Trait_n::store(&dataStore, allocator, n_a, 1, true);
+          Trait_n::store(&dataStore, allocator, n_b, 1, true);
+          Trait_a::store(&dataStore, allocator, a, n_a,
+                         LLFH::createStoreActions(active, true, false, active_a, true), a_store);
+          Trait_b::store(&dataStore, allocator, b, n_b,
+                         LLFH::createStoreActions(active, true, false, active_b, true), b_store);
+          Trait_r::store(&dataStore, allocator, r, n, LLFH::createStoreActions(active, false, true, false, true),
+                         r_store);
+        } else {
+          // Prepare passive evaluation.
+          Trait_a::store(nullptr, allocator, a, n_a, LLFH::createStoreActions(active, true, false, active_a, true),
+                         a_store);
+          Trait_b::store(nullptr, allocator, b, n_b, LLFH::createStoreActions(active, true, false, active_b, true),
+                         b_store);
+          Trait_r::store(nullptr, allocator, r, n, LLFH::createStoreActions(active, false, true, false, true),
+                         r_store);
+        }
+
+        callPrimal(a_store.primal(), n_a, b_store.primal(), n_b, r_store.primal(), n);
+
+        if (active) {
+          // Elements with only passive arguments produce passive outputs.
+          int s_a = stride(n_a, n);
+          int s_b = stride(n_b, n);
+          for (int i = 0; i < n; i += 1) {
+            bool activeElement = (active_a && 0 != a_store.identifierIn()[i * s_a]) ||
+                                 (active_b && 0 != b_store.identifierIn()[i * s_b]);
+            if (!activeElement) {
+              r_store.identifierOut()[i] = 0;
+            }
+          }
+        }
+
+        Trait_r::setExternalFunctionOutput(active, r, n, r_store.identifierOut(), r_store.primal(),
+                                           r_store.oldPrimal());
+
+        allocator.free();
+      }
+
+      /// Register function on tape.
+      CODI_INLINE static void registerOnTape() {
+        if (codi::Config::LowLevelFunctionTokenInvalid == ID) {
+          using Entry = codi::LowLevelFunctionEntry<Tape, Real, Identifier>;
+          ID = Type::getTape().registerLowLevelFunction(
+              Entry(reverse, forward, primal, del, iterateInputs, iterateOutputs));
+        }
+      }
+
+    private:
+
+      /// Adjoint update for one argument. Scalar arguments receive the sum over all elements.
+      CODI_INLINE static void reverseArgument(Real const* jacobian, Gradient* x_b_in, int n_x, Gradient const* r_b_out,
+                                              int n) {
+        if (0 == stride(n_x, n)) {
+          Gradient sum = Gradient();
+          for (int i = 0; i < n; i += 1) {
+            sum += jacobian[i] * r_b_out[i];
+          }
+          x_b_in[0] = sum;
+        } else {
+          for (int i = 0; i < n; i += 1) {
+            x_b_in[i] = jacobian[i] * r_b_out[i];
+          }
+        }
+      }
+  };
+
+  template<typename Type, template<typename> class Operation>
+  codi::Config::LowLevelFunctionToken ExtFunc_elementwiseBinaryMap<Type, Operation>::ID =
+      codi::Config::LowLevelFunctionTokenInvalid;
+
+  /**
+   * Low level function for \f$ r_i = f(a_i, b_i) \f$ with
+   *   - \f$ a \in \R^{n_a} \f$, \f$ b \in \R^{n_b} \f$ and \f$ n_a, n_b \in \{1, n\} \f$
+   *   - \f$ r \in \R^{n} \f$
+   *
+   * Arguments of size one are used for all elements. The function \f$ f \f$ is given by an implementation of
+   * BinaryJacobianOperation, e.g.
+   * \code{.cpp}
+   *   codi::elementwiseMap<codi::OperationPow>(x, n, &exponent, 1, r, n);
+   * \endcode
+   * \c r may be the same array as \c a or \c b. Large arrays are split into blocks such that each block fits into one
+   * low level function entry.
+   */
+  template<template<typename> class Operation, typename Type>
+  void elementwiseMap(Type const* a, int n_a, Type const* b, int n_b, Type* r, int n) {
+    codiAssert(n_a == 1 || n_a == n);
+    codiAssert(n_b == 1 || n_b == n);
+
+    int blockSize = BlasKernels::maxValuesPerCall<Type>() / 3;
+
+    for (int start = 0; start < n; start += blockSize) {
+      int size = std::min(blockSize, n - start);
+      Type const* aBlock = (1 == n_a) ? a : &a[start];
+      Type const* bBlock = (1 == n_b) ? b : &b[start];
+      ExtFunc_elementwiseBinaryMap<Type, Operation>::evalAndStore(aBlock, (1 == n_a) ? 1 : size, bBlock,
+                                                                   (1 == n_b) ? 1 : size, &r[start], size);
+    }
+  }
+
+  /// \f$ r_i = x_i^p \f$ with a scalar exponent, see elementwiseMap.
+  template<typename Type>
+  void elementwisePow(Type const* x, Type const& p, Type* r, int n) {
+    elementwiseMap<OperationPow>(x, n, &p, 1, r, n);
+  }
+
+  /// \f$ r_i = a_i b_i \f$, see elementwiseMap.
+  template<typename Type>
+  void elementwiseMultiply(Type const* a, Type const* b, Type* r, int n) {
+    elementwiseMap<OperationMultiply>(a, n, b, n, r, n);
+  }
+}
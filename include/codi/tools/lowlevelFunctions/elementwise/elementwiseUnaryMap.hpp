@@ -0,0 +1,418 @@
+/*
+ * CoDiPack, a Code Differentiation Package
+ *
+ * Copyright (C) 2015-2026 Chair for Scientific Computing (SciComp), RPTU University Kaiserslautern-Landau
+ * Homepage: http://scicomp.rptu.de
+ * Contact:  Prof. Nicolas R. Gauger (codi@scicomp.uni-kl.de)
+ *
+ * Lead developers: Max Sagebaum, Johannes Blühdorn (SciComp, RPTU University Kaiserslautern-Landau)
+ *
+ * This file is part of CoDiPack (http://scicomp.rptu.de/software/codi).
+ *
+ * CoDiPack is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * CoDiPack is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * See the GNU General Public License for more details.
+ * You should have received a copy of the GNU
+ * General Public License along with CoDiPack.
+ * If not, see <http://www.gnu.org/licenses/>.
+ *
+ * For other licensing options please contact us.
+ *
+ * Authors:
+ *  - SciComp, RPTU University Kaiserslautern-Landau:
+ *    - Max Sagebaum
+ *    - Johannes Blühdorn
+ *    - Former members:
+ *      - Tim Albring
+ */
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <string>
+
+#include <codi/config.h>
+
+#include <codi/expressions/computeExpression.hpp>
+#include <codi/expressions/real/unaryOperators.hpp>
+#include <codi/misc/macros.hpp>
+#include <codi/tools/lowlevelFunctions/blasKernels.hpp>
+#include <codi/tools/lowlevelFunctions/generationHelperCoDiPack.hpp>
+#include <codi/tools/lowlevelFunctions/lowLevelFunctionCreationUtilities.hpp>
+
+/** \copydoc codi::Namespace */
+namespace codi {
+
+  /// UnaryJacobianOperation implementation for the logistic function \f$ 1 / (1 + \exp(-x)) \f$.
+  template<typename T_Real>
+  struct OperationSigmoid : public UnaryJacobianOperation<T_Real, OperationSigmoid<T_Real>> {
+    public:
+
+      using Real = CODI_DD(T_Real, double);  ///< See UnaryJacobianOperation.
+
+      /// \copydoc UnaryJacobianOperation::primal
+      template<typename Arg>
+      static CODI_INLINE Real primal(Arg const& arg) {
+        return 1.0 / (1.0 + exp(-arg));
+      }
+
+      /// \copydoc UnaryJacobianOperation::gradient
+      template<typename Arg>
+      static CODI_INLINE Real gradient(Arg const& arg, Real const& result) {
+        CODI_UNUSED(arg);
+        return result * (1.0 - result);
+      }
+
+      /// \copydoc UnaryJacobianOperation::getMathRep()
+      static CODI_INLINE std::string getMathRep() {
+        return "sigmoid()";
+      }
+  };
+
+  /**
+   * @brief Low level function for the element-wise map \f$ r_i = f(x_i) \f$.
+   *
+   * The map is recorded as one tape entry instead of one statement per element. Only the input values are stored, the
+   * results and the derivatives are recomputed in the forward, reverse, and primal evaluation in one loop over the
+   * arrays.
+   *
+   * @tparam T_Type       CoDiPack type.
+   * @tparam T_Operation  Implementation of UnaryJacobianOperation, e.g. OperationExp.
+   */
+  template<typename T_Type, template<typename> class T_Operation>
+  struct ExtFunc_elementwiseUnaryMap {
+      using Type = CODI_DD(T_Type, CODI_DEFAULT_LHS);  ///< See ExtFunc_elementwiseUnaryMap.
+      using Real = typename Type::Real;                ///< Real of the type.
+      using Identifier = typename Type::Identifier;    ///< Identifier of the type.
+      using Operation = T_Operation<Real>;             ///< Element-wise operation.
+
+      /// Abbreviation for vector access interface.
+      using AdjointVectorAccess = codi::VectorAccessInterface<Real, Identifier>*;
+      /// Abbreviation for tape.
+      using Tape = typename Type::Tape;
+
+      /// See LowLevelFunctionEntry.
+      using IterCallback = typename LowLevelFunctionEntry<Tape, Real, Identifier>::IterCallback;
+
+      /// Id for this function.
+      static codi::Config::LowLevelFunctionToken ID;
+
+    private:
+
+      using LLFH = codi::LowLevelFunctionCreationUtilities<1>;
+
+      using Trait_x = typename LLFH::ActiveStoreTrait<Type*>;
+      using Trait_r = typename LLFH::ActiveStoreTrait<Type*>;
+      using Trait_n = typename LLFH::PassiveStoreTrait<int, int>;
+
+      using Gradient = typename Trait_x::Gradient;
+
+      /// Restored data of one tape entry.
+      struct Data {
+          typename Trait_x::ArgumentStore x_store = {};
+          typename Trait_r::ArgumentStore r_store = {};
+          typename Trait_n::Store n = {};
+
+          CODI_INLINE void restore(codi::ByteDataView& dataStore, codi::TemporaryMemory& allocator) {
+            typename LLFH::ActivityStoreType activityStore = {};
+
+            LLFH::restoreActivity(&dataStore, activityStore);
+            Trait_n::restore(&dataStore, allocator, 1, true, n);
+            Trait_x::restore(&dataStore, allocator, n, LLFH::createRestoreActions(true, false, true, true), x_store);
+            Trait_r::restore(&dataStore, allocator, n, LLFH::createRestoreActions(false, true, false, true), r_store);
+          }
+      };
+
+    public:
+
+      /// Function for forward interpretation.
+      CODI_INLINE static void forward(Tape* tape, codi::ByteDataView& dataStore, AdjointVectorAccess adjoints) {
+        codi::TemporaryMemory& allocator = tape->getTemporaryMemory();
+        codiAssert(allocator.isEmpty());  // No memory should be allocated. We would free it at the end.
+
+        Data data;
+        data.restore(dataStore, allocator);
+        int n = data.n;
+
+        if (Tape::HasPrimalValues) {
+          // Get primal values for inputs.
+          Trait_x::getPrimalsFromVector(adjoints, n, data.x_store.identifierIn(), data.x_store.primal());
+        }
+
+        for (size_t curDim = 0; curDim < adjoints->getVectorSize(); curDim += 1) {
+          Trait_x::getGradients(adjoints, n, false, data.x_store.identifierIn(), data.x_store.gradientIn(), curDim);
+
+          callForward(data.x_store.primal(), data.x_store.gradientIn(), data.r_store.primal(),
+                      data.r_store.gradientOut(), n);
+
+          if (Tape::HasPrimalValues && 0 == curDim) {
+            if (!Tape::LinearIndexHandling) {
+              // Update old primal values.
+              Trait_r::getPrimalsFromVector(adjoints, n, data.r_store.identifierOut(), data.r_store.oldPrimal());
+            }
+
+            // Set new primal values.
+            Trait_r::setPrimalsIntoVector(adjoints, n, data.r_store.identifierOut(), data.r_store.primal());
+          }
+
+          Trait_r::setGradients(adjoints, n, false, data.r_store.identifierOut(), data.r_store.gradientOut(),
+                                curDim);
+        }
+
+        allocator.free();
+      }
+
+      /// Forward function for derivative evaluation. Computes also the primal results.
+      CODI_INLINE static void callForward(Real const* x, Gradient const* x_d_in, Real* r, Gradient* r_d_out, int n) {
+        for (int i = 0; i < n; i += 1) {
+          r[i] = Operation::primal(x[i]);
+          r_d_out[i] = Operation::gradient(x[i], r[i]) * x_d_in[i];
+        }
+      }
+
+      /// Function for reverse interpretation.
+      CODI_INLINE static void reverse(Tape* tape, codi::ByteDataView& dataStore, AdjointVectorAccess adjoints) {
+        codi::TemporaryMemory& allocator = tape->getTemporaryMemory();
+        codiAssert(allocator.isEmpty());  // No memory should be allocated. We would free it at the end.
+
+        Data data;
+        data.restore(dataStore, allocator);
+        int n = data.n;
+
+        if (Tape::HasPrimalValues) {
+          if (!Tape::LinearIndexHandling) {
+            // Restore old primal values from outputs.
+            Trait_r::setPrimalsIntoVector(adjoints, n, data.r_store.identifierOut(), data.r_store.oldPrimal());
+          }
+
+          // Get primal values for inputs.
+          Trait_x::getPrimalsFromVector(adjoints, n, data.x_store.identifierIn(), data.x_store.primal());
+        }
+
+        // The partial derivatives do not depend on the dimension.
+        Real* jacobian = data.r_store.primal();
+        for (int i = 0; i < n; i += 1) {
+          jacobian[i] = Operation::gradient(data.x_store.primal()[i], Operation::primal(data.x_store.primal()[i]));
+        }
+
+        for (size_t curDim = 0; curDim < adjoints->getVectorSize(); curDim += 1) {
+          Trait_r::getGradients(adjoints, n, true, data.r_store.identifierOut(), data.r_store.gradientOut(), curDim);
+
+          callReverse(jacobian, data.x_store.gradientIn(), data.r_store.gradientOut(), n);
+
+          Trait_x::setGradients(adjoints, n, true, data.x_store.identifierIn(), data.x_store.gradientIn(), curDim);
+        }
+
+        allocator.free();
+      }
+
+      /// Reverse function for derivative evaluation.
+      CODI_INLINE static void callReverse(Real const* jacobian, Gradient* x_b_in, Gradient const* r_b_out, int n) {
+        for (int i = 0; i < n; i += 1) {
+          x_b_in[i] = jacobian[i] * r_b_out[i];
+        }
+      }
+
+      /// Function for primal interpretation.
+      CODI_INLINE static void primal(Tape* tape, codi::ByteDataView& dataStore, AdjointVectorAccess adjoints) {
+        codi::TemporaryMemory& allocator = tape->getTemporaryMemory();
+        codiAssert(allocator.isEmpty());  // No memory should be allocated. We would free it at the end.
+
+        Data data;
+        data.restore(dataStore, allocator);
+        int n = data.n;
+
+        Trait_x::getPrimalsFromVector(adjoints, n, data.x_store.identifierIn(), data.x_store.primal());
+
+        callPrimal(data.x_store.primal(), data.r_store.primal(), n);
+
+        if (!Tape::LinearIndexHandling) {
+          // Update old primal values.
+          Trait_r::getPrimalsFromVector(adjoints, n, data.r_store.identifierOut(), data.r_store.oldPrimal());
+        }
+
+        // Set new primal values.
+        Trait_r::setPrimalsIntoVector(adjoints, n, data.r_store.identifierOut(), data.r_store.primal());
+
+        allocator.free();
+      }
+
+      /// Primal computation function.
+      CODI_INLINE static void callPrimal(Real const* x, Real* r, int n) {
+        for (int i = 0; i < n; i += 1) {
+          r[i] = Operation::primal(x[i]);
+        }
+      }
+
+      /// Function for deletion of contents.
+      CODI_INLINE static void del(Tape* tape, codi::ByteDataView& dataStore) {
+        codi::TemporaryMemory& allocator = tape->getTemporaryMemory();
+        codiAssert(allocator.isEmpty());  // No memory should be allocated. We would free it at the end.
+
+        Data data;
+        data.restore(dataStore, allocator);
+
+        allocator.free();
+      }
+
+      /// Function for iteration over inputs.
+      CODI_INLINE static void iterateInputs(Tape* tape, codi::ByteDataView& dataStore, IterCallback func,
+                                            void* userData) {
+        codi::TemporaryMemory& allocator = tape->getTemporaryMemory();
+        codiAssert(allocator.isEmpty());  // No memory should be allocated. We would free it at the end.
+
+        Data data;
+        data.restore(dataStore, allocator);
+
+        for (int i = 0; i < data.n; i += 1) {
+          func(&data.x_store.identifierIn()[i], userData);
+        }
+
+        allocator.free();
+      }
+
+      /// Function for iteration over outputs.
+      CODI_INLINE static void iterateOutputs(Tape* tape, codi::ByteDataView& dataStore, IterCallback func,
+                                             void* userData) {
+        codi::TemporaryMemory& allocator = tape->getTemporaryMemory();
+        codiAssert(allocator.isEmpty());  // No memory should be allocated. We would free it at the end.
+
+        Data data;
+        data.restore(dataStore, allocator);
+
+        for (int i = 0; i < data.n; i += 1) {
+          func(&data.r_store.identifierOut()[i], userData);
+        }
+
+        allocator.free();
+      }
+
+      /// Store on tape.
+      CODI_INLINE static void evalAndStore(Type const* x, Type* r, int n) {
+        Tape& tape = Type::getTape();
+        codi::TemporaryMemory& allocator = tape.getTemporaryMemory();
+
+        typename LLFH::ActivityStoreType activityStore = {};
+        typename Trait_x::ArgumentStore x_store = {};
+        typename Trait_r::ArgumentStore r_store = {};
+
+        // Detect activity.
+        bool active = Trait_x::isActive(x, n);
+
+        if (active) {
+          // Store function.
+          registerOnTape();
+
+          // Count data size.
+          size_t dataSize = LLFH::countActivitySize();
+          dataSize += Trait_n::countSize(n, 1, true);
+          dataSize += Trait_x::countSize(x, n, LLFH::createStoreActions(active, true, false, true, true));
+          dataSize += Trait_r::countSize(r, n, LLFH::createStoreActions(active, false, true, false, true));
+
+          // Reserve data.
+          codi::ByteDataView dataStore = {};
+          tape.pushLowLevelFunction(ID, dataSize, dataStore);
+
+          // Store data.
+          LLFH::setActivity(activityStore, 0, true);
+          LLFH::storeActivity(&dataStore, activityStore);
+          Trait_n::store(&dataStore, allocator, n, 1, true);
+          Trait_x::store(&dataStore, allocator, x, n, LLFH::createStoreActions(active, true, false, true, true),
+                         x_store);
+          Trait_r::store(&dataStore, allocator, r, n, LLFH::createStoreActions(active, false, true, false, true),
+                         r_store);
+        } else {
+          // Prepare passive evaluation.
+          Trait_x::store(nullptr, allocator, x, n, LLFH::createStoreActions(active, true, false, true, true), x_store);
+          Trait_r::store(nullptr, allocator, r, n, LLFH::createStoreActions(active, false, true, false, true),
+                         r_store);
+        }
+
+        callPrimal(x_store.primal(), r_store.primal(), n);
+
+        if (active) {
+          // Passive entries of x produce passive outputs.
+          for (int i = 0; i < n; i += 1) {
+            if (0 == x_store.identifierIn()[i]) {
+              r_store.identifierOut()[i] = 0;
+            }
+          }
+        }
+
+        Trait_r::setExternalFunctionOutput(active, r, n, r_store.identifierOut(), r_store.primal(),
+                                           r_store.oldPrimal());
+
+        allocator.free();
+      }
+
+      /// Register function on tape.
+      CODI_INLINE static void registerOnTape() {
+        if (codi::Config::LowLevelFunctionTokenInvalid == ID) {
+          using Entry = codi::LowLevelFunctionEntry<Tape, Real, Identifier>;
+          ID = Type::getTape().registerLowLevelFunction(
+              Entry(reverse, forward, primal, del, iterateInputs, iterateOutputs));
+        }
+      }
+  };
+
+  template<typename Type, template<typename> class Operation>
+  codi::Config::LowLevelFunctionToken ExtFunc_elementwiseUnaryMap<Type, Operation>::ID =
+      codi::Config::LowLevelFunctionTokenInvalid;
+
+  /**
+   * Low level function for \f$ r_i = f(x_i) \f$ with
+   *   - \f$ x, r \in \R^{n} \f$
+   *
+   * The function \f$ f \f$ is given by an implementation of UnaryJacobianOperation, e.g.
+   * \code{.cpp}
+   *   codi::elementwiseMap<codi::OperationTanh>(x, r, n);
+   * \endcode
+   * \c r may be the same array as \c x. Large arrays are split into blocks such that each block fits into one low level
+   * function entry.
+   */
+  template<template<typename> class Operation, typename Type>
+  void elementwiseMap(Type const* x, Type* r, int n) {
+    int blockSize = BlasKernels::maxValuesPerCall<Type>() / 2;
+
+    for (int start = 0; start < n; start += blockSize) {
+      ExtFunc_elementwiseUnaryMap<Type, Operation>::evalAndStore(&x[start], &r[start], std::min(blockSize, n - start));
+    }
+  }
+
+  /// \f$ r_i = \exp(x_i) \f$, see elementwiseMap.
+  template<typename Type>
+  void elementwiseExp(Type const* x, Type* r, int n) {
+    elementwiseMap<OperationExp>(x, r, n);
+  }
+
+  /// \f$ r_i = \log(x_i) \f$, see elementwiseMap.
+  template<typename Type>
+  void elementwiseLog(Type const* x, Type* r, int n) {
+    elementwiseMap<OperationLog>(x, r, n);
+  }
+
+  /// \f$ r_i = \sqrt{x_i} \f$, see elementwiseMap.
+  template<typename Type>
+  void elementwiseSqrt(Type const* x, Type* r, int n) {
+    elementwiseMap<OperationSqrt>(x, r, n);
+  }
+
+  /// \f$ r_i = \tanh(x_i) \f$, see elementwiseMap.
+  template<typename Type>
+  void elementwiseTanh(Type const* x, Type* r, int n) {
+    elementwiseMap<OperationTanh>(x, r, n);
+  }
+
+  /// \f$ r_i = 1 / (1 + \exp(-x_i)) \f$, see elementwiseMap.
+  template<typename Type>
+  void elementwiseSigmoid(Type const* x, Type* r, int n) {
+    elementwiseMap<OperationSigmoid>(x, r, n);
+  }
+}
@@ -0,0 +1,620 @@
+/*
+ * CoDiPack, a Code Differentiation Package
+ *
+ * Copyright (C) 2015-2026 Chair for Scientific Computing (SciComp), RPTU University Kaiserslautern-Landau
+ * Homepage: http://scicomp.rptu.de
+ * Contact:  Prof. Nicolas R. Gauger (codi@scicomp.uni-kl.de)
+ *
+ * Lead developers: Max Sagebaum, Johannes Blühdorn (SciComp, RPTU University Kaiserslautern-Landau)
+ *
+ * This file is part of CoDiPack (http://scicomp.rptu.de/software/codi).
+ *
+ * CoDiPack is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * CoDiPack is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * See the GNU General Public License for more details.
+ * You should have received a copy of the GNU
+ * General Public License along with CoDiPack.
+ * If not, see <http://www.gnu.org/licenses/>.
+ *
+ * For other licensing options please contact us.
+ *
+ * Authors:
+ *  - SciComp, RPTU University Kaiserslautern-Landau:
+ *    - Max Sagebaum
+ *    - Johannes Blühdorn
+ *    - Former members:
+ *      - Tim Albring
+ */
+#pragma once
+
+#include <algorithm>
+#include <vector>
+
+#include <codi/config.h>
+
+#include <codi/misc/macros.hpp>
+#include <codi/tools/lowlevelFunctions/blasKernels.hpp>
+#include <codi/tools/lowlevelFunctions/generationHelperCoDiPack.hpp>
+#include <codi/tools/lowlevelFunctions/lowLevelFunctionCreationUtilities.hpp>
+
+/** \copydoc codi::Namespace */
+namespace codi {
+  /// Low level function generation for matrixTransposeVectorMultiplication.
+  template<typename Type>
+  struct ExtFunc_matrixTransposeVectorMultiplication {
+      using Real = typename Type::Real;              ///< Real of the type.
+      using Identifier = typename Type::Identifier;  ///< Identifier of the type.
+      /// Abbreviation for vector access interface.
+      using AdjointVectorAccess = codi::VectorAccessInterface<Real, Identifier>*;
+      /// Abbreviation for tape.
+      using Tape = typename Type::Tape;
+
+      /// See LowLevelFunctionEntry.
+      using IterCallback = typename LowLevelFunctionEntry<Tape, Real, Identifier>::IterCallback;
+
+      /// Id for this function.
+      static codi::Config::LowLevelFunctionToken ID;
+
+      /// Function for forward interpretation.
+      CODI_INLINE static void forward(Tape* tape, codi::ByteDataView& dataStore, AdjointVectorAccess adjoints) {
+        codi::TemporaryMemory& allocator = tape->getTemporaryMemory();
+        codiAssert(allocator.isEmpty());  // No memory should be allocated. We would free it at the end.
+        using LLFH = codi::LowLevelFunctionCreationUtilities<2>;
+
+        // Traits for arguments.
+        using Trait_A = typename LLFH::ActiveStoreTrait<Type*>;
+        using Trait_x = typename LLFH::ActiveStoreTrait<Type*>;
+        using Trait_y = typename LLFH::ActiveStoreTrait<Type*>;
+        using Trait_n = typename LLFH::PassiveStoreTrait<int, int>;
+        using Trait_m = typename LLFH::PassiveStoreTrait<int, int>;
+
+        // Declare variables.
+        typename LLFH::ActivityStoreType activityStore = {};
+        typename Trait_A::ArgumentStore A_store = {};
+        typename Trait_x::ArgumentStore x_store = {};
+        typename Trait_y::ArgumentStore y_store = {};
+        typename Trait_n::Store n = {};
+        typename Trait_m::Store m = {};
+
+        bool active_A = false;
+        bool active_x = false;
+
+        // Restore data.
+        LLFH::restoreActivity(&dataStore, activityStore);
+        active_A = LLFH::getActivity(activityStore, 0);
+        active_x = LLFH::getActivity(activityStore, 1);
+        Trait_n::restore(&dataStore, allocator, 1, true, n);
+        Trait_m::restore(&dataStore, allocator, 1, true, m);
+        Trait_A::restore(&dataStore, allocator, n * m,
+                         LLFH::createRestoreActions(true, false, active_A, Tape::HasPrimalValues || active_x), A_store);
+        Trait_x::restore(&dataStore, allocator, n,
+                         LLFH::createRestoreActions(true, false, active_x, Tape::HasPrimalValues || active_A), x_store);
+        Trait_y::restore(&dataStore, allocator, m, LLFH::createRestoreActions(false, true, false, true), y_store);
+
+        if (Tape::HasPrimalValues) {
+          // Get primal values for inputs.
+          if (active_A) {
+            Trait_A::getPrimalsFromVector(adjoints, n * m, A_store.identifierIn(), A_store.primal());
+          }
+          if (active_x) {
+            Trait_x::getPrimalsFromVector(adjoints, n, x_store.identifierIn(), x_store.primal());
+          }
+        }
+
+        for (size_t curDim = 0; curDim < adjoints->getVectorSize(); curDim += 1) {
+          // Get input gradients.
+          if (active_A) {
+            Trait_A::getGradients(adjoints, n * m, false, A_store.identifierIn(), A_store.gradientIn(), curDim);
+          }
+          if (active_x) {
+            Trait_x::getGradients(adjoints, n, false, x_store.identifierIn(), x_store.gradientIn(), curDim);
+          }
+
+          // Evaluate forward mode.
+          callForward(A_store.primal(), active_A, A_store.gradientIn(), x_store.primal(), active_x,
+                      x_store.gradientIn(), y_store.primal(), y_store.gradientOut(), n, m);
+
+          if (Tape::HasPrimalValues && 0 == curDim) {
+            if (!Tape::LinearIndexHandling) {
+              // Update old primal values.
+              Trait_y::getPrimalsFromVector(adjoints, m, y_store.identifierOut(), y_store.oldPrimal());
+            }
+
+            // Set new primal values.
+            Trait_y::setPrimalsIntoVector(adjoints, m, y_store.identifierOut(), y_store.primal());
+          }
+
+          Trait_y::setGradients(adjoints, m, false, y_store.identifierOut(), y_store.gradientOut(), curDim);
+        }
+
+        allocator.free();
+      }
+
+      /// Forward function for derivative evaluation.
+      CODI_INLINE static void callForward(typename codi::ActiveArgumentStoreTraits<Type*>::Real const* A, bool active_A,
+                                          typename codi::ActiveArgumentStoreTraits<Type*>::Gradient* A_d_in,
+                                          typename codi::ActiveArgumentStoreTraits<Type*>::Real const* x, bool active_x,
+                                          typename codi::ActiveArgumentStoreTraits<Type*>::Gradient* x_d_in,
+                                          typename codi::ActiveArgumentStoreTraits<Type*>::Real* y,
+                                          typename codi::ActiveArgumentStoreTraits<Type*>::Gradient* y_d_out,
+                                          typename codi::PassiveArgumentStoreTraits<int, int>::Store n,
+                                          typename codi::PassiveArgumentStoreTraits<int, int>::Store m) {
+        codi::CODI_UNUSED(A, active_A, A_d_in, x, active_x, x_d_in, y, y_d_out, n, m);
+        if (active_A) {
+          BlasKernels::gemvTransposed(y_d_out, A_d_in, x, n, m, false);
+        }
+        if (active_x) {
+          BlasKernels::gemvTransposed(y_d_out, A, x_d_in, n, m, active_A);
+        }
+        if (Tape::HasPrimalValues) {
+          // Jacobian tapes do not require the primal results.
+          BlasKernels::gemvTransposed(y, A, x, n, m, false);
+        }
+      }
+
+      /// Function for reverse interpretation.
+      CODI_INLINE static void reverse(Tape* tape, codi::ByteDataView& dataStore, AdjointVectorAccess adjoints) {
+        codi::TemporaryMemory& allocator = tape->getTemporaryMemory();
+        codiAssert(allocator.isEmpty());  // No memory should be allocated. We would free it at the end.
+        using LLFH = codi::LowLevelFunctionCreationUtilities<2>;
+
+        // Traits for arguments.
+        using Trait_A = typename LLFH::ActiveStoreTrait<Type*>;
+        using Trait_x = typename LLFH::ActiveStoreTrait<Type*>;
+        using Trait_y = typename LLFH::ActiveStoreTrait<Type*>;
+        using Trait_n = typename LLFH::PassiveStoreTrait<int, int>;
+        using Trait_m = typename LLFH::PassiveStoreTrait<int, int>;
+
+        // Declare variables.
+        typename LLFH::ActivityStoreType activityStore = {};
+        typename Trait_A::ArgumentStore A_store = {};
+        typename Trait_x::ArgumentStore x_store = {};
+        typename Trait_y::ArgumentStore y_store = {};
+        typename Trait_n::Store n = {};
+        typename Trait_m::Store m = {};
+
+        bool active_A = false;
+        bool active_x = false;
+
+        // Restore data.
+        LLFH::restoreActivity(&dataStore, activityStore);
+        active_A = LLFH::getActivity(activityStore, 0);
+        active_x = LLFH::getActivity(activityStore, 1);
+        Trait_n::restore(&dataStore, allocator, 1, true, n);
+        Trait_m::restore(&dataStore, allocator, 1, true, m);
+        Trait_A::restore(&dataStore, allocator, n * m,
+                         LLFH::createRestoreActions(true, false, active_A, Tape::HasPrimalValues || active_x), A_store);
+        Trait_x::restore(&dataStore, allocator, n,
+                         LLFH::createRestoreActions(true, false, active_x, Tape::HasPrimalValues || active_A), x_store);
+        Trait_y::restore(&dataStore, allocator, m, LLFH::createRestoreActions(false, true, false, true), y_store);
+
+        if (Tape::HasPrimalValues) {
+          if (!Tape::LinearIndexHandling) {
+            // Restore old primal values from outputs.
+            Trait_y::setPrimalsIntoVector(adjoints, m, y_store.identifierOut(), y_store.oldPrimal());
+          }
+
+          // Get primal values for inputs.
+          if (active_A && active_x) {
+            Trait_A::getPrimalsFromVector(adjoints, n * m, A_store.identifierIn(), A_store.primal());
+          }
+          if (active_x && active_A) {
+            Trait_x::getPrimalsFromVector(adjoints, n, x_store.identifierIn(), x_store.primal());
+          }
+        }
+
+        for (size_t curDim = 0; curDim < adjoints->getVectorSize(); curDim += 1) {
+          // Get output gradients.
+          Trait_y::getGradients(adjoints, m, true, y_store.identifierOut(), y_store.gradientOut(), curDim);
+
+          // Evaluate reverse mode.
+          callReverse(A_store.primal(), active_A, A_store.gradientIn(), x_store.primal(), active_x,
+                      x_store.gradientIn(), y_store.primal(), y_store.gradientOut(), n, m);
+
+          if (active_A) {
+            Trait_A::setGradients(adjoints, n * m, true, A_store.identifierIn(), A_store.gradientIn(), curDim);
+          }
+          if (active_x) {
+            Trait_x::setGradients(adjoints, n, true, x_store.identifierIn(), x_store.gradientIn(), curDim);
+          }
+        }
+
+        allocator.free();
+      }
+
+      /// Reverse function for derivative evaluation.
+      CODI_INLINE static void callReverse(typename codi::ActiveArgumentStoreTraits<Type*>::Real const* A, bool active_A,
+                                          typename codi::ActiveArgumentStoreTraits<Type*>::Gradient* A_b_in,
+                                          typename codi::ActiveArgumentStoreTraits<Type*>::Real const* x, bool active_x,
+                                          typename codi::ActiveArgumentStoreTraits<Type*>::Gradient* x_b_in,
+                                          typename codi::ActiveArgumentStoreTraits<Type*>::Real* y,
+                                          typename codi::ActiveArgumentStoreTraits<Type*>::Gradient* y_b_out,
+                                          typename codi::PassiveArgumentStoreTraits<int, int>::Store n,
+                                          typename codi::PassiveArgumentStoreTraits<int, int>::Store m) {
+        codi::CODI_UNUSED(A, active_A, A_b_in, x, active_x, x_b_in, y, y_b_out, n, m);
+        if (active_A) {
+          BlasKernels::ger(A_b_in, x, y_b_out, n, m, false);
+        }
+        if (active_x) {
+          BlasKernels::gemv(x_b_in, A, y_b_out, n, m, false);
+        }
+      }
+
+      /// Function for primal interpretation.
+      CODI_INLINE static void primal(Tape* tape, codi::ByteDataView& dataStore, AdjointVectorAccess adjoints) {
+        codi::TemporaryMemory& allocator = tape->getTemporaryMemory();
+        codiAssert(allocator.isEmpty());  // No memory should be allocated. We would free it at the end.
+        using LLFH = codi::LowLevelFunctionCreationUtilities<2>;
+
+        // Traits for arguments.
+        using Trait_A = typename LLFH::ActiveStoreTrait<Type*>;
+        using Trait_x = typename LLFH::ActiveStoreTrait<Type*>;
+        using Trait_y = typename LLFH::ActiveStoreTrait<Type*>;
+        using Trait_n = typename LLFH::PassiveStoreTrait<int, int>;
+        using Trait_m = typename LLFH::PassiveStoreTrait<int, int>;
+
+        // Declare variables.
+        typename LLFH::ActivityStoreType activityStore = {};
+        typename Trait_A::ArgumentStore A_store = {};
+        typename Trait_x::ArgumentStore x_store = {};
+        typename Trait_y::ArgumentStore y_store = {};
+        typename Trait_n::Store n = {};
+        typename Trait_m::Store m = {};
+
+        bool active_A = false;
+        bool active_x = false;
+
+        // Restore data.
+        LLFH::restoreActivity(&dataStore, activityStore);
+        active_A = LLFH::getActivity(activityStore, 0);
+        active_x = LLFH::getActivity(activityStore, 1);
+        Trait_n::restore(&dataStore, allocator, 1, true, n);
+        Trait_m::restore(&dataStore, allocator, 1, true, m);
+        Trait_A::restore(&dataStore, allocator, n * m,
+                         LLFH::createRestoreActions(true, false, active_A, Tape::HasPrimalValues || active_x), A_store);
+        Trait_x::restore(&dataStore, allocator, n,
+                         LLFH::createRestoreActions(true, false, active_x, Tape::HasPrimalValues || active_A), x_store);
+        Trait_y::restore(&dataStore, allocator, m, LLFH::createRestoreActions(false, true, false, true), y_store);
+
+        // Get primal values for inputs.
+        if (active_A) {
+          Trait_A::getPrimalsFromVector(adjoints, n * m, A_store.identifierIn(), A_store.primal());
+        }
+        if (active_x) {
+          Trait_x::getPrimalsFromVector(adjoints, n, x_store.identifierIn(), x_store.primal());
+        }
+
+        // Evaluate primal function.
+        callPrimal(false, A_store.primal(), active_A, A_store.identifierIn(), x_store.primal(), active_x,
+                   x_store.identifierIn(), y_store.primal(), y_store.identifierOut(), n, m);
+
+        if (!Tape::LinearIndexHandling) {
+          // Update old primal values.
+          Trait_y::getPrimalsFromVector(adjoints, m, y_store.identifierOut(), y_store.oldPrimal());
+        }
+
+        // Set new primal values.
+        Trait_y::setPrimalsIntoVector(adjoints, m, y_store.identifierOut(), y_store.primal());
+
+        allocator.free();
+      }
+
+      /// Function for deletion of contents.
+      CODI_INLINE static void del(Tape* tape, codi::ByteDataView& dataStore) {
+        codi::TemporaryMemory& allocator = tape->getTemporaryMemory();
+        codiAssert(allocator.isEmpty());  // No memory should be allocated. We would free it at the end.
+        using LLFH = codi::LowLevelFunctionCreationUtilities<2>;
+
+        // Traits for arguments.
+        using Trait_A = typename LLFH::ActiveStoreTrait<Type*>;
+        using Trait_x = typename LLFH::ActiveStoreTrait<Type*>;
+        using Trait_y = typename LLFH::ActiveStoreTrait<Type*>;
+        using Trait_n = typename LLFH::PassiveStoreTrait<int, int>;
+        using Trait_m = typename LLFH::PassiveStoreTrait<int, int>;
+
+        // Declare variables.
+        typename LLFH::ActivityStoreType activityStore = {};
+        typename Trait_A::ArgumentStore A_store = {};
+        typename Trait_x::ArgumentStore x_store = {};
+        typename Trait_y::ArgumentStore y_store = {};
+        typename Trait_n::Store n = {};
+        typename Trait_m::Store m = {};
+
+        bool active_A = false;
+        bool active_x = false;
+
+        // Restore data.
+        LLFH::restoreActivity(&dataStore, activityStore);
+        active_A = LLFH::getActivity(activityStore, 0);
+        active_x = LLFH::getActivity(activityStore, 1);
+        Trait_n::restore(&dataStore, allocator, 1, true, n);
+        Trait_m::restore(&dataStore, allocator, 1, true, m);
+        Trait_A::restore(&dataStore, allocator, n * m,
+                         LLFH::createRestoreActions(true, false, active_A, Tape::HasPrimalValues || active_x), A_store);
+        Trait_x::restore(&dataStore, allocator, n,
+                         LLFH::createRestoreActions(true, false, active_x, Tape::HasPrimalValues || active_A), x_store);
+        Trait_y::restore(&dataStore, allocator, m, LLFH::createRestoreActions(false, true, false, true), y_store);
+
+        allocator.free();
+      }
+
+    private:
+      CODI_INLINE static void iterateIds(Identifier* ids, size_t size, IterCallback func, void* userData) {
+        for (size_t i = 0; i < size; i += 1) {
+          func(&ids[i], userData);
+        }
+      }
+
+    public:
+      /// Function for iteration over inputs.
+      CODI_INLINE static void iterateInputs(Tape* tape, codi::ByteDataView& dataStore, IterCallback func,
+                                            void* userData) {
+        codi::TemporaryMemory& allocator = tape->getTemporaryMemory();
+        codiAssert(allocator.isEmpty());  // No memory should be allocated. We would free it at the end.
+        using LLFH = codi::LowLevelFunctionCreationUtilities<2>;
+
+        // Traits for arguments.
+        using Trait_A = typename LLFH::ActiveStoreTrait<Type*>;
+        using Trait_x = typename LLFH::ActiveStoreTrait<Type*>;
+        using Trait_y = typename LLFH::ActiveStoreTrait<Type*>;
+        using Trait_n = typename LLFH::PassiveStoreTrait<int, int>;
+        using Trait_m = typename LLFH::PassiveStoreTrait<int, int>;
+
+        // Declare variables.
+        typename LLFH::ActivityStoreType activityStore = {};
+        typename Trait_A::ArgumentStore A_store = {};
+        typename Trait_x::ArgumentStore x_store = {};
+        typename Trait_y::ArgumentStore y_store = {};
+        typename Trait_n::Store n = {};
+        typename Trait_m::Store m = {};
+
+        bool active_A = false;
+        bool active_x = false;
+
+        // Restore data.
+        LLFH::restoreActivity(&dataStore, activityStore);
+        active_A = LLFH::getActivity(activityStore, 0);
+        active_x = LLFH::getActivity(activityStore, 1);
+        Trait_n::restore(&dataStore, allocator, 1, true, n);
+        Trait_m::restore(&dataStore, allocator, 1, true, m);
+        Trait_A::restore(&dataStore, allocator, n * m,
+                         LLFH::createRestoreActions(true, false, active_A, Tape::HasPrimalValues || active_x), A_store);
+        Trait_x::restore(&dataStore, allocator, n,
+                         LLFH::createRestoreActions(true, false, active_x, Tape::HasPrimalValues || active_A), x_store);
+        Trait_y::restore(&dataStore, allocator, m, LLFH::createRestoreActions(false, true, false, true), y_store);
+
+        if (active_A) {
+          iterateIds(A_store.identifierIn(), n * m, func, userData);
+        }
+        if (active_x) {
+          iterateIds(x_store.identifierIn(), n, func, userData);
+        }
+
+        allocator.free();
+      }
+
+      /// Function for iteration over inputs.
+      CODI_INLINE static void iterateOutputs(Tape* tape, codi::ByteDataView& dataStore, IterCallback func,
+                                             void* userData) {
+        codi::TemporaryMemory& allocator = tape->getTemporaryMemory();
+        codiAssert(allocator.isEmpty());  // No memory should be allocated. We would free it at the end.
+        using LLFH = codi::LowLevelFunctionCreationUtilities<2>;
+
+        // Traits for arguments.
+        using Trait_A = typename LLFH::ActiveStoreTrait<Type*>;
+        using Trait_x = typename LLFH::ActiveStoreTrait<Type*>;
+        using Trait_y = typename LLFH::ActiveStoreTrait<Type*>;
+        using Trait_n = typename LLFH::PassiveStoreTrait<int, int>;
+        using Trait_m = typename LLFH::PassiveStoreTrait<int, int>;
+
+        // Declare variables.
+        typename LLFH::ActivityStoreType activityStore = {};
+        typename Trait_A::ArgumentStore A_store = {};
+        typename Trait_x::ArgumentStore x_store = {};
+        typename Trait_y::ArgumentStore y_store = {};
+        typename Trait_n::Store n = {};
+        typename Trait_m::Store m = {};
+
+        bool active_A = false;
+        bool active_x = false;
+
+        // Restore data.
+        LLFH::restoreActivity(&dataStore, activityStore);
+        active_A = LLFH::getActivity(activityStore, 0);
+        active_x = LLFH::getActivity(activityStore, 1);
+        Trait_n::restore(&dataStore, allocator, 1, true, n);
+        Trait_m::restore(&dataStore, allocator, 1, true, m);
+        Trait_A::restore(&dataStore, allocator, n * m,
+                         LLFH::createRestoreActions(true, false, active_A, Tape::HasPrimalValues || active_x), A_store);
+        Trait_x::restore(&dataStore, allocator, n,
+                         LLFH::createRestoreActions(true, false, active_x, Tape::HasPrimalValues || active_A), x_store);
+        Trait_y::restore(&dataStore, allocator, m, LLFH::createRestoreActions(false, true, false, true), y_store);
+
+        iterateIds(y_store.identifierOut(), m, func, userData);
+
+        allocator.free();
+      }
+
+      /// Store on tape.
+      CODI_INLINE static void evalAndStore(Type const* A, Type const* x, Type* y, int n, int m) {
+        Tape& tape = Type::getTape();
+        codi::TemporaryMemory& allocator = tape.getTemporaryMemory();
+        using LLFH = codi::LowLevelFunctionCreationUtilities<2>;
+
+        // Traits for arguments.
+        using Trait_A = typename LLFH::ActiveStoreTrait<Type*>;
+        using Trait_x = typename LLFH::ActiveStoreTrait<Type*>;
+        using Trait_y = typename LLFH::ActiveStoreTrait<Type*>;
+        using Trait_n = typename LLFH::PassiveStoreTrait<int, int>;
+        using Trait_m = typename LLFH::PassiveStoreTrait<int, int>;
+
+        // Declare variables.
+        typename LLFH::ActivityStoreType activityStore = {};
+        typename Trait_A::ArgumentStore A_store = {};
+        typename Trait_x::ArgumentStore x_store = {};
+        typename Trait_y::ArgumentStore y_store = {};
+
+        // Detect activity.
+        bool active_A = Trait_A::isActive(A, n * m);
+        bool active_x = Trait_x::isActive(x, n);
+        bool active = active_A | active_x;
+
+        if (active) {
+          // Store function.
+          registerOnTape();
+
+          // Count data size.
+          size_t dataSize = LLFH::countActivitySize();
+          dataSize += Trait_n::countSize(n, 1, true);
+          dataSize += Trait_m::countSize(m, 1, true);
+          dataSize += Trait_A::countSize(
+              A, n * m, LLFH::createStoreActions(active, true, false, active_A, Tape::HasPrimalValues || active_x));
+          dataSize += Trait_x::countSize(
+              x, n, LLFH::createStoreActions(active, true, false, active_x, Tape::HasPrimalValues || active_A));
+          dataSize += Trait_y::countSize(y, m, LLFH::createStoreActions(active, false, true, false, true));
+
+          // Reserve data.
+          codi::ByteDataView dataStore = {};
+          tape.pushLowLevelFunction(ID, dataSize, dataStore);
+
+          // Store data.
+          LLFH::setActivity(activityStore, 0, active_A);
+          LLFH::setActivity(activityStore, 1, active_x);
+          LLFH::storeActivity(&dataStore, activityStore);
+          Trait_n::store(&dataStore, allocator, n, 1, true);
+          Trait_m::store(&dataStore, allocator, m, 1, true);
+          Trait_A::store(&dataStore, allocator, A, n * m,
+                         LLFH::createStoreActions(active, true, false, active_A, Tape::HasPrimalValues || active_x),
+                         A_store);
+          Trait_x::store(&dataStore, allocator, x, n,
+                         LLFH::createStoreActions(active, true, false, active_x, Tape::HasPrimalValues || active_A),
+                         x_store);
+          Trait_y::store(&dataStore, allocator, y, m, LLFH::createStoreActions(active, false, true, false, true),
+                         y_store);
+        } else {
+          // Prepare passive evaluation.
+          Trait_A::store(nullptr, allocator, A, n * m,
+                         LLFH::createStoreActions(active, true, false, active_A, Tape::HasPrimalValues || active_x),
+                         A_store);
+          Trait_x::store(nullptr, allocator, x, n,
+                         LLFH::createStoreActions(active, true, false, active_x, Tape::HasPrimalValues || active_A),
+                         x_store);
+          Trait_y::store(nullptr, allocator, y, m, LLFH::createStoreActions(active, false, true, false, true), y_store);
+        }
+
+        callPrimal(active, A_store.primal(), active_A, A_store.identifierIn(), x_store.primal(), active_x,
+                   x_store.identifierIn(), y_store.primal(), y_store.identifierOut(), n, m);
+
+        Trait_y::setExternalFunctionOutput(active, y, m, y_store.identifierOut(), y_store.primal(),
+                                           y_store.oldPrimal());
+
+        allocator.free();
+      }
+
+      /// Primal computation function.
+      CODI_INLINE static void callPrimal(bool active, typename codi::ActiveArgumentStoreTraits<Type*>::Real const* A,
+                                         bool active_A,
+                                         typename codi::ActiveArgumentStoreTraits<Type*>::Identifier const* A_i_in,
+                                         typename codi::ActiveArgumentStoreTraits<Type*>::Real const* x, bool active_x,
+                                         typename codi::ActiveArgumentStoreTraits<Type*>::Identifier const* x_i_in,
+                                         typename codi::ActiveArgumentStoreTraits<Type*>::Real* y,
+                                         typename codi::ActiveArgumentStoreTraits<Type*>::Identifier* y_i_out, int n,
+                                         int m) {
+        codi::CODI_UNUSED(active, A, active_A, A_i_in, x, active_x, x_i_in, y, y_i_out, n, m);
+        BlasKernels::gemvTransposed(y, A, x, n, m, false);
+
+        // User defined activity update.
+        if (active && !active_x) {
+          // Columns of A without active entries produce passive outputs.
+          for (int j = 0; j < m; j += 1) {
+            bool activeColumn = false;
+            for (int i = 0; i < n && !activeColumn; i += 1) {
+              activeColumn = 0 != A_i_in[i * m + j];
+            }
+            if (!activeColumn) {
+              y_i_out[j] = 0;
+            }
+          }
+        }
+      }
+
+      /// Register function on tape.
+      CODI_INLINE static void registerOnTape() {
+        if (codi::Config::LowLevelFunctionTokenInvalid == ID) {
+          using Entry = codi::LowLevelFunctionEntry<Tape, typename Type::Real, typename Type::Identifier>;
+          ID = Type::getTape().registerLowLevelFunction(
+              Entry(reverse, forward, primal, del, iterateInputs, iterateOutputs));
+        }
+      }
+  };
+
+  template<typename Type>
+  codi::Config::LowLevelFunctionToken ExtFunc_matrixTransposeVectorMultiplication<Type>::ID =
+      codi::Config::LowLevelFunctionTokenInvalid;
+
+  /**
+   *  Low level function for \f$y = A^T * x\f$ with
+   *   - \f$ A \in \R^{n \times m} \f$, row major
+   *   - \f$ x \in \R^{n} \f$
+   *   - \f$ y \in \R^{m} \f$
+   */
+  template<typename Type>
+  void matrixTransposeVectorMultiplication(Type const* A, Type const* x, Type* y, int n, int m) {
+    ExtFunc_matrixTransposeVectorMultiplication<Type>::evalAndStore(A, x, y, n, m);
+  }
+
+  /**
+   *  Low level function for \f$y = A^T * x\f$ with
+   *   - \f$ A \in \R^{n \times m} \f$, row major
+   *   - \f$ x \in \R^{n} \f$
+   *   - \f$ y \in \R^{m} \f$
+   *
+   *  The rows of A are split into blocks such that each block fits into one low level function entry. The results of
+   *  the blocks are summed up.
+   */
+  template<typename Type>
+  void matrixTransposeVectorMultiplicationRowMajor(Type const* A, Type const* x, Type* y, int n, int m) {
+    int rows = (BlasKernels::maxValuesPerCall<Type>() - m) / (m + 1);
+
+    if (rows < 1) {
+      // A single row does not fit into a low level function.
+      for (int j = 0; j < m; j += 1) {
+        Type value = 0.0;
+        for (int i = 0; i < n; i += 1) {
+          value += A[i * m + j] * x[i];
+        }
+        y[j] = value;
+      }
+    } else {
+      matrixTransposeVectorMultiplication(A, x, y, std::min(rows, n), m);
+
+      if (rows < n) {
+        std::vector<Type> partial(m);
+        for (int start = rows; start < n; start += rows) {
+          matrixTransposeVectorMultiplication(&A[start * m], &x[start], partial.data(), std::min(rows, n - start), m);
+          for (int j = 0; j < m; j += 1) {
+            y[j] += partial[j];
+          }
+        }
+      }
+    }
+  }
+
+  /**
+   *  Low level function for \f$y = A * x\f$ with
+   *   - \f$ A \in \R^{n \times m} \f$, column major
+   *   - \f$ x \in \R^{m} \f$
+   *   - \f$ y \in \R^{n} \f$
+   */
+  template<typename Type>
+  void matrixVectorMultiplicationColMajor(Type const* A, Type const* x, Type* y, int n, int m) {
+    matrixTransposeVectorMultiplicationRowMajor(A, x, y, m, n);
+  }
+}
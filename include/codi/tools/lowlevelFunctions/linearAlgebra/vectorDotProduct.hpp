@@ -0,0 +1,558 @@
+/*
+ * CoDiPack, a Code Differentiation Package
+ *
+ * Copyright (C) 2015-2026 Chair for Scientific Computing (SciComp), RPTU University Kaiserslautern-Landau
+ * Homepage: http://scicomp.rptu.de
+ * Contact:  Prof. Nicolas R. Gauger (codi@scicomp.uni-kl.de)
+ *
+ * Lead developers: Max Sagebaum, Johannes Blühdorn (SciComp, RPTU University Kaiserslautern-Landau)
+ *
+ * This file is part of CoDiPack (http://scicomp.rptu.de/software/codi).
+ *
+ * CoDiPack is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * CoDiPack is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * See the GNU General Public License for more details.
+ * You should have received a copy of the GNU
+ * General Public License along with CoDiPack.
+ * If not, see <http://www.gnu.org/licenses/>.
+ *
+ * For other licensing options please contact us.
+ *
+ * Authors:
+ *  - SciComp, RPTU University Kaiserslautern-Landau:
+ *    - Max Sagebaum
+ *    - Johannes Blühdorn
+ *    - Former members:
+ *      - Tim Albring
+ */
+#pragma once
+
+#include <algorithm>
+
+#include <codi/config.h>
+
+#include <codi/misc/macros.hpp>
+#include <codi/tools/lowlevelFunctions/blasKernels.hpp>
+#include <codi/tools/lowlevelFunctions/generationHelperCoDiPack.hpp>
+#include <codi/tools/lowlevelFunctions/lowLevelFunctionCreationUtilities.hpp>
+
+/** \copydoc codi::Namespace */
+namespace codi {
+  /// Low level function generation for vectorDotProduct.
+  template<typename Type>
+  struct ExtFunc_vectorDotProduct {
+      using Real = typename Type::Real;              ///< Real of the type.
+      using Identifier = typename Type::Identifier;  ///< Identifier of the type.
+      /// Abbreviation for vector access interface.
+      using AdjointVectorAccess = codi::VectorAccessInterface<Real, Identifier>*;
+      /// Abbreviation for tape.
+      using Tape = typename Type::Tape;
+
+      /// See LowLevelFunctionEntry.
+      using IterCallback = typename LowLevelFunctionEntry<Tape, Real, Identifier>::IterCallback;
+
+      /// Id for this function.
+      static codi::Config::LowLevelFunctionToken ID;
+
+      /// Function for forward interpretation.
+      CODI_INLINE static void forward(Tape* tape, codi::ByteDataView& dataStore, AdjointVectorAccess adjoints) {
+        codi::TemporaryMemory& allocator = tape->getTemporaryMemory();
+        codiAssert(allocator.isEmpty());  // No memory should be allocated. We would free it at the end.
+        using LLFH = codi::LowLevelFunctionCreationUtilities<2>;
+
+        // Traits for arguments.
+        using Trait_x = typename LLFH::ActiveStoreTrait<Type*>;
+        using Trait_y = typename LLFH::ActiveStoreTrait<Type*>;
+        using Trait_r = typename LLFH::ActiveStoreTrait<Type*>;
+        using Trait_n = typename LLFH::PassiveStoreTrait<int, int>;
+
+        // Declare variables.
+        typename LLFH::ActivityStoreType activityStore = {};
+        typename Trait_x::ArgumentStore x_store = {};
+        typename Trait_y::ArgumentStore y_store = {};
+        typename Trait_r::ArgumentStore r_store = {};
+        typename Trait_n::Store n = {};
+
+        bool active_x = false;
+        bool active_y = false;
+
+        // Restore data.
+        LLFH::restoreActivity(&dataStore, activityStore);
+        active_x = LLFH::getActivity(activityStore, 0);
+        active_y = LLFH::getActivity(activityStore, 1);
+        Trait_n::restore(&dataStore, allocator, 1, true, n);
+        Trait_x::restore(&dataStore, allocator, n,
+                         LLFH::createRestoreActions(true, false, active_x, Tape::HasPrimalValues || active_y), x_store);
+        Trait_y::restore(&dataStore, allocator, n,
+                         LLFH::createRestoreActions(true, false, active_y, Tape::HasPrimalValues || active_x), y_store);
+        Trait_r::restore(&dataStore, allocator, 1, LLFH::createRestoreActions(false, true, false, true), r_store);
+
+        if (Tape::HasPrimalValues) {
+          // Get primal values for inputs.
+          if (active_x) {
+            Trait_x::getPrimalsFromVector(adjoints, n, x_store.identifierIn(), x_store.primal());
+          }
+          if (active_y) {
+            Trait_y::getPrimalsFromVector(adjoints, n, y_store.identifierIn(), y_store.primal());
+          }
+        }
+
+        for (size_t curDim = 0; curDim < adjoints->getVectorSize(); curDim += 1) {
+          // Get input gradients.
+          if (active_x) {
+            Trait_x::getGradients(adjoints, n, false, x_store.identifierIn(), x_store.gradientIn(), curDim);
+          }
+          if (active_y) {
+            Trait_y::getGradients(adjoints, n, false, y_store.identifierIn(), y_store.gradientIn(), curDim);
+          }
+
+          // Evaluate forward mode.
+          callForward(x_store.primal(), active_x, x_store.gradientIn(), y_store.primal(), active_y,
+                      y_store.gradientIn(), r_store.primal(), r_store.gradientOut(), n);
+
+          if (Tape::HasPrimalValues && 0 == curDim) {
+            if (!Tape::LinearIndexHandling) {
+              // Update old primal values.
+              Trait_r::getPrimalsFromVector(adjoints, 1, r_store.identifierOut(), r_store.oldPrimal());
+            }
+
+            // Set new primal values.
+            Trait_r::setPrimalsIntoVector(adjoints, 1, r_store.identifierOut(), r_store.primal());
+          }
+
+          Trait_r::setGradients(adjoints, 1, false, r_store.identifierOut(), r_store.gradientOut(), curDim);
+        }
+
+        allocator.free();
+      }
+
+      /// Forward function for derivative evaluation.
+      CODI_INLINE static void callForward(typename codi::ActiveArgumentStoreTraits<Type*>::Real const* x, bool active_x,
+                                          typename codi::ActiveArgumentStoreTraits<Type*>::Gradient* x_d_in,
+                                          typename codi::ActiveArgumentStoreTraits<Type*>::Real const* y, bool active_y,
+                                          typename codi::ActiveArgumentStoreTraits<Type*>::Gradient* y_d_in,
+                                          typename codi::ActiveArgumentStoreTraits<Type*>::Real* r,
+                                          typename codi::ActiveArgumentStoreTraits<Type*>::Gradient* r_d_out,
+                                          typename codi::PassiveArgumentStoreTraits<int, int>::Store n) {
+        codi::CODI_UNUSED(x, active_x, x_d_in, y, active_y, y_d_in, r, r_d_out, n);
+        if (active_x) {
+          r_d_out[0] = BlasKernels::dot(x_d_in, y, n);
+        }
+        if (active_y) {
+          if (active_x) {
+            r_d_out[0] += BlasKernels::dot(x, y_d_in, n);
+          } else {
+            r_d_out[0] = BlasKernels::dot(x, y_d_in, n);
+          }
+        }
+        if (Tape::HasPrimalValues) {
+          // Jacobian tapes do not require the primal results.
+          r[0] = BlasKernels::dot(x, y, n);
+        }
+      }
+
+      /// Function for reverse interpretation.
+      CODI_INLINE static void reverse(Tape* tape, codi::ByteDataView& dataStore, AdjointVectorAccess adjoints) {
+        codi::TemporaryMemory& allocator = tape->getTemporaryMemory();
+        codiAssert(allocator.isEmpty());  // No memory should be allocated. We would free it at the end.
+        using LLFH = codi::LowLevelFunctionCreationUtilities<2>;
+
+        // Traits for arguments.
+        using Trait_x = typename LLFH::ActiveStoreTrait<Type*>;
+        using Trait_y = typename LLFH::ActiveStoreTrait<Type*>;
+        using Trait_r = typename LLFH::ActiveStoreTrait<Type*>;
+        using Trait_n = typename LLFH::PassiveStoreTrait<int, int>;
+
+        // Declare variables.
+        typename LLFH::ActivityStoreType activityStore = {};
+        typename Trait_x::ArgumentStore x_store = {};
+        typename Trait_y::ArgumentStore y_store = {};
+        typename Trait_r::ArgumentStore r_store = {};
+        typename Trait_n::Store n = {};
+
+        bool active_x = false;
+        bool active_y = false;
+
+        // Restore data.
+        LLFH::restoreActivity(&dataStore, activityStore);
+        active_x = LLFH::getActivity(activityStore, 0);
+        active_y = LLFH::getActivity(activityStore, 1);
+        Trait_n::restore(&dataStore, allocator, 1, true, n);
+        Trait_x::restore(&dataStore, allocator, n,
+                         LLFH::createRestoreActions(true, false, active_x, Tape::HasPrimalValues || active_y), x_store);
+        Trait_y::restore(&dataStore, allocator, n,
+                         LLFH::createRestoreActions(true, false, active_y, Tape::HasPrimalValues || active_x), y_store);
+        Trait_r::restore(&dataStore, allocator, 1, LLFH::createRestoreActions(false, true, false, true), r_store);
+
+        if (Tape::HasPrimalValues) {
+          if (!Tape::LinearIndexHandling) {
+            // Restore old primal values from outputs.
+            Trait_r::setPrimalsIntoVector(adjoints, 1, r_store.identifierOut(), r_store.oldPrimal());
+          }
+
+          // Get primal values for inputs.
+          if (active_x && active_y) {
+            Trait_x::getPrimalsFromVector(adjoints, n, x_store.identifierIn(), x_store.primal());
+          }
+          if (active_y && active_x) {
+            Trait_y::getPrimalsFromVector(adjoints, n, y_store.identifierIn(), y_store.primal());
+          }
+        }
+
+        for (size_t curDim = 0; curDim < adjoints->getVectorSize(); curDim += 1) {
+          // Get output gradients.
+          Trait_r::getGradients(adjoints, 1, true, r_store.identifierOut(), r_store.gradientOut(), curDim);
+
+          // Evaluate reverse mode.
+          callReverse(x_store.primal(), active_x, x_store.gradientIn(), y_store.primal(), active_y,
+                      y_store.gradientIn(), r_store.primal(), r_store.gradientOut(), n);
+
+          if (active_x) {
+            Trait_x::setGradients(adjoints, n, true, x_store.identifierIn(), x_store.gradientIn(), curDim);
+          }
+          if (active_y) {
+            Trait_y::setGradients(adjoints, n, true, y_store.identifierIn(), y_store.gradientIn(), curDim);
+          }
+        }
+
+        allocator.free();
+      }
+
+      /// Reverse function for derivative evaluation.
+      CODI_INLINE static void callReverse(typename codi::ActiveArgumentStoreTraits<Type*>::Real const* x, bool active_x,
+                                          typename codi::ActiveArgumentStoreTraits<Type*>::Gradient* x_b_in,
+                                          typename codi::ActiveArgumentStoreTraits<Type*>::Real const* y, bool active_y,
+                                          typename codi::ActiveArgumentStoreTraits<Type*>::Gradient* y_b_in,
+                                          typename codi::ActiveArgumentStoreTraits<Type*>::Real* r,
+                                          typename codi::ActiveArgumentStoreTraits<Type*>::Gradient* r_b_out,
+                                          typename codi::PassiveArgumentStoreTraits<int, int>::Store n) {
+        codi::CODI_UNUSED(x, active_x, x_b_in, y, active_y, y_b_in, r, r_b_out, n);
+        if (active_x) {
+          BlasKernels::axpy(x_b_in, r_b_out[0], y, n, false);
+        }
+        if (active_y) {
+          BlasKernels::axpy(y_b_in, r_b_out[0], x, n, false);
+        }
+      }
+
+      /// Function for primal interpretation.
+      CODI_INLINE static void primal(Tape* tape, codi::ByteDataView& dataStore, AdjointVectorAccess adjoints) {
+        codi::TemporaryMemory& allocator = tape->getTemporaryMemory();
+        codiAssert(allocator.isEmpty());  // No memory should be allocated. We would free it at the end.
+        using LLFH = codi::LowLevelFunctionCreationUtilities<2>;
+
+        // Traits for arguments.
+        using Trait_x = typename LLFH::ActiveStoreTrait<Type*>;
+        using Trait_y = typename LLFH::ActiveStoreTrait<Type*>;
+        using Trait_r = typename LLFH::ActiveStoreTrait<Type*>;
+        using Trait_n = typename LLFH::PassiveStoreTrait<int, int>;
+
+        // Declare variables.
+        typename LLFH::ActivityStoreType activityStore = {};
+        typename Trait_x::ArgumentStore x_store = {};
+        typename Trait_y::ArgumentStore y_store = {};
+        typename Trait_r::ArgumentStore r_store = {};
+        typename Trait_n::Store n = {};
+
+        bool active_x = false;
+        bool active_y = false;
+
+        // Restore data.
+        LLFH::restoreActivity(&dataStore, activityStore);
+        active_x = LLFH::getActivity(activityStore, 0);
+        active_y = LLFH::getActivity(activityStore, 1);
+        Trait_n::restore(&dataStore, allocator, 1, true, n);
+        Trait_x::restore(&dataStore, allocator, n,
+                         LLFH::createRestoreActions(true, false, active_x, Tape::HasPrimalValues || active_y), x_store);
+        Trait_y::restore(&dataStore, allocator, n,
+                         LLFH::createRestoreActions(true, false, active_y, Tape::HasPrimalValues || active_x), y_store);
+        Trait_r::restore(&dataStore, allocator, 1, LLFH::createRestoreActions(false, true, false, true), r_store);
+
+        // Get primal values for inputs.
+        if (active_x) {
+          Trait_x::getPrimalsFromVector(adjoints, n, x_store.identifierIn(), x_store.primal());
+        }
+        if (active_y) {
+          Trait_y::getPrimalsFromVector(adjoints, n, y_store.identifierIn(), y_store.primal());
+        }
+
+        // Evaluate primal function.
+        callPrimal(false, x_store.primal(), active_x, x_store.identifierIn(), y_store.primal(), active_y,
+                   y_store.identifierIn(), r_store.primal(), r_store.identifierOut(), n);
+
+        if (!Tape::LinearIndexHandling) {
+          // Update old primal values.
+          Trait_r::getPrimalsFromVector(adjoints, 1, r_store.identifierOut(), r_store.oldPrimal());
+        }
+
+        // Set new primal values.
+        Trait_r::setPrimalsIntoVector(adjoints, 1, r_store.identifierOut(), r_store.primal());
+
+        allocator.free();
+      }
+
+      /// Function for deletion of contents.
+      CODI_INLINE static void del(Tape* tape, codi::ByteDataView& dataStore) {
+        codi::TemporaryMemory& allocator = tape->getTemporaryMemory();
+        codiAssert(allocator.isEmpty());  // No memory should be allocated. We would free it at the end.
+        using LLFH = codi::LowLevelFunctionCreationUtilities<2>;
+
+        // Traits for arguments.
+        using Trait_x = typename LLFH::ActiveStoreTrait<Type*>;
+        using Trait_y = typename LLFH::ActiveStoreTrait<Type*>;
+        using Trait_r = typename LLFH::ActiveStoreTrait<Type*>;
+        using Trait_n = typename LLFH::PassiveStoreTrait<int, int>;
+
+        // Declare variables.
+        typename LLFH::ActivityStoreType activityStore = {};
+        typename Trait_x::ArgumentStore x_store = {};
+        typename Trait_y::ArgumentStore y_store = {};
+        typename Trait_r::ArgumentStore r_store = {};
+        typename Trait_n::Store n = {};
+
+        bool active_x = false;
+        bool active_y = false;
+
+        // Restore data.
+        LLFH::restoreActivity(&dataStore, activityStore);
+        active_x = LLFH::getActivity(activityStore, 0);
+        active_y = LLFH::getActivity(activityStore, 1);
+        Trait_n::restore(&dataStore, allocator, 1, true, n);
+        Trait_x::restore(&dataStore, allocator, n,
+                         LLFH::createRestoreActions(true, false, active_x, Tape::HasPrimalValues || active_y), x_store);
+        Trait_y::restore(&dataStore, allocator, n,
+                         LLFH::createRestoreActions(true, false, active_y, Tape::HasPrimalValues || active_x), y_store);
+        Trait_r::restore(&dataStore, allocator, 1, LLFH::createRestoreActions(false, true, false, true), r_store);
+
+        allocator.free();
+      }
+
+    private:
+      CODI_INLINE static void iterateIds(Identifier* ids, size_t size, IterCallback func, void* userData) {
+        for (size_t i = 0; i < size; i += 1) {
+          func(&ids[i], userData);
+        }
+      }
+
+    public:
+      /// Function for iteration over inputs.
+      CODI_INLINE static void iterateInputs(Tape* tape, codi::ByteDataView& dataStore, IterCallback func,
+                                            void* userData) {
+        codi::TemporaryMemory& allocator = tape->getTemporaryMemory();
+        codiAssert(allocator.isEmpty());  // No memory should be allocated. We would free it at the end.
+        using LLFH = codi::LowLevelFunctionCreationUtilities<2>;
+
+        // Traits for arguments.
+        using Trait_x = typename LLFH::ActiveStoreTrait<Type*>;
+        using Trait_y = typename LLFH::ActiveStoreTrait<Type*>;
+        using Trait_r = typename LLFH::ActiveStoreTrait<Type*>;
+        using Trait_n = typename LLFH::PassiveStoreTrait<int, int>;
+
+        // Declare variables.
+        typename LLFH::ActivityStoreType activityStore = {};
+        typename Trait_x::ArgumentStore x_store = {};
+        typename Trait_y::ArgumentStore y_store = {};
+        typename Trait_r::ArgumentStore r_store = {};
+        typename Trait_n::Store n = {};
+
+        bool active_x = false;
+        bool active_y = false;
+
+        // Restore data.
+        LLFH::restoreActivity(&dataStore, activityStore);
+        active_x = LLFH::getActivity(activityStore, 0);
+        active_y = LLFH::getActivity(activityStore, 1);
+        Trait_n::restore(&dataStore, allocator, 1, true, n);
+        Trait_x::restore(&dataStore, allocator, n,
+                         LLFH::createRestoreActions(true, false, active_x, Tape::HasPrimalValues || active_y), x_store);
+        Trait_y::restore(&dataStore, allocator, n,
+                         LLFH::createRestoreActions(true, false, active_y, Tape::HasPrimalValues || active_x), y_store);
+        Trait_r::restore(&dataStore, allocator, 1, LLFH::createRestoreActions(false, true, false, true), r_store);
+
+        if (active_x) {
+          iterateIds(x_store.identifierIn(), n, func, userData);
+        }
+        if (active_y) {
+          iterateIds(y_store.identifierIn(), n, func, userData);
+        }
+
+        allocator.free();
+      }
+
+      /// Function for iteration over inputs.
+      CODI_INLINE static void iterateOutputs(Tape* tape, codi::ByteDataView& dataStore, IterCallback func,
+                                             void* userData) {
+        codi::TemporaryMemory& allocator = tape->getTemporaryMemory();
+        codiAssert(allocator.isEmpty());  // No memory should be allocated. We would free it at the end.
+        using LLFH = codi::LowLevelFunctionCreationUtilities<2>;
+
+        // Traits for arguments.
+        using Trait_x = typename LLFH::ActiveStoreTrait<Type*>;
+        using Trait_y = typename LLFH::ActiveStoreTrait<Type*>;
+        using Trait_r = typename LLFH::ActiveStoreTrait<Type*>;
+        using Trait_n = typename LLFH::PassiveStoreTrait<int, int>;
+
+        // Declare variables.
+        typename LLFH::ActivityStoreType activityStore = {};
+        typename Trait_x::ArgumentStore x_store = {};
+        typename Trait_y::ArgumentStore y_store = {};
+        typename Trait_r::ArgumentStore r_store = {};
+        typename Trait_n::Store n = {};
+
+        bool active_x = false;
+        bool active_y = false;
+
+        // Restore data.
+        LLFH::restoreActivity(&dataStore, activityStore);
+        active_x = LLFH::getActivity(activityStore, 0);
+        active_y = LLFH::getActivity(activityStore, 1);
+        Trait_n::restore(&dataStore, allocator, 1, true, n);
+        Trait_x::restore(&dataStore, allocator, n,
+                         LLFH::createRestoreActions(true, false, active_x, Tape::HasPrimalValues || active_y), x_store);
+        Trait_y::restore(&dataStore, allocator, n,
+                         LLFH::createRestoreActions(true, false, active_y, Tape::HasPrimalValues || active_x), y_store);
+        Trait_r::restore(&dataStore, allocator, 1, LLFH::createRestoreActions(false, true, false, true), r_store);
+
+        iterateIds(r_store.identifierOut(), 1, func, userData);
+
+        allocator.free();
+      }
+
+      /// Store on tape.
+      CODI_INLINE static void evalAndStore(Type const* x, Type const* y, Type* r, int n) {
+        Tape& tape = Type::getTape();
+        codi::TemporaryMemory& allocator = tape.getTemporaryMemory();
+        using LLFH = codi::LowLevelFunctionCreationUtilities<2>;
+
+        // Traits for arguments.
+        using Trait_x = typename LLFH::ActiveStoreTrait<Type*>;
+        using Trait_y = typename LLFH::ActiveStoreTrait<Type*>;
+        using Trait_r = typename LLFH::ActiveStoreTrait<Type*>;
+        using Trait_n = typename LLFH::PassiveStoreTrait<int, int>;
+
+        // Declare variables.
+        typename LLFH::ActivityStoreType activityStore = {};
+        typename Trait_x::ArgumentStore x_store = {};
+        typename Trait_y::ArgumentStore y_store = {};
+        typename Trait_r::ArgumentStore r_store = {};
+
+        // Detect activity.
+        bool active_x = Trait_x::isActive(x, n);
+        bool active_y = Trait_y::isActive(y, n);
+        bool active = active_x | active_y;
+
+        if (active) {
+          // Store function.
+          registerOnTape();
+
+          // Count data size.
+          size_t dataSize = LLFH::countActivitySize();
+          dataSize += Trait_n::countSize(n, 1, true);
+          dataSize += Trait_x::countSize(
+              x, n, LLFH::createStoreActions(active, true, false, active_x, Tape::HasPrimalValues || active_y));
+          dataSize += Trait_y::countSize(
+              y, n, LLFH::createStoreActions(active, true, false, active_y, Tape::HasPrimalValues || active_x));
+          dataSize += Trait_r::countSize(r, 1, LLFH::createStoreActions(active, false, true, false, true));
+
+          // Reserve data.
+          codi::ByteDataView dataStore = {};
+          tape.pushLowLevelFunction(ID, dataSize, dataStore);
+
+          // Store data.
+          LLFH::setActivity(activityStore, 0, active_x);
+          LLFH::setActivity(activityStore, 1, active_y);
+          LLFH::storeActivity(&dataStore, activityStore);
+          Trait_n::store(&dataStore, allocator, n, 1, true);
+          Trait_x::store(&dataStore, allocator, x, n,
+                         LLFH::createStoreActions(active, true, false, active_x, Tape::HasPrimalValues || active_y),
+                         x_store);
+          Trait_y::store(&dataStore, allocator, y, n,
+                         LLFH::createStoreActions(active, true, false, active_y, Tape::HasPrimalValues || active_x),
+                         y_store);
+          Trait_r::store(&dataStore, allocator, r, 1, LLFH::createStoreActions(active, false, true, false, true),
+                         r_store);
+        } else {
+          // Prepare passive evaluation.
+          Trait_x::store(nullptr, allocator, x, n,
+                         LLFH::createStoreActions(active, true, false, active_x, Tape::HasPrimalValues || active_y),
+                         x_store);
+          Trait_y::store(nullptr, allocator, y, n,
+                         LLFH::createStoreActions(active, true, false, active_y, Tape::HasPrimalValues || active_x),
+                         y_store);
+          Trait_r::store(nullptr, allocator, r, 1, LLFH::createStoreActions(active, false, true, false, true), r_store);
+        }
+
+        callPrimal(active, x_store.primal(), active_x, x_store.identifierIn(), y_store.primal(), active_y,
+                   y_store.identifierIn(), r_store.primal(), r_store.identifierOut(), n);
+
+        Trait_r::setExternalFunctionOutput(active, r, 1, r_store.identifierOut(), r_store.primal(),
+                                           r_store.oldPrimal());
+
+        allocator.free();
+      }
+
+      /// Primal computation function.
+      CODI_INLINE static void callPrimal(bool active, typename codi::ActiveArgumentStoreTraits<Type*>::Real const* x,
+                                         bool active_x,
+                                         typename codi::ActiveArgumentStoreTraits<Type*>::Identifier const* x_i_in,
+                                         typename codi::ActiveArgumentStoreTraits<Type*>::Real const* y, bool active_y,
+                                         typename codi::ActiveArgumentStoreTraits<Type*>::Identifier const* y_i_in,
+                                         typename codi::ActiveArgumentStoreTraits<Type*>::Real* r,
+                                         typename codi::ActiveArgumentStoreTraits<Type*>::Identifier* r_i_out, int n) {
+        codi::CODI_UNUSED(active, x, active_x, x_i_in, y, active_y, y_i_in, r, r_i_out, n);
+        r[0] = BlasKernels::dot(x, y, n);
+      }
+
+      /// Register function on tape.
+      CODI_INLINE static void registerOnTape() {
+        if (codi::Config::LowLevelFunctionTokenInvalid == ID) {
+          using Entry = codi::LowLevelFunctionEntry<Tape, typename Type::Real, typename Type::Identifier>;
+          ID = Type::getTape().registerLowLevelFunction(
+              Entry(reverse, forward, primal, del, iterateInputs, iterateOutputs));
+        }
+      }
+  };
+
+  template<typename Type>
+  codi::Config::LowLevelFunctionToken ExtFunc_vectorDotProduct<Type>::ID = codi::Config::LowLevelFunctionTokenInvalid;
+
+  /**
+   *  Low level function for \f$r = x^T * y\f$ with
+   *   - \f$ x, y \in \R^{n} \f$
+   *   - \f$ r \in \R \f$
+   */
+  template<typename Type>
+  void vectorDotProduct(Type const* x, Type const* y, Type* r, int n) {
+    ExtFunc_vectorDotProduct<Type>::evalAndStore(x, y, r, n);
+  }
+
+  /**
+   *  Low level function for \f$x^T * y\f$ with \f$ x, y \in \R^{n} \f$.
+   *
+   *  Large vectors are split into blocks such that each block fits into one low level function entry.
+   */
+  template<typename Type>
+  Type dotProduct(Type const* x, Type const* y, int n) {
+    int blockSize = (BlasKernels::maxValuesPerCall<Type>() - 1) / 2;
+
+    Type r = 0.0;
+    Type partial;
+    for (int start = 0; start < n; start += blockSize) {
+      if (0 == start) {
+        vectorDotProduct(x, y, &r, std::min(blockSize, n));
+      } else {
+        vectorDotProduct(&x[start], &y[start], &partial, std::min(blockSize, n - start));
+        r += partial;
+      }
+    }
+
+    return r;
+  }
+}
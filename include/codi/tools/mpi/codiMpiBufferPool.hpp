@@ -0,0 +1,208 @@
+/*
+ * CoDiPack, a Code Differentiation Package
+ *
+ * Copyright (C) 2015-2026 Chair for Scientific Computing (SciComp), RPTU University Kaiserslautern-Landau
+ * Homepage: http://scicomp.rptu.de
+ * Contact:  Prof. Nicolas R. Gauger (codi@scicomp.uni-kl.de)
+ *
+ * Lead developers: Max Sagebaum, Johannes Blühdorn (SciComp, RPTU University Kaiserslautern-Landau)
+ *
+ * This file is part of CoDiPack (http://scicomp.rptu.de/software/codi).
+ *
+ * CoDiPack is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * CoDiPack is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * See the GNU General Public License for more details.
+ * You should have received a copy of the GNU
+ * General Public License along with CoDiPack.
+ * If not, see <http://www.gnu.org/licenses/>.
+ *
+ * For other licensing options please contact us.
+ *
+ * Authors:
+ *  - SciComp, RPTU University Kaiserslautern-Landau:
+ *    - Max Sagebaum
+ *    - Johannes Blühdorn
+ *    - Former members:
+ *      - Tim Albring
+ */
+#pragma once
+
+#include <algorithm>
+#include <new>
+#include <vector>
+
+#include "../../config.h"
+#include "../../misc/macros.hpp"
+
+/** \copydoc codi::Namespace */
+namespace codi {
+
+  /**
+   * @brief Reuses the primal and adjoint buffers of the MPI communication.
+   *
+   * MeDiPack requests a new buffer for every message that is sent or received during the evaluation of the MPI
+   * handles. With halo exchanges in every iteration this results in thousands of allocations per tape evaluation. The
+   * pool rounds each request up to a power of two and keeps released buffers in one free list per size class, so
+   * that all further requests of the same size class are served without a system allocation.
+   *
+   * The values in the buffers are constructed once when the buffer is created and are not reset on reuse. All memory
+   * is released when the pool is destroyed or clear() is called.
+   *
+   * The pool is not thread-safe. Each thread that evaluates MPI handles requires its own pool.
+   *
+   * @tparam T_Real  The value type of the buffers.
+   */
+  template<typename T_Real>
+  struct MpiBufferPool {
+    public:
+
+      using Real = CODI_DD(T_Real, double);  ///< See MpiBufferPool.
+
+      static size_t constexpr MinSizeClassBits = 4;  ///< The smallest size class has 2^4 entries.
+
+    private:
+
+      struct BlockHeader {
+          size_t sizeClass;
+      };
+
+      /// Header size rounded up so that the data after the header is aligned for Real.
+      static size_t constexpr HeaderSize =
+          (sizeof(BlockHeader) + alignof(Real) - 1) / alignof(Real) * alignof(Real);
+
+      std::vector<std::vector<char*>> freeBlocks;  ///< Released blocks per size class.
+
+      size_t allocations;  ///< Number of system allocations.
+      size_t requests;     ///< Number of buffer requests.
+
+    public:
+
+      /// Constructor
+      MpiBufferPool() : freeBlocks(), allocations(0), requests(0) {}
+
+      /// Destructor
+      ~MpiBufferPool() {
+        clear();
+      }
+
+      MpiBufferPool(MpiBufferPool const&) = delete;             ///< Not copyable.
+      MpiBufferPool& operator=(MpiBufferPool const&) = delete;  ///< Not copyable.
+
+      /// Buffer with at least \c size entries. Has to be released with free().
+      CODI_INLINE Real* alloc(size_t size) {
+        requests += 1;
+
+        size_t sizeClass = getSizeClass(size);
+        if (sizeClass < freeBlocks.size() && !freeBlocks[sizeClass].empty()) {
+          char* block = freeBlocks[sizeClass].back();
+          freeBlocks[sizeClass].pop_back();
+
+          return getData(block);
+        }
+
+        return createBlock(sizeClass);
+      }
+
+      /// Returns the buffer to the pool. \c buffer has to be created by alloc() of this pool or be a null pointer.
+      CODI_INLINE void free(Real* buffer) {
+        if (nullptr != buffer) {
+          char* block = reinterpret_cast<char*>(buffer) - HeaderSize;
+          size_t sizeClass = reinterpret_cast<BlockHeader*>(block)->sizeClass;
+
+          if (freeBlocks.size() <= sizeClass) {
+            freeBlocks.resize(sizeClass + 1);
+          }
+          freeBlocks[sizeClass].push_back(block);
+        }
+      }
+
+      /// Releases the memory of all buffers that have been returned to the pool.
+      void clear() {
+        for (size_t sizeClass = 0; sizeClass < freeBlocks.size(); sizeClass += 1) {
+          for (char* block : freeBlocks[sizeClass]) {
+            deleteBlock(block, sizeClass);
+          }
+          freeBlocks[sizeClass].clear();
+        }
+      }
+
+      /// Number of system allocations since the construction of the pool.
+      size_t getAllocationCount() const {
+        return allocations;
+      }
+
+      /// Number of buffer requests since the construction of the pool.
+      size_t getRequestCount() const {
+        return requests;
+      }
+
+      /**
+       * @brief Adds the blocks 1 to blocks - 1 of \c buffer to block 0.
+       *
+       * Each block has \c blockSize entries. The blocks are added one after another with a contiguous loop that the
+       * compiler can vectorize.
+       */
+      static CODI_INLINE void combine(Real* buffer, size_t blockSize, int blocks) {
+        Real* CODI_RESTRICT target = buffer;
+
+        for (int curBlock = 1; curBlock < blocks; curBlock += 1) {
+          Real const* CODI_RESTRICT source = &buffer[curBlock * blockSize];
+          for (size_t pos = 0; pos < blockSize; pos += 1) {
+            target[pos] += source[pos];
+          }
+        }
+      }
+
+    private:
+
+      static CODI_INLINE size_t getCapacity(size_t sizeClass) {
+        return (size_t)1 << (sizeClass + MinSizeClassBits);
+      }
+
+      static CODI_INLINE size_t getSizeClass(size_t size) {
+        size_t sizeClass = 0;
+        while (getCapacity(sizeClass) < size) {
+          sizeClass += 1;
+        }
+
+        return sizeClass;
+      }
+
+      static CODI_INLINE Real* getData(char* block) {
+        return reinterpret_cast<Real*>(block + HeaderSize);
+      }
+
+      Real* createBlock(size_t sizeClass) {
+        allocations += 1;
+
+        size_t capacity = getCapacity(sizeClass);
+        char* block = static_cast<char*>(::operator new(HeaderSize + capacity * sizeof(Real)));
+        new (block) BlockHeader{sizeClass};
+
+        Real* data = getData(block);
+        for (size_t pos = 0; pos < capacity; pos += 1) {
+          new (&data[pos]) Real();
+        }
+
+        return data;
+      }
+
+      static void deleteBlock(char* block, size_t sizeClass) {
+        size_t capacity = getCapacity(sizeClass);
+
+        Real* data = getData(block);
+        for (size_t pos = 0; pos < capacity; pos += 1) {
+          data[pos].~Real();
+        }
+
+        ::operator delete(block);
+      }
+  };
+}
@@ -48,6 +48,7 @@
 #include "../../misc/macros.hpp"
 #include "../../tapes/interfaces/fullTapeInterface.hpp"
 #include "../../tapes/misc/adjointVectorAccess.hpp"
+#include "codiMpiBufferPool.hpp"
 
 /** \copydoc codi::Namespace */
 namespace codi {
@@ -66,11 +67,12 @@ namespace codi {
       using Identifier = typename Type::Identifier;
 
       VectorAccessInterface<Real, Identifier>* codiInterface;
+      MpiBufferPool<Real>* bufferPool;
 
       int vecSize;
 
-      CoDiMeDiAdjointInterfaceWrapper(VectorAccessInterface<Real, Identifier>* interface)
-          : codiInterface(interface), vecSize((int)interface->getVectorSize()) {}
+      CoDiMeDiAdjointInterfaceWrapper(VectorAccessInterface<Real, Identifier>* interface, MpiBufferPool<Real>* pool)
+          : codiInterface(interface), bufferPool(pool), vecSize((int)interface->getVectorSize()) {}
 
       CODI_INLINE_NO_FA int computeElements(int elements) const {
         return elements * vecSize;
@@ -118,37 +120,28 @@ namespace codi {
       }
 
       CODI_INLINE_NO_FA void combineAdjoints(void* b, int const elements, int const ranks) const {
-        Real* buf = (Real*)b;
-
-        for (int curRank = 1; curRank < ranks; ++curRank) {
-          for (int curPos = 0; curPos < elements; ++curPos) {
-            for (int dim = 0; dim < vecSize; ++dim) {
-              buf[curPos * vecSize + dim] += buf[(elements * curRank + curPos) * vecSize + dim];
-            }
-          }
-        }
+        // The data of one rank is contiguous, so the vector dimensions do not need to be handled separately.
+        MpiBufferPool<Real>::combine((Real*)b, (size_t)elements * vecSize, ranks);
       }
 
       CODI_INLINE_NO_FA void createPrimalTypeBuffer(void*& buf, size_t size) const {
-        buf = (void*)(new Real[size * vecSize]);
+        buf = (void*)bufferPool->alloc(size * vecSize);
       }
 
       CODI_INLINE_NO_FA void deletePrimalTypeBuffer(void*& b) const {
         if (nullptr != b) {
-          Real* buf = (Real*)b;
-          delete[] buf;
+          bufferPool->free((Real*)b);
           b = nullptr;
         }
       }
 
       CODI_INLINE_NO_FA void createAdjointTypeBuffer(void*& buf, size_t size) const {
-        buf = (void*)(new Real[size * vecSize]);
+        buf = (void*)bufferPool->alloc(size * vecSize);
       }
 
       CODI_INLINE_NO_FA void deleteAdjointTypeBuffer(void*& b) const {
         if (nullptr != b) {
-          Real* buf = (Real*)b;
-          delete[] buf;
+          bufferPool->free((Real*)b);
           b = nullptr;
         }
       }
@@ -219,6 +212,13 @@ namespace codi {
         return opHelper.convertOperator(op);
       }
 
+      /// Pool for the primal and adjoint buffers that are created during the evaluation of the MPI handles.
+      static MpiBufferPool<PrimalType>& getBufferPool() {
+        static MpiBufferPool<PrimalType> bufferPool;
+
+        return bufferPool;
+      }
+
       CODI_INLINE_NO_FA void stopAssembly(medi::HandleBase* h) const {
         CODI_UNUSED(h);
 
@@ -320,7 +320,7 @@ namespace codi {
         CODI_UNUSED(tape);
 
         medi::HandleBase* handle = static_cast<medi::HandleBase*>(h);
-        CoDiMeDiAdjointInterfaceWrapper<Type> ahWrapper(ah);
+        CoDiMeDiAdjointInterfaceWrapper<Type> ahWrapper(ah, &getBufferPool());
         handle->funcReverse(handle, &ahWrapper);
       }
 
@@ -328,7 +328,7 @@ namespace codi {
         CODI_UNUSED(tape);
 
         medi::HandleBase* handle = static_cast<medi::HandleBase*>(h);
-        CoDiMeDiAdjointInterfaceWrapper<Type> ahWrapper(ah);
+        CoDiMeDiAdjointInterfaceWrapper<Type> ahWrapper(ah, &getBufferPool());
         handle->funcForward(handle, &ahWrapper);
       }
 
@@ -336,7 +336,7 @@ namespace codi {
         CODI_UNUSED(tape);
 
         medi::HandleBase* handle = static_cast<medi::HandleBase*>(h);
-        CoDiMeDiAdjointInterfaceWrapper<Type> ahWrapper(ah);
+        CoDiMeDiAdjointInterfaceWrapper<Type> ahWrapper(ah, &getBufferPool());
         handle->funcPrimal(handle, &ahWrapper);
       }
 
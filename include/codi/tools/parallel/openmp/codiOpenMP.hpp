@@ -38,7 +38,9 @@
 #include "../../../expressions/parallelActiveType.hpp"
 #include "../../../tapes/indices/parallelReuseIndexManager.hpp"
 #include "../../../tapes/misc/threadSafeGlobalAdjoints.hpp"
+#include "../../../tapes/misc/threadSafeSegmentedGlobalAdjoints.hpp"
 #include "../../data/direction.hpp"
+#include "openMPAdjointEvaluation.hpp"
 #include "openMPAtomic.hpp"
 #include "openMPMutex.hpp"
 #include "openMPReverseAtomic.hpp"
@@ -57,17 +59,26 @@ namespace codi {
   template<typename Type>
   using OpenMPExternalFunctionHelper = ExternalFunctionHelper<Type, OpenMPSynchronization, OpenMPThreadInformation>;
 
+  /// One preaccumulation helper for each OpenMP thread. See PreaccumulationHelperPool.
+  template<typename Type, typename Helper = PreaccumulationHelper<Type>>
+  using OpenMPPreaccumulationHelperPool = PreaccumulationHelperPool<Type, OpenMPThreadInformation, Helper>;
+
   /// Thread-safe global adjoints for OpenMP.
   template<typename Gradient, typename Identifier, typename Tape>
   using OpenMPGlobalAdjoints = ThreadSafeGlobalAdjoints<Gradient, Identifier, Tape, OpenMPToolbox>;
 
+  /// Thread-safe global adjoints for OpenMP with segmented storage. Adjoint access does not require locking.
+  template<typename Gradient, typename Identifier, typename Tape>
+  using OpenMPSegmentedGlobalAdjoints = ThreadSafeSegmentedGlobalAdjoints<Gradient, Identifier, Tape, OpenMPToolbox>;
+
   /// \copydoc codi::RealReverseIndexGen <br><br>
   /// This a thread-safe implementation for use with OpenMP. See \ref Example_23_OpenMP_Parallel_Codes for an example.
+  /// The adjoint implementation can be exchanged, e.g., for OpenMPSegmentedGlobalAdjoints.
   template<typename Real, typename Gradient = OpenMPReverseAtomic<Real>,
-           typename IndexManager = ParallelReuseIndexManager<int, OpenMPToolbox>>
+           typename IndexManager = ParallelReuseIndexManager<int, OpenMPToolbox>,
+           template<typename, typename, typename> class Adjoints = OpenMPGlobalAdjoints>
   using RealReverseIndexOpenMPGen = ParallelActiveType<
-      JacobianReuseTape<JacobianTapeTypes<Real, Gradient, IndexManager, DefaultChunkedData, OpenMPGlobalAdjoints>>,
-      OpenMPToolbox>;
+      JacobianReuseTape<JacobianTapeTypes<Real, Gradient, IndexManager, DefaultChunkedData, Adjoints>>, OpenMPToolbox>;
 
   /// \copydoc codi::RealReverseIndexOpenMPGen
   using RealReverseIndexOpenMP = RealReverseIndexOpenMPGen<double>;
@@ -75,4 +86,10 @@ namespace codi {
   /// \copydoc codi::RealReverseIndexOpenMPGen
   template<size_t dim>
   using RealReverseIndexVecOpenMP = RealReverseIndexOpenMPGen<double, OpenMPReverseAtomic<Direction<double, dim>>>;
+
+  /// \copydoc codi::RealReverseIndexOpenMPGen <br><br>
+  /// Uses OpenMPSegmentedGlobalAdjoints, adjoint access and evaluations do not lock the adjoint vector.
+  using RealReverseIndexOpenMPSegmented =
+      RealReverseIndexOpenMPGen<double, OpenMPReverseAtomic<double>, ParallelReuseIndexManager<int, OpenMPToolbox>,
+                                OpenMPSegmentedGlobalAdjoints>;
 }
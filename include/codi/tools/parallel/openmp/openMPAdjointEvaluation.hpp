@@ -0,0 +1,280 @@
+/*
+ * CoDiPack, a Code Differentiation Package
+ *
+ * Copyright (C) 2015-2026 Chair for Scientific Computing (SciComp), RPTU University Kaiserslautern-Landau
+ * Homepage: http://scicomp.rptu.de
+ * Contact:  Prof. Nicolas R. Gauger (codi@scicomp.uni-kl.de)
+ *
+ * Lead developers: Max Sagebaum, Johannes Blühdorn (SciComp, RPTU University Kaiserslautern-Landau)
+ *
+ * This file is part of CoDiPack (http://scicomp.rptu.de/software/codi).
+ *
+ * CoDiPack is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * CoDiPack is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * See the GNU General Public License for more details.
+ * You should have received a copy of the GNU
+ * General Public License along with CoDiPack.
+ * If not, see <http://www.gnu.org/licenses/>.
+ *
+ * For other licensing options please contact us.
+ *
+ * Authors:
+ *  - SciComp, RPTU University Kaiserslautern-Landau:
+ *    - Max Sagebaum
+ *    - Johannes Blühdorn
+ *    - Former members:
+ *      - Tim Albring
+ */
+#pragma once
+
+#include <algorithm>
+#include <type_traits>
+#include <vector>
+
+#include "../../../config.h"
+#include "../../../misc/macros.hpp"
+#include "../../../tapes/misc/tapeParameters.hpp"
+#include "../../../traits/atomicTraits.hpp"
+#include "../../../traits/gradientTraits.hpp"
+#include "../../../traits/realTraits.hpp"
+#include "macros.hpp"
+
+/** \copydoc codi::Namespace */
+namespace codi {
+
+  /// Accumulation strategy for adjoint updates in OpenMP parallel reverse sweeps.
+  enum class OpenMPAdjointAccumulation {
+    Atomic,     ///< Update the shared adjoint vector with atomic operations.
+    Privatized  ///< Accumulate into thread-private buffers, merge them afterwards.
+  };
+
+  /**
+   * @brief Parallel reverse evaluation of thread-local tapes that share a global adjoint vector.
+   *
+   * Each thread of an OpenMP team records into its own tape, e.g., with RealReverseIndexOpenMP. For the reverse sweep,
+   * each thread calls evaluate() with its own tape and positions. All threads of the team have to call it, it contains
+   * barriers. The tapes' adjoints are shared among all threads.
+   *
+   * With OpenMPAdjointAccumulation::Atomic, the shared adjoint vector is updated with the atomic operations of the
+   * tape's gradient type. This is identical to a call of the tape's evaluate function in each thread.
+   *
+   * With OpenMPAdjointAccumulation::Privatized, each thread evaluates its tape on a private dense adjoint buffer with
+   * plain additions. When an identifier is accessed for the first time by a thread, its shared adjoint value is
+   * exchanged with zero and moved into the private buffer. This way, the adjoint of a left hand side is complete when
+   * it is read, under the usual assumption that the forward code was free of data races. After all threads have
+   * finished their sweeps, the private buffers are merged pairwise in a tree reduction and the result is added to the
+   * shared adjoint vector. Only entries that were touched by a thread are merged. The memory for the private buffers
+   * is (number of threads) x (adjoint vector size) gradient values, it is kept for subsequent evaluations.
+   *
+   * Privatization pays off if many identifiers receive contributions from the same thread, e.g., for reductions or
+   * stencils, where atomic updates on the same cache lines are expensive. Per tape type, the strategy is selected with
+   * the template argument. Arithmetic and Direction gradient types are supported. The tape's adjoint vector must
+   * provide references to its entries, as, e.g., OpenMPGlobalAdjoints and OpenMPSegmentedGlobalAdjoints do.
+   *
+   * Example:
+   * \code{.cpp}
+   *   OpenMPAdjointEvaluation<Tape> evaluation;  // shared by all threads
+   *
+   *   #pragma omp parallel
+   *   {
+   *     Tape& tape = Real::getTape();
+   *     evaluation.evaluate(tape, tape.getPosition(), tape.getZeroPosition());
+   *   }
+   * \endcode
+   *
+   * @tparam T_Tape          The tape type. Each thread uses its own tape of this type.
+   * @tparam T_accumulation  The accumulation strategy for the adjoint updates.
+   */
+  template<typename T_Tape, OpenMPAdjointAccumulation T_accumulation = OpenMPAdjointAccumulation::Privatized>
+  struct OpenMPAdjointEvaluation {
+    public:
+
+      using Tape = CODI_DD(T_Tape, CODI_DEFAULT_TAPE);  ///< See OpenMPAdjointEvaluation.
+      static OpenMPAdjointAccumulation constexpr accumulation = T_accumulation;  ///< See OpenMPAdjointEvaluation.
+
+      using Identifier = typename Tape::Identifier;                          ///< See TapeTypesInterface.
+      using Position = typename Tape::Position;                              ///< See TapeTypesInterface.
+      using Gradient = AtomicTraits::RemoveAtomic<typename Tape::Gradient>;  ///< Gradient type without atomics.
+
+    private:
+
+      /// Private adjoint buffer of a thread.
+      struct ThreadData {
+        public:
+          std::vector<Gradient> values;               ///< Dense private adjoint values.
+          std::vector<char> touched;                  ///< Marks identifiers that are present in touchedIdentifiers.
+          std::vector<Identifier> touchedIdentifiers;  ///< Identifiers with private adjoint values.
+
+          /// Ensure that all identifiers below size can be stored.
+          void resize(size_t size) {
+            if (values.size() < size) {
+              values.resize(size, Gradient());
+              touched.resize(size, 0);
+            }
+          }
+
+          /// Mark the identifier as touched. Returns true if it was not touched before.
+          CODI_INLINE bool touch(Identifier const& identifier) {
+            if (0 == touched[identifier]) {
+              touched[identifier] = 1;
+              touchedIdentifiers.push_back(identifier);
+
+              return true;
+            } else {
+              return false;
+            }
+          }
+      };
+
+      /// Adjoint vector for the tape evaluation. Moves shared adjoints into the private buffer on first access.
+      template<typename SharedAdjoints>
+      struct PrivatizedAdjointVector {
+        public:
+          using value_type = Gradient;  ///< See AdjointVectorTraits::GradientImplementation.
+
+          ThreadData& data;       ///< Private buffer of the evaluating thread.
+          SharedAdjoints shared;  ///< Internal adjoints of the tape.
+
+          /// Constructor.
+          PrivatizedAdjointVector(ThreadData& data, SharedAdjoints shared) : data(data), shared(shared) {}
+
+          /// Access to the private adjoint value.
+          CODI_INLINE Gradient& operator[](Identifier const& identifier) const {
+            if (data.touch(identifier)) {
+              exchangeWithZero(asNonAtomic(shared[identifier]), data.values[identifier]);
+            }
+
+            return data.values[identifier];
+          }
+      };
+
+      std::vector<ThreadData> threadData;
+
+    public:
+
+      /// Evaluate the tape of the calling thread from start to end. Has to be called by all threads of the team.
+      void evaluate(Tape& tape, Position const& start, Position const& end) {
+        int const threadId = omp_get_thread_num();
+        int const numThreads = omp_get_num_threads();
+
+        CODI_PRAGMA(omp single) {
+          tape.resizeAdjointVector();
+          if (threadData.size() < (size_t)numThreads) {
+            threadData.resize(numThreads);
+          }
+        }  // Implicit barrier, no thread uses the adjoint vector before it is resized.
+
+        tape.beginUseAdjointVector();
+
+        if constexpr (OpenMPAdjointAccumulation::Atomic == accumulation) {
+          tape.evaluate(start, end, tape.getInternalAdjoints());
+        } else {
+          ThreadData& data = threadData[threadId];
+          data.resize(tape.getParameter(TapeParameters::AdjointSize));
+
+          using SharedAdjoints = decltype(tape.getInternalAdjoints());
+          tape.evaluate(start, end, PrivatizedAdjointVector<SharedAdjoints>(data, tape.getInternalAdjoints()));
+
+          reduce(threadId, numThreads);
+          flush(tape.getInternalAdjoints(), threadId, numThreads);
+        }
+
+        tape.endUseAdjointVector();
+      }
+
+    private:
+
+      /// Pairwise tree reduction of the private buffers into the buffer of thread 0.
+      void reduce(int threadId, int numThreads) {
+        CODI_OMP_BARRIER()
+
+        for (int stride = 1; stride < numThreads; stride *= 2) {
+          if (0 == threadId % (2 * stride) && threadId + stride < numThreads) {
+            merge(threadData[threadId], threadData[threadId + stride]);
+          }
+
+          CODI_OMP_BARRIER()
+        }
+      }
+
+      /// Add the touched entries of source to target and clear source.
+      static void merge(ThreadData& target, ThreadData& source) {
+        target.resize(source.values.size());
+
+        for (Identifier const& identifier : source.touchedIdentifiers) {
+          if (target.touch(identifier)) {
+            target.values[identifier] = source.values[identifier];
+          } else {
+            target.values[identifier] += source.values[identifier];
+          }
+
+          source.values[identifier] = Gradient();
+          source.touched[identifier] = 0;
+        }
+        source.touchedIdentifiers.clear();
+      }
+
+      /// Add the reduced buffer to the shared adjoints. The work is distributed among all threads of the team.
+      template<typename SharedAdjoints>
+      void flush(SharedAdjoints shared, int threadId, int numThreads) {
+        ThreadData& root = threadData[0];
+
+        size_t const total = root.touchedIdentifiers.size();
+        size_t const begin = total * threadId / numThreads;
+        size_t const end = total * (threadId + 1) / numThreads;
+
+        // Identifiers in the list are unique, no atomic updates are required.
+        for (size_t pos = begin; pos < end; pos += 1) {
+          Identifier const& identifier = root.touchedIdentifiers[pos];
+
+          if (!RealTraits::isTotalZero(root.values[identifier])) {
+            asNonAtomic(shared[identifier]) += root.values[identifier];
+            root.values[identifier] = Gradient();
+          }
+          root.touched[identifier] = 0;
+        }
+
+        CODI_OMP_BARRIER()
+
+        if (0 == threadId) {
+          root.touchedIdentifiers.clear();
+        }
+      }
+
+      /// Non-atomic view on an entry of the shared adjoint vector, same layout as in CoDiOpDiLibTool.
+      template<typename SharedGradient>
+      static CODI_INLINE Gradient& asNonAtomic(SharedGradient& value) {
+        return reinterpret_cast<Gradient&>(value);
+      }
+
+      /// Atomically move the shared value into the private one and set the shared value to zero.
+      /// Zero components are only read, which avoids write contention for identifiers that are local to a thread.
+      static CODI_INLINE void exchangeWithZero(Gradient& shared, Gradient& value) {
+        using Real = GradientTraits::Real<Gradient>;
+        static_assert(std::is_arithmetic<Real>::value,
+                      "Privatized accumulation requires gradients with arithmetic components.");
+
+        for (size_t curDim = 0; curDim < GradientTraits::dim<Gradient>(); curDim += 1) {
+          Real& sharedComponent = GradientTraits::at(shared, curDim);
+          Real& component = GradientTraits::at(value, curDim);
+
+          CODI_OMP_ATOMIC(read)
+          component = sharedComponent;
+
+          if (Real() != component) {
+            CODI_OMP_ATOMIC(capture) {
+              component = sharedComponent;
+              sharedComponent = Real();
+            }
+          }
+        }
+      }
+  };
+}
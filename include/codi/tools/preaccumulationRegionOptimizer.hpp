@@ -0,0 +1,628 @@
+/*
+ * CoDiPack, a Code Differentiation Package
+ *
+ * Copyright (C) 2015-2026 Chair for Scientific Computing (SciComp), RPTU University Kaiserslautern-Landau
+ * Homepage: http://scicomp.rptu.de
+ * Contact:  Prof. Nicolas R. Gauger (codi@scicomp.uni-kl.de)
+ *
+ * Lead developers: Max Sagebaum, Johannes Blühdorn (SciComp, RPTU University Kaiserslautern-Landau)
+ *
+ * This file is part of CoDiPack (http://scicomp.rptu.de/software/codi).
+ *
+ * CoDiPack is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * CoDiPack is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * See the GNU General Public License for more details.
+ * You should have received a copy of the GNU
+ * General Public License along with CoDiPack.
+ * If not, see <http://www.gnu.org/licenses/>.
+ *
+ * For other licensing options please contact us.
+ *
+ * Authors:
+ *  - SciComp, RPTU University Kaiserslautern-Landau:
+ *    - Max Sagebaum
+ *    - Johannes Blühdorn
+ *    - Former members:
+ *      - Tim Albring
+ */
+#pragma once
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+#include "../config.h"
+#include "../misc/exceptions.hpp"
+#include "../misc/macros.hpp"
+#include "../tapes/interfaces/fullTapeInterface.hpp"
+#include "../traits/realTraits.hpp"
+#include "../traits/tapeTraits.hpp"
+#include "identifierCacheOptimizer.hpp"
+
+/** \copydoc codi::Namespace */
+namespace codi {
+
+  /**
+   * @brief Finds regions of a recorded tape that profit from preaccumulation and replaces them with their Jacobians.
+   *
+   * The optimization works on an already recorded tape and performs two steps:
+   *  1. analyze(): The tape is iterated with iterateForward and the data flow between the tape entries is recorded.
+   *     Afterwards, the tape is split into regions. A region is a contiguous range of statements, it is entered at its
+   *     first statement and left after its last statement. A region is selected if its Jacobian with respect to its
+   *     inputs requires much less memory than its statements, see maxJacobianRatio. Low level functions are never
+   *     part of a region. For Jacobian tapes, the Jacobians of the regions are computed from the recorded data.
+   *  2. rewrite(): The tape is rebuilt such that each region is replaced by one statement for each of its outputs,
+   *     which has the Jacobian of the output as arguments. This requires a Jacobian tape that supports editing, see
+   *     EditingTapeInterface.
+   *
+   * The analysis determines which values are still used after a region from the tape itself. Values that are used
+   * after the recording, e.g., the outputs of the program, are not visible on the tape and have to be provided to
+   * analyze(). All other values are assumed to be no longer used after the recording.
+   *
+   * writeReport() lists the selected regions with their range of tape entries and the identifiers of their inputs and
+   * outputs. The identifiers can be compared with the identifiers of the variables in the program, e.g., by printing
+   * getIdentifier(), in order to place a PreaccumulationHelper around the corresponding code. writeStatsVerbose()
+   * reports the estimated memory and the number of reverse sweep operations before and after the rewrite.
+   *
+   * The analysis stores a copy of the tape data. Positions of the tape are invalid after the rewrite.
+   *
+   * @tparam T_Tape  Tape on which the optimization is applied.
+   */
+  template<typename T_Tape>
+  struct PreaccumulationRegionOptimizer {
+    public:
+
+      using Tape = CODI_DD(T_Tape, CODI_DEFAULT_TAPE);  ///< See PreaccumulationRegionOptimizer.
+
+      using Real = typename Tape::Real;              ///< See FullTapeInterface.
+      using Identifier = typename Tape::Identifier;  ///< See FullTapeInterface.
+
+      /// Data of a selected region.
+      struct Region {
+          size_t firstEntry;  ///< First tape entry of the region.
+          size_t endEntry;    ///< One past the last tape entry of the region.
+          size_t arguments;   ///< Number of statement arguments in the region.
+
+          std::vector<size_t> inputs;   ///< Input nodes of the region.
+          std::vector<size_t> outputs;  ///< Output nodes of the region. An output that overwrites an input is last.
+
+          /// Number of arguments after the preaccumulation. Estimated with a dense Jacobian for primal value tapes.
+          size_t preaccumulatedArguments;
+          std::vector<Real> jacobian;  ///< Row major Jacobian of the region. Only computed for Jacobian tapes.
+      };
+
+      size_t minRegionSize = 8;        ///< Minimum number of statements in a region.
+      size_t maxRegionSize = 128;      ///< Maximum number of statements in a region.
+      double maxJacobianRatio = 0.25;  ///< Maximum memory of the Jacobian of a region relative to its statements.
+
+    private:
+
+      static size_t constexpr NoEntry = std::numeric_limits<size_t>::max();  ///< Marker for undefined entries.
+
+      /// Estimated bytes of a statement on a Jacobian tape.
+      static size_t constexpr StatementBytes = sizeof(Identifier) + sizeof(Config::ArgumentSize);
+      /// Estimated bytes of a statement argument on a Jacobian tape.
+      static size_t constexpr ArgumentBytes = sizeof(Real) + sizeof(Identifier);
+
+      Tape& tape;  ///< Tape that is analyzed and modified.
+
+      // Data flow graph. A node is a value on the tape, that is, an output of an entry or a value that is used on the
+      // tape but not defined on it.
+
+      std::vector<size_t> identifierNodes;    ///< Current node of each identifier plus one. Zero if there is none.
+      std::vector<Identifier> nodeIdentifiers;  ///< Identifier of each node.
+      std::vector<size_t> nodeDefinitions;    ///< Entry that defines the node. NoEntry for values defined elsewhere.
+      std::vector<size_t> nodeUseEnds;  ///< One past the last entry that uses the node. Zero if the node is unused,
+                                        ///< NoEntry if the node is used after the recording.
+
+      std::vector<size_t> entryInputOffsets;   ///< Offsets of the entries into inputNodes.
+      std::vector<size_t> inputNodes;          ///< Input nodes of all entries.
+      std::vector<Real> inputJacobians;        ///< Jacobians of the inputs. Only recorded for Jacobian tapes.
+      std::vector<size_t> entryOutputOffsets;  ///< Offsets of the entries into outputNodes.
+      std::vector<size_t> outputNodes;         ///< Output nodes of all entries.
+      std::vector<bool> entryIsLowLevelFunction;  ///< True for low level functions.
+
+      std::vector<Region> regions;  ///< Selected regions.
+
+      std::vector<Real> nodeAdjoints;  ///< Adjoints of the nodes for the Jacobian computation. Zero between regions.
+
+      /// Statistics of the analysis.
+      struct Stats {
+          size_t entries;
+          size_t lowLevelFunctions;
+          size_t statements;
+          size_t arguments;
+          size_t regions;
+          size_t regionStatements;
+          size_t regionArguments;
+          size_t preaccumulatedStatements;
+          size_t preaccumulatedArguments;
+      };
+      Stats stats = {};  ///< Statistics of the analysis.
+
+    public:
+
+      /// Constructor.
+      PreaccumulationRegionOptimizer(Tape& tape) : tape(tape) {}
+
+    private:
+
+      /**
+       * @brief Records the data flow of the tape entries.
+       *
+       * Statements of Jacobian tapes are handled directly in order to record the Jacobians. Statements of primal
+       * value tapes and low level functions are handled by the ApplyIdentifierModification.
+       */
+      struct HandleAnalysis : public ApplyIdentifierModification<Tape, HandleAnalysis> {
+        public:
+
+          using Base = ApplyIdentifierModification<Tape, HandleAnalysis>;  ///< Base class abbreviation.
+
+          PreaccumulationRegionOptimizer& opt;  ///< Reference to the optimizer.
+          bool isLowLevelFunction;              ///< True while a low level function is handled.
+
+          /// Constructor.
+          HandleAnalysis(PreaccumulationRegionOptimizer& opt) : Base(opt.tape), opt(opt), isLowLevelFunction(false) {}
+
+          using Base::handleStatement;
+
+          /// Records the arguments and Jacobians of a statement of a Jacobian tape.
+          template<typename JacobianReal>
+          CODI_INLINE void handleStatement(Identifier& lhsIndex, size_t const& size, JacobianReal const* jacobians,
+                                           Identifier* rhsIdentifiers) {
+            for (size_t i = 0; i < size; i += 1) {
+              if (opt.addInput(rhsIdentifiers[i])) {
+                opt.inputJacobians.push_back((Real)jacobians[i]);
+              }
+            }
+            opt.addOutput(lhsIndex);
+            opt.finishEntry(false);
+          }
+
+          /// Marks the entry as a low level function.
+          CODI_INLINE void handleLowLevelFunction(LowLevelFunctionEntry<Tape, Real, Identifier> const& func,
+                                                  ByteDataView& llfData) {
+            isLowLevelFunction = true;
+            Base::handleLowLevelFunction(func, llfData);
+            isLowLevelFunction = false;
+          }
+
+          /// \copydoc ApplyIdentifierModification::applyToInput
+          CODI_INLINE void applyToInput(Identifier& id) {
+            opt.addInput(id);
+          }
+
+          /// \copydoc ApplyIdentifierModification::applyToOutput
+          CODI_INLINE void applyToOutput(Identifier& id) {
+            opt.addOutput(id);
+          }
+
+          /// \copydoc ApplyIdentifierModification::applyPostOutputLogic
+          CODI_INLINE void applyPostOutputLogic() {
+            opt.finishEntry(isLowLevelFunction);
+          }
+      };
+
+      /// Get the current node of the identifier. Creates a node if the identifier has none.
+      CODI_INLINE size_t getNode(Identifier const& id) {
+        if ((size_t)id >= identifierNodes.size()) {
+          identifierNodes.resize(2 * (size_t)id + 1, 0);
+        }
+
+        if (0 == identifierNodes[id]) {
+          identifierNodes[id] = createNode(id, NoEntry);
+        }
+
+        return identifierNodes[id] - 1;
+      }
+
+      /// Create a new node and return its number plus one.
+      CODI_INLINE size_t createNode(Identifier const& id, size_t definition) {
+        nodeIdentifiers.push_back(id);
+        nodeDefinitions.push_back(definition);
+        nodeUseEnds.push_back(0);
+
+        return nodeIdentifiers.size();
+      }
+
+      /// Add an input to the current entry. Returns false for passive inputs.
+      CODI_INLINE bool addInput(Identifier const& id) {
+        if (Identifier() == id) {
+          return false;
+        }
+
+        size_t node = getNode(id);
+        inputNodes.push_back(node);
+        nodeUseEnds[node] = entryIsLowLevelFunction.size() + 1;
+
+        return true;
+      }
+
+      /// Add an output to the current entry.
+      CODI_INLINE void addOutput(Identifier const& id) {
+        if (Identifier() == id) {
+          return;
+        }
+
+        if ((size_t)id >= identifierNodes.size()) {
+          identifierNodes.resize(2 * (size_t)id + 1, 0);
+        }
+
+        identifierNodes[id] = createNode(id, entryIsLowLevelFunction.size());
+        outputNodes.push_back(identifierNodes[id] - 1);
+      }
+
+      /// Finish the current entry.
+      CODI_INLINE void finishEntry(bool isLowLevelFunction) {
+        entryInputOffsets.push_back(inputNodes.size());
+        entryOutputOffsets.push_back(outputNodes.size());
+        entryIsLowLevelFunction.push_back(isLowLevelFunction);
+      }
+
+      /// Number of inputs of the entry.
+      CODI_INLINE size_t getInputCount(size_t entry) const {
+        return entryInputOffsets[entry + 1] - entryInputOffsets[entry];
+      }
+
+      /// True if the node is defined before the entry or outside of the tape.
+      CODI_INLINE bool isDefinedBefore(size_t node, size_t entry) const {
+        return NoEntry == nodeDefinitions[node] || nodeDefinitions[node] < entry;
+      }
+
+      /// Estimated bytes of the statements and arguments on a Jacobian tape.
+      CODI_INLINE size_t getBytes(size_t statements, size_t arguments) const {
+        return statements * StatementBytes + arguments * ArgumentBytes;
+      }
+
+      /// Select the regions with a greedy search. Each region is extended as long as the savings grow.
+      void selectRegions() {
+        size_t const entries = entryIsLowLevelFunction.size();
+        size_t const nodes = nodeIdentifiers.size();
+
+        // The stamps mark nodes that have been counted for the region starting at stamp - 1.
+        std::vector<size_t> inputStamps(nodes, 0);
+        std::vector<size_t> removedStamps(nodes, 0);
+
+        size_t first = 0;
+        while (first < entries) {
+          size_t const stamp = first + 1;
+          size_t inputs = 0;
+          size_t outputs = 0;
+          size_t arguments = 0;
+
+          size_t bestEnd = 0;
+          size_t bestSaving = 0;
+
+          size_t const maxEnd = std::min(entries, first + maxRegionSize);
+          for (size_t cur = first; cur < maxEnd && !entryIsLowLevelFunction[cur]; cur += 1) {
+            arguments += getInputCount(cur);
+
+            for (size_t pos = entryInputOffsets[cur]; pos < entryInputOffsets[cur + 1]; pos += 1) {
+              size_t node = inputNodes[pos];
+              if (isDefinedBefore(node, first)) {
+                if (stamp != inputStamps[node]) {
+                  inputStamps[node] = stamp;
+                  inputs += 1;
+                }
+              } else if (cur + 1 == nodeUseEnds[node] && stamp != removedStamps[node]) {
+                // Last use of a value of the region.
+                removedStamps[node] = stamp;
+                outputs -= 1;
+              }
+            }
+
+            for (size_t pos = entryOutputOffsets[cur]; pos < entryOutputOffsets[cur + 1]; pos += 1) {
+              if (nodeUseEnds[outputNodes[pos]] > cur + 1) {
+                outputs += 1;
+              }
+            }
+
+            if (inputs >= Config::MaxArgumentSize) {
+              break;
+            }
+
+            size_t const statements = cur + 1 - first;
+            size_t const bytes = getBytes(statements, arguments);
+            size_t const preaccumulatedBytes = getBytes(outputs, outputs * inputs);
+            if (statements >= minRegionSize && preaccumulatedBytes <= maxJacobianRatio * bytes &&
+                bytes - preaccumulatedBytes > bestSaving) {
+              bestEnd = cur + 1;
+              bestSaving = bytes - preaccumulatedBytes;
+            }
+          }
+
+          if (0 != bestEnd && addRegion(first, bestEnd)) {
+            first = bestEnd;
+          } else {
+            first += 1;
+          }
+        }
+      }
+
+      /// Collect the inputs and outputs of the region and add it. Returns false if the region can not be replaced.
+      bool addRegion(size_t first, size_t end) {
+        Region region = {};
+        region.firstEntry = first;
+        region.endEntry = end;
+        region.arguments = entryInputOffsets[end] - entryInputOffsets[first];
+
+        for (size_t pos = entryInputOffsets[first]; pos < entryInputOffsets[end]; pos += 1) {
+          size_t node = inputNodes[pos];
+          if (isDefinedBefore(node, first) &&
+              region.inputs.end() == std::find(region.inputs.begin(), region.inputs.end(), node)) {
+            region.inputs.push_back(node);
+          }
+        }
+
+        // The replacement statements read the inputs. An output that overwrites the identifier of an input has to be
+        // stored after all other outputs, which is only possible for one such output.
+        size_t overwritingOutputs = 0;
+        size_t overwritingNode = 0;
+        for (size_t pos = entryOutputOffsets[first]; pos < entryOutputOffsets[end]; pos += 1) {
+          size_t node = outputNodes[pos];
+          if (nodeUseEnds[node] > end) {
+            bool overwritesInput = false;
+            for (size_t input : region.inputs) {
+              overwritesInput |= nodeIdentifiers[input] == nodeIdentifiers[node];
+            }
+
+            if (overwritesInput) {
+              overwritingOutputs += 1;
+              overwritingNode = node;
+            } else {
+              region.outputs.push_back(node);
+            }
+          }
+        }
+
+        if (overwritingOutputs > 1) {
+          return false;
+        } else if (1 == overwritingOutputs) {
+          region.outputs.push_back(overwritingNode);
+        }
+
+        region.preaccumulatedArguments = region.outputs.size() * region.inputs.size();
+        if (TapeTraits::isJacobianTape<Tape>) {
+          computeJacobian(region);
+        }
+
+        regions.push_back(std::move(region));
+
+        return true;
+      }
+
+      /// Compute the Jacobian of the region with reverse sweeps over the recorded data.
+      void computeJacobian(Region& region) {
+        region.jacobian.resize(region.outputs.size() * region.inputs.size());
+        region.preaccumulatedArguments = 0;
+
+        for (size_t curOut = 0; curOut < region.outputs.size(); curOut += 1) {
+          nodeAdjoints[region.outputs[curOut]] = 1.0;
+
+          for (size_t cur = region.endEntry; cur > region.firstEntry; /* decrement is done inside the loop */) {
+            cur -= 1;
+
+            if (entryOutputOffsets[cur] == entryOutputOffsets[cur + 1]) {
+              continue;  // Statement without an active output.
+            }
+
+            size_t lhsNode = outputNodes[entryOutputOffsets[cur]];
+            Real lhsAdjoint = nodeAdjoints[lhsNode];
+            nodeAdjoints[lhsNode] = Real();
+
+            if (CODI_ENABLE_CHECK(Config::SkipZeroAdjointEvaluation, RealTraits::isTotalZero(lhsAdjoint))) {
+              continue;
+            }
+
+            for (size_t pos = entryInputOffsets[cur]; pos < entryInputOffsets[cur + 1]; pos += 1) {
+              nodeAdjoints[inputNodes[pos]] += inputJacobians[pos] * lhsAdjoint;
+            }
+          }
+
+          for (size_t curIn = 0; curIn < region.inputs.size(); curIn += 1) {
+            Real& jac = region.jacobian[curOut * region.inputs.size() + curIn];
+            jac = nodeAdjoints[region.inputs[curIn]];
+            nodeAdjoints[region.inputs[curIn]] = Real();
+
+            if (Real() != jac) {
+              region.preaccumulatedArguments += 1;
+            }
+          }
+        }
+      }
+
+      /// Compute the statistics for the analysis.
+      void updateStats() {
+        stats = {};
+        stats.entries = entryIsLowLevelFunction.size();
+        for (size_t cur = 0; cur < stats.entries; cur += 1) {
+          if (entryIsLowLevelFunction[cur]) {
+            stats.lowLevelFunctions += 1;
+          } else {
+            stats.arguments += getInputCount(cur);
+          }
+        }
+        stats.statements = stats.entries - stats.lowLevelFunctions;
+
+        stats.regions = regions.size();
+        for (Region const& region : regions) {
+          stats.regionStatements += region.endEntry - region.firstEntry;
+          stats.regionArguments += region.arguments;
+          stats.preaccumulatedStatements += region.outputs.size();
+          stats.preaccumulatedArguments += region.preaccumulatedArguments;
+        }
+      }
+
+    public:
+
+      /**
+       * @brief Analyze the tape and select the regions.
+       *
+       * @param iterOut  Called with a function object that accepts an Identifier&. It has to call the function object
+       *                 for the identifiers of all values that are used after the recording, e.g., the outputs.
+       */
+      template<typename FuncOut>
+      CODI_NO_INLINE void analyze(FuncOut&& iterOut) {
+        identifierNodes.clear();
+        nodeIdentifiers.clear();
+        nodeDefinitions.clear();
+        nodeUseEnds.clear();
+        entryInputOffsets.assign(1, 0);
+        inputNodes.clear();
+        inputJacobians.clear();
+        entryOutputOffsets.assign(1, 0);
+        outputNodes.clear();
+        entryIsLowLevelFunction.clear();
+        regions.clear();
+
+        identifierNodes.resize((size_t)tape.getIndexManager().getLargestCreatedIndex() + 1, 0);
+
+        HandleAnalysis analysis = {*this};
+        tape.iterateForward(analysis);
+
+        iterOut([&](Identifier& id) {
+          if (Identifier() != id) {
+            nodeUseEnds[getNode(id)] = NoEntry;
+          }
+        });
+
+        if (TapeTraits::isJacobianTape<Tape>) {
+          nodeAdjoints.assign(nodeIdentifiers.size(), Real());
+        }
+
+        selectRegions();
+        updateStats();
+
+        nodeAdjoints = std::vector<Real>();
+      }
+
+      /**
+       * @brief Replace the selected regions on the tape with their Jacobians.
+       *
+       * The tape is rebuilt with ReadWriteTapeInterface::createStatementManual on a helper tape and appended to the
+       * emptied tape with EditingTapeInterface::append. Tapes with low level functions can not be rebuilt.
+       */
+      CODI_NO_INLINE void rewrite() {
+        CODI_STATIC_ASSERT(TapeTraits::isJacobianTape<Tape> && TapeTraits::supportsEditing<Tape>,
+                           "The rewrite requires a Jacobian tape that supports editing.");
+
+        if (0 != stats.lowLevelFunctions) {
+          CODI_EXCEPTION("Tapes with low level functions can not be rewritten.");
+          return;
+        }
+
+        Tape helperTape;
+        std::vector<Real> jacobians;
+        std::vector<Identifier> identifiers;
+
+        size_t curRegion = 0;
+        size_t cur = 0;
+        while (cur < entryIsLowLevelFunction.size()) {
+          if (curRegion < regions.size() && cur == regions[curRegion].firstEntry) {
+            Region const& region = regions[curRegion];
+            size_t const inputs = region.inputs.size();
+
+            for (size_t curOut = 0; curOut < region.outputs.size(); curOut += 1) {
+              jacobians.clear();
+              identifiers.clear();
+              for (size_t curIn = 0; curIn < inputs; curIn += 1) {
+                Real const& jac = region.jacobian[curOut * inputs + curIn];
+                if (Real() != jac) {
+                  jacobians.push_back(jac);
+                  identifiers.push_back(nodeIdentifiers[region.inputs[curIn]]);
+                }
+              }
+              pushStatement(helperTape, region.outputs[curOut], jacobians, identifiers);
+            }
+
+            cur = region.endEntry;
+            curRegion += 1;
+          } else {
+            if (entryOutputOffsets[cur] != entryOutputOffsets[cur + 1]) {
+              jacobians.clear();
+              identifiers.clear();
+              for (size_t pos = entryInputOffsets[cur]; pos < entryInputOffsets[cur + 1]; pos += 1) {
+                jacobians.push_back(inputJacobians[pos]);
+                identifiers.push_back(nodeIdentifiers[inputNodes[pos]]);
+              }
+              pushStatement(helperTape, outputNodes[entryOutputOffsets[cur]], jacobians, identifiers);
+            }
+
+            cur += 1;
+          }
+        }
+
+        tape.resetTo(tape.getZeroPosition(), false);
+        tape.append(helperTape, helperTape.getZeroPosition(), helperTape.getPosition());
+      }
+
+      /// Get the selected regions.
+      std::vector<Region> const& getRegions() const {
+        return regions;
+      }
+
+      /// Get the identifier of a node of a region.
+      Identifier getNodeIdentifier(size_t node) const {
+        return nodeIdentifiers[node];
+      }
+
+      /// Write a list of the selected regions to a stream.
+      template<typename Stream>
+      void writeReport(Stream& out) {
+        for (size_t cur = 0; cur < regions.size(); cur += 1) {
+          Region const& region = regions[cur];
+          out << "Region " << cur << ": entries [" << region.firstEntry << ", " << region.endEntry << "), "
+              << (region.endEntry - region.firstEntry) << " statements, " << region.arguments << " arguments, "
+              << region.inputs.size() << " inputs, " << region.outputs.size() << " outputs, "
+              << region.preaccumulatedArguments << " preaccumulated arguments" << std::endl;
+
+          out << "  Input identifiers:";
+          for (size_t node : region.inputs) {
+            out << " " << nodeIdentifiers[node];
+          }
+          out << std::endl;
+
+          out << "  Output identifiers:";
+          for (size_t node : region.outputs) {
+            out << " " << nodeIdentifiers[node];
+          }
+          out << std::endl;
+        }
+      }
+
+      /// Write statistics to a stream as a list. Memory is estimated for a Jacobian tape, the sweep operations are the
+      /// number of statements and arguments.
+      template<typename Stream>
+      void writeStatsVerbose(Stream& out) {
+        size_t const statementsAfter = stats.statements - stats.regionStatements + stats.preaccumulatedStatements;
+        size_t const argumentsAfter = stats.arguments - stats.regionArguments + stats.preaccumulatedArguments;
+
+        out << "Entries: " << stats.entries << std::endl;
+        out << "Low level functions: " << stats.lowLevelFunctions << std::endl;
+        out << "Regions: " << stats.regions << std::endl;
+        out << "Statements: " << stats.statements << " -> " << statementsAfter << std::endl;
+        out << "Arguments: " << stats.arguments << " -> " << argumentsAfter << std::endl;
+        out << "Memory (bytes): " << getBytes(stats.statements, stats.arguments) << " -> "
+            << getBytes(statementsAfter, argumentsAfter) << std::endl;
+        out << "Sweep operations: " << (stats.statements + stats.arguments) << " -> "
+            << (statementsAfter + argumentsAfter) << std::endl;
+      }
+
+    private:
+
+      /// Push a statement with the identifier of the node as the left hand side.
+      void pushStatement(Tape& helperTape, size_t node, std::vector<Real> const& jacobians,
+                         std::vector<Identifier> const& identifiers) {
+        Identifier lhsIdentifier = nodeIdentifiers[node];
+        helperTape.createStatementManual(Real(), lhsIdentifier, jacobians.size(), jacobians.data(),
+                                         identifiers.data());
+      }
+  };
+}
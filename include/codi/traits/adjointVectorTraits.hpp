@@ -36,12 +36,17 @@
 
 #include <type_traits>
 
+#include "gradientTraits.hpp"
+
 /** \copydoc codi::Namespace */
 namespace codi {
 
   template<typename Gradient, typename Identifier, typename Tape, typename ParallelToolbox>
   struct ThreadSafeGlobalAdjoints;
 
+  template<typename Gradient, typename Identifier, typename Tape, typename ParallelToolbox>
+  struct ThreadSafeSegmentedGlobalAdjoints;
+
   /// Traits for the internal adjoint variables maintained by the tape.
   namespace InternalAdjointVectorTraits {
 
@@ -52,6 +57,9 @@ namespace codi {
 #ifndef DOXYGEN_DISABLE
     template<typename Gradient, typename Identifier, typename Tape, typename ParallelToolbox>
     struct IsGlobal<ThreadSafeGlobalAdjoints<Gradient, Identifier, Tape, ParallelToolbox>> : std::true_type {};
+
+    template<typename Gradient, typename Identifier, typename Tape, typename ParallelToolbox>
+    struct IsGlobal<ThreadSafeSegmentedGlobalAdjoints<Gradient, Identifier, Tape, ParallelToolbox>> : std::true_type {};
 #endif
 
   }
@@ -90,5 +98,33 @@ namespace codi {
      */
     template<typename AdjointVector>
     using Gradient = typename GradientImplementation<AdjointVector>::Gradient;
+
+    /**
+     * @brief Trait implementation to query the number of directions evaluated with an adjoint vector.
+     *
+     * Default implementation uses the compile time dimension of the entry type. Adjoint vectors with a runtime
+     * dimension specialize this trait.
+     */
+    template<typename AdjointVector>
+    struct VectorSizeImplementation {
+      public:
+        /// Number of directions.
+        static size_t get(AdjointVector const& adjoints) {
+          CODI_UNUSED(adjoints);
+          return GradientTraits::dim<Gradient<AdjointVector>>();
+        }
+    };
+
+#ifndef DOXYGEN_DISABLE
+    /// Specialization for references.
+    template<typename AdjointVector>
+    struct VectorSizeImplementation<AdjointVector&> : public VectorSizeImplementation<AdjointVector> {};
+#endif
+
+    /// Number of directions that are evaluated in one sweep with the given adjoint vector.
+    template<typename AdjointVector>
+    size_t getVectorSize(AdjointVector const& adjoints) {
+      return VectorSizeImplementation<AdjointVector>::get(adjoints);
+    }
   }
 }
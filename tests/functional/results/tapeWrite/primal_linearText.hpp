@@ -16,4 +16,16 @@ std::vector<typename Tape::EvalHandle> primal_linearTextCreateEvalHandles(){
   evalHandles[6] = Tape::StatementEvaluator::template createHandle<Impl, Impl, codi::AssignStatement<codi::ActiveType<codi::PrimalValueLinearTape<codi::PrimalValueTapeTypes<double, double, codi::LinearIndexManager<int>, codi::InnerStatementEvaluator, codi::DefaultChunkedData> > >, codi::ActiveType<codi::PrimalValueLinearTape<codi::PrimalValueTapeTypes<double, double, codi::LinearIndexManager<int>, codi::InnerStatementEvaluator, codi::DefaultChunkedData> > > >>();
 
   return evalHandles;
-}
\ No newline at end of file
+}
+
+template <typename Impl>
+struct primal_linearTextStatementRegistry {
+  using Statements = std::tuple<
+    codi::AssignStatement<codi::ActiveType<Impl >, codi::ComputeExpression<double, codi::EmptyOperation> >,
+    codi::AssignStatement<codi::ActiveType<Impl >, codi::ComputeExpression<double, codi::OperationSin, codi::ActiveType<Impl > > >,
+    codi::AssignStatement<codi::ActiveType<Impl >, codi::ComputeExpression<double, codi::OperationAdd, codi::ActiveType<Impl >, codi::ActiveType<Impl > > >,
+    codi::AssignStatement<codi::ActiveType<Impl >, codi::ComputeExpression<double, codi::OperationMultiply, codi::ActiveType<Impl >, codi::ActiveType<Impl > > >,
+    codi::AssignStatement<std::complex<codi::ActiveType<Impl > >, codi::ComputeExpression<std::complex<double>, codi::OperationMultiply, std::complex<codi::ActiveType<Impl > >, std::complex<codi::ActiveType<Impl > > > >,
+    codi::AssignStatement<codi::ActiveType<Impl >, codi::ComputeExpression<double, codi::OperationAdd, codi::ActiveType<Impl >, codi::ComputeExpression<double, codi::OperationComplexNorm, std::complex<codi::ActiveType<Impl > > > > >,
+    codi::AssignStatement<codi::ActiveType<Impl >, codi::ActiveType<Impl > >>;
+};
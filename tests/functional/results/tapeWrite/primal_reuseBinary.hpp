@@ -15,4 +15,15 @@ std::vector<typename Tape::EvalHandle> primal_reuseBinaryCreateEvalHandles(){
   evalHandles[5] = Tape::StatementEvaluator::template createHandle<Impl, Impl, codi::AssignStatement<codi::ActiveType<codi::PrimalValueReuseTape<codi::PrimalValueTapeTypes<double, double, codi::ReuseIndexManager<int>, codi::InnerStatementEvaluator, codi::DefaultChunkedData> > >, codi::ComputeExpression<double, codi::OperationAdd, codi::ActiveType<codi::PrimalValueReuseTape<codi::PrimalValueTapeTypes<double, double, codi::ReuseIndexManager<int>, codi::InnerStatementEvaluator, codi::DefaultChunkedData> > >, codi::ComputeExpression<double, codi::OperationComplexNorm, std::complex<codi::ActiveType<codi::PrimalValueReuseTape<codi::PrimalValueTapeTypes<double, double, codi::ReuseIndexManager<int>, codi::InnerStatementEvaluator, codi::DefaultChunkedData> > > > > > >>();
 
   return evalHandles;
-}
\ No newline at end of file
+}
+
+template <typename Impl>
+struct primal_reuseBinaryStatementRegistry {
+  using Statements = std::tuple<
+    codi::AssignStatement<codi::ActiveType<Impl >, codi::ComputeExpression<double, codi::OperationSin, codi::ActiveType<Impl > > >,
+    codi::AssignStatement<codi::ActiveType<Impl >, codi::ComputeExpression<double, codi::OperationAdd, codi::ActiveType<Impl >, codi::ActiveType<Impl > > >,
+    codi::AssignStatement<codi::ActiveType<Impl >, codi::ComputeExpression<double, codi::OperationMultiply, codi::ActiveType<Impl >, codi::ActiveType<Impl > > >,
+    codi::AssignStatement<codi::ActiveType<Impl >, codi::ActiveType<Impl > >,
+    codi::AssignStatement<std::complex<codi::ActiveType<Impl > >, codi::ComputeExpression<std::complex<double>, codi::OperationMultiply, std::complex<codi::ActiveType<Impl > >, std::complex<codi::ActiveType<Impl > > > >,
+    codi::AssignStatement<codi::ActiveType<Impl >, codi::ComputeExpression<double, codi::OperationAdd, codi::ActiveType<Impl >, codi::ComputeExpression<double, codi::OperationComplexNorm, std::complex<codi::ActiveType<Impl > > > > >>;
+};
@@ -0,0 +1,169 @@
+/*
+ * CoDiPack, a Code Differentiation Package
+ *
+ * Copyright (C) 2015-2026 Chair for Scientific Computing (SciComp), RPTU University Kaiserslautern-Landau
+ * Homepage: http://scicomp.rptu.de
+ * Contact:  Prof. Nicolas R. Gauger (codi@scicomp.uni-kl.de)
+ *
+ * Lead developers: Max Sagebaum, Johannes Blühdorn (SciComp, RPTU University Kaiserslautern-Landau)
+ *
+ * This file is part of CoDiPack (http://scicomp.rptu.de/software/codi).
+ *
+ * CoDiPack is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * CoDiPack is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * See the GNU General Public License for more details.
+ * You should have received a copy of the GNU
+ * General Public License along with CoDiPack.
+ * If not, see <http://www.gnu.org/licenses/>.
+ *
+ * For other licensing options please contact us.
+ *
+ * Authors:
+ *  - SciComp, RPTU University Kaiserslautern-Landau:
+ *    - Max Sagebaum
+ *    - Johannes Blühdorn
+ *    - Former members:
+ *      - Tim Albring
+ */
+#include <codi.hpp>
+
+#include <fstream>
+
+// Mock of an adjoint halo exchange. In the reverse sweep, the adjoint of the received value is "sent" in the start
+// function and added to the sent value in the finish function.
+
+template<typename Real>
+struct Test {
+    using Tape = typename Real::Tape;
+    using Identifier = typename Real::Identifier;
+    using AsyncHelper = codi::AsyncReverseHelper<Real>;
+    using VectorAccess = typename AsyncHelper::VectorAccess;
+
+    struct Exchange {
+        std::ostream* out;
+        int number;
+        Identifier sentId;
+        Identifier receivedId;
+        double message;
+    };
+
+    static void start(Tape* tape, void* d, VectorAccess* access) {
+      Exchange* data = (Exchange*)d;
+
+      data->message = codi::RealTraits::getPassiveValue(access->getAdjoint(data->receivedId, 0));
+      access->resetAdjoint(data->receivedId, 0);
+
+      *data->out << "  start " << data->number << std::endl;
+    }
+
+    static void finish(Tape* tape, void* d, VectorAccess* access) {
+      Exchange* data = (Exchange*)d;
+
+      access->updateAdjoint(data->sentId, 0, data->message);
+
+      *data->out << "  finish " << data->number << std::endl;
+    }
+
+    static void deleteExchange(Tape* tape, void* d) {
+      delete (Exchange*)d;
+    }
+
+    static void marker(Tape* tape, void* d, VectorAccess* access) {
+      *(std::ostream*)d << "  local statements" << std::endl;
+    }
+
+    // Sends x and receives it as a new input of the tape.
+    static Real exchange(std::ostream& out, Real const& x, int number, typename AsyncHelper::Cut* cut) {
+      Real received = x.getValue();
+      Real::getTape().registerInput(received);
+
+      AsyncHelper::pushAsyncFunction(cut, start, finish,
+                                     new Exchange{&out, number, x.getIdentifier(), received.getIdentifier(), 0.0},
+                                     deleteExchange);
+
+      return received;
+    }
+
+    static void func(std::ostream& out, Real const& x, Real& y, bool overlap) {
+      Tape& tape = Real::getTape();
+
+      Real a = x * x;
+      Real b = sin(x);
+
+      typename AsyncHelper::Cut* cut = nullptr;
+      if (overlap) {
+        cut = AsyncHelper::addCut();
+      }
+
+      Real local = 2.0 * x;
+      for (int i = 0; i < 5; ++i) {
+        local = cos(local) * x;
+      }
+      if (overlap && tape.isActive()) {
+        tape.pushExternalFunction(codi::ExternalFunction<Tape>::create(marker, &out, nullptr));
+      }
+
+      if (!overlap) {
+        cut = AsyncHelper::addCut();
+      }
+      Real ra = exchange(out, a, 1, cut);
+      Real rb = exchange(out, b, 2, cut);
+
+      y = ra * rb + local;
+    }
+
+    static void run(std::ostream& out, bool overlap) {
+      Tape& tape = Real::getTape();
+
+      out << (overlap ? "Overlapped:" : "Synchronous:") << std::endl;
+
+      Real x = 1.3;
+      Real y;
+
+      tape.setActive();
+      tape.registerInput(x);
+      func(out, x, y, overlap);
+      tape.registerOutput(y);
+      tape.setPassive();
+
+      for (int e = 0; e < 2; ++e) {
+        tape.clearAdjoints();
+        y.setGradient(1.0);
+        tape.evaluate();
+
+        out << "  d y/d x = " << x.getGradient() << std::endl;
+      }
+
+      tape.reset();
+    }
+
+    static void runPassive(std::ostream& out) {
+      Real x = 1.3;
+      Real y;
+
+      func(out, x, y, true);
+      out << "Passive: y = " << y.getValue() << std::endl;
+    }
+
+    static void runAll(std::ostream& out) {
+      run(out, false);
+      run(out, true);
+      runPassive(out);
+    }
+};
+
+int main(int nargs, char** args) {
+  std::ofstream out("run.out");
+
+  out << "RealReverse:" << std::endl;
+  Test<codi::RealReverse>::runAll(out);
+  out << "RealReversePrimalIndex:" << std::endl;
+  Test<codi::RealReversePrimalIndex>::runAll(out);
+}
@@ -0,0 +1,123 @@
+/*
+ * CoDiPack, a Code Differentiation Package
+ *
+ * Copyright (C) 2015-2026 Chair for Scientific Computing (SciComp), RPTU University Kaiserslautern-Landau
+ * Homepage: http://scicomp.rptu.de
+ * Contact:  Prof. Nicolas R. Gauger (codi@scicomp.uni-kl.de)
+ *
+ * Lead developers: Max Sagebaum, Johannes Blühdorn (SciComp, RPTU University Kaiserslautern-Landau)
+ *
+ * This file is part of CoDiPack (http://scicomp.rptu.de/software/codi).
+ *
+ * CoDiPack is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * CoDiPack is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * See the GNU General Public License for more details.
+ * You should have received a copy of the GNU
+ * General Public License along with CoDiPack.
+ * If not, see <http://www.gnu.org/licenses/>.
+ *
+ * For other licensing options please contact us.
+ *
+ * Authors:
+ *  - SciComp, RPTU University Kaiserslautern-Landau:
+ *    - Max Sagebaum
+ *    - Johannes Blühdorn
+ *    - Former members:
+ *      - Tim Albring
+ */
+#include <codi.hpp>
+
+#include <fstream>
+#include <vector>
+
+template<typename Real>
+void func(std::vector<Real>& x, std::vector<Real>& y) {
+  size_t n = x.size();
+  std::vector<Real> v(n);
+  for (size_t i = 0; i < n; ++i) {
+    Real t = x[i] * x[(i + 1) % n];  // Temporaries reuse identifiers in index management tapes.
+    v[i] = sin(t) + x[i];
+  }
+  codi::axpy(x[0], x.data(), v.data(), n);  // Low level functions use temporary memory in the reverse evaluation.
+
+  for (size_t j = 0; j < y.size(); ++j) {
+    y[j] = codi::dotProduct(&v[j], &x[j], n - j) * v[n - 1 - j];
+  }
+}
+
+template<typename Real>
+void run(std::ostream& out, std::string const& name) {
+  using Tape = typename Real::Tape;
+  using Gradient = typename Tape::Gradient;
+
+  int constexpr N = 40;
+  int constexpr M = 32;
+  Tape& tape = Real::getTape();
+
+  std::vector<Real> x(N);
+  std::vector<Real> y(M);
+
+  tape.setActive();
+  for (int i = 0; i < N; ++i) {
+    x[i] = 1.0 + 0.01 * i;
+    tape.registerInput(x[i]);
+  }
+  func(x, y);
+  for (int j = 0; j < M; ++j) {
+    tape.registerOutput(y[j]);
+  }
+  tape.setPassive();
+
+  // Reference with sequential evaluations.
+  std::vector<std::vector<double>> reference(M, std::vector<double>(N));
+  for (int j = 0; j < M; ++j) {
+    y[j].gradient() = 1.0;
+    tape.evaluateKeepState(tape.getPosition(), tape.getZeroPosition());
+    for (int i = 0; i < N; ++i) {
+      reference[j][i] = x[i].getGradient();
+    }
+    tape.clearAdjoints();
+  }
+
+  size_t adjointSize = tape.getParameter(codi::TapeParameters::LargestIdentifier) + 1;
+  std::vector<std::vector<double>> results(M, std::vector<double>(N));
+
+#pragma omp parallel for num_threads(8)
+  for (int j = 0; j < M; ++j) {
+    std::vector<Gradient> adjoints(adjointSize);
+    adjoints[y[j].getIdentifier()] = 1.0;
+    tape.evaluateConcurrent(tape.getPosition(), tape.getZeroPosition(), adjoints.data());
+    for (int i = 0; i < N; ++i) {
+      results[j][i] = adjoints[x[i].getIdentifier()];
+    }
+  }
+
+  double maxDiff = 0.0;
+  for (int j = 0; j < M; ++j) {
+    for (int i = 0; i < N; ++i) {
+      maxDiff = std::max(maxDiff, std::abs(results[j][i] - reference[j][i]));
+    }
+  }
+
+  out << name << ":" << std::endl;
+  out << "  dy_0/dx_0 = " << results[0][0] << ", dy_31/dx_39 = " << results[M - 1][N - 1] << std::endl;
+  out << "  " << M << " concurrent sweeps, max difference = " << maxDiff << std::endl;
+
+  tape.reset();
+}
+
+int main(int nargs, char** args) {
+  std::ofstream out("run.out");
+
+  run<codi::RealReverse>(out, "RealReverse");
+  run<codi::RealReverseIndex>(out, "RealReverseIndex");
+  run<codi::RealReversePrimal>(out, "RealReversePrimal");
+  run<codi::RealReversePrimalIndex>(out, "RealReversePrimalIndex");
+}
@@ -0,0 +1,131 @@
+/*
+ * CoDiPack, a Code Differentiation Package
+ *
+ * Copyright (C) 2015-2026 Chair for Scientific Computing (SciComp), RPTU University Kaiserslautern-Landau
+ * Homepage: http://scicomp.rptu.de
+ * Contact:  Prof. Nicolas R. Gauger (codi@scicomp.uni-kl.de)
+ *
+ * Lead developers: Max Sagebaum, Johannes Blühdorn (SciComp, RPTU University Kaiserslautern-Landau)
+ *
+ * This file is part of CoDiPack (http://scicomp.rptu.de/software/codi).
+ *
+ * CoDiPack is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * CoDiPack is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * See the GNU General Public License for more details.
+ * You should have received a copy of the GNU
+ * General Public License along with CoDiPack.
+ * If not, see <http://www.gnu.org/licenses/>.
+ *
+ * For other licensing options please contact us.
+ *
+ * Authors:
+ *  - SciComp, RPTU University Kaiserslautern-Landau:
+ *    - Max Sagebaum
+ *    - Johannes Blühdorn
+ *    - Former members:
+ *      - Tim Albring
+ */
+#define CODI_PrimalConstantPool true
+
+#include <codi.hpp>
+
+#include <fstream>
+#include <sstream>
+
+template<typename Real>
+void record(Real* x, Real* y, int n) {
+  for (int i = 1; i < n - 1; ++i) {
+    y[i] = 0.25 * x[i - 1] + 0.5 * x[i] + 0.25 * x[i + 1];
+  }
+  y[0] = x[0] * (1.0 + n) + 2.0;
+  y[n - 1] = x[n - 1] * (2.0 + n) + 3.0;
+}
+
+template<typename Real>
+void run(std::ostream& out, std::string const& name) {
+  using Tape = typename Real::Tape;
+
+  int constexpr N = 10;
+  Tape& tape = Real::getTape();
+
+  out << name << ":" << std::endl;
+
+  for (int rec = 0; rec < 2; ++rec) {
+    Real x[N];
+    Real y[N];
+
+    tape.setActive();
+    for (int i = 0; i < N; ++i) {
+      x[i] = 1.0 + 0.1 * i;
+      tape.registerInput(x[i]);
+    }
+
+    record(x, y, N);
+
+    for (int i = 0; i < N; ++i) {
+      tape.registerOutput(y[i]);
+    }
+    tape.setPassive();
+
+    for (int i = 0; i < N; ++i) {
+      y[i].setGradient(1.0 + i);
+    }
+    tape.evaluate();
+
+    out << "  recording " << rec << std::endl;
+    out << "    d y/d x =";
+    for (int i = 0; i < N; ++i) {
+      out << " " << x[i].getGradient();
+    }
+    out << std::endl;
+
+    tape.clearAdjoints();
+    x[N / 2].setGradient(1.0);
+    tape.evaluateForward();
+    out << "    d y/d x_" << N / 2 << " =";
+    for (int i = 0; i < N; ++i) {
+      out << " " << y[i].getGradient();
+    }
+    out << std::endl;
+
+    for (int i = 0; i < N; ++i) {
+      tape.primal(x[i].getIdentifier()) = 2.0 + i;
+    }
+    tape.evaluatePrimal();
+    out << "    y(2 + i) =";
+    for (int i = 0; i < N; ++i) {
+      out << " " << tape.primal(y[i].getIdentifier());
+    }
+    out << std::endl;
+
+    std::stringstream stats;
+    tape.getTapeValues().formatDefault(stats);
+    std::string line;
+    int separators = -1;  // Print the entries of the constant pool section, they end at the second separator.
+    while (std::getline(stats, line) && separators < 2) {
+      if (std::string::npos != line.find("Constant pool")) {
+        separators = 0;
+      } else if (0 <= separators && std::string::npos != line.find("-----")) {
+        separators += 1;
+      } else if (0 <= separators) {
+        out << "  " << line << std::endl;
+      }
+    }
+
+    tape.reset();
+  }
+}
+
+int main(int nargs, char** args) {
+  std::ofstream out("run.out");
+
+  run<codi::RealReversePrimal>(out, "RealReversePrimal");
+  run<codi::RealReversePrimalIndex>(out, "RealReversePrimalIndex");
+}
@@ -56,10 +56,10 @@ struct IdStats {
       idUse[id] +=1;
     }
 
-    void handleStatement(Identifier& lhsIndex, codi::Config::ArgumentSize const& size, Real const* jacobians,
+    void handleStatement(Identifier& lhsIndex, size_t const& size, Real const* jacobians,
                          Identifier const* rhsIdentifiers) {
       count(lhsIndex);
-      for(codi::Config::ArgumentSize i = 0; i < size; i += 1) {
+      for(size_t i = 0; i < size; i += 1) {
         count(rhsIdentifiers[i]);
       }
     }
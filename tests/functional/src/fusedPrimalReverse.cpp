@@ -0,0 +1,114 @@
+/*
+ * CoDiPack, a Code Differentiation Package
+ *
+ * Copyright (C) 2015-2026 Chair for Scientific Computing (SciComp), RPTU University Kaiserslautern-Landau
+ * Homepage: http://scicomp.rptu.de
+ * Contact:  Prof. Nicolas R. Gauger (codi@scicomp.uni-kl.de)
+ *
+ * Lead developers: Max Sagebaum, Johannes Blühdorn (SciComp, RPTU University Kaiserslautern-Landau)
+ *
+ * This file is part of CoDiPack (http://scicomp.rptu.de/software/codi).
+ *
+ * CoDiPack is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * CoDiPack is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * See the GNU General Public License for more details.
+ * You should have received a copy of the GNU
+ * General Public License along with CoDiPack.
+ * If not, see <http://www.gnu.org/licenses/>.
+ *
+ * For other licensing options please contact us.
+ *
+ * Authors:
+ *  - SciComp, RPTU University Kaiserslautern-Landau:
+ *    - Max Sagebaum
+ *    - Johannes Blühdorn
+ *    - Former members:
+ *      - Tim Albring
+ */
+#include <codi.hpp>
+
+#include <fstream>
+#include <vector>
+
+template<typename Real>
+Real func(std::vector<Real> const& x) {
+  Real sum = 0.0;
+  for (size_t i = 0; i < x.size(); ++i) {
+    Real t = x[i] * x[(i + 1) % x.size()];  // Temporaries reuse identifiers in index management tapes.
+    Real s = sin(t) + x[i];
+    sum += s * s;
+  }
+  return sum;
+}
+
+template<typename Real>
+void run(std::ostream& out, std::string const& name) {
+  using Tape = typename Real::Tape;
+
+  int constexpr N = 5;
+  Tape& tape = Real::getTape();
+
+  out << name << ":" << std::endl;
+
+  for (int mode = 0; mode < 2; ++mode) {
+    std::vector<Real> x(N);
+    Real y;
+
+    tape.setActive();
+    for (int i = 0; i < N; ++i) {
+      x[i] = 1.0 + 0.1 * i;
+      tape.registerInput(x[i]);
+    }
+    y = func(x);
+    tape.registerOutput(y);
+    tape.setPassive();
+
+    out << "  " << (0 == mode ? "evaluatePrimal and evaluate" : "evaluatePrimalThenReverse") << std::endl;
+    for (int eval = 0; eval < 3; ++eval) {
+      double yValue = 0.0;
+
+      if (0 == mode) {
+        tape.revertPrimals(tape.getZeroPosition());
+        for (int i = 0; i < N; ++i) {
+          tape.primal(x[i].getIdentifier()) = 0.5 + 0.2 * i + 0.3 * eval;
+        }
+        tape.evaluatePrimal();
+        yValue = tape.primal(y.getIdentifier());
+        y.gradient() = 1.0;
+        tape.evaluate();
+      } else {
+        for (int i = 0; i < N; ++i) {
+          tape.primal(x[i].getIdentifier()) = 0.5 + 0.2 * i + 0.3 * eval;
+        }
+        tape.evaluatePrimalThenReverse([&]() {
+          yValue = tape.primal(y.getIdentifier());
+          y.gradient() = 1.0;
+        });
+      }
+
+      out << "    y = " << yValue << ", dy/dx =";
+      for (int i = 0; i < N; ++i) {
+        out << " " << x[i].getGradient();
+      }
+      out << std::endl;
+
+      tape.clearAdjoints();
+    }
+
+    tape.reset();
+  }
+}
+
+int main(int nargs, char** args) {
+  std::ofstream out("run.out");
+
+  run<codi::RealReversePrimal>(out, "RealReversePrimal");
+  run<codi::RealReversePrimalIndex>(out, "RealReversePrimalIndex");
+}
@@ -0,0 +1,109 @@
+/*
+ * CoDiPack, a Code Differentiation Package
+ *
+ * Copyright (C) 2015-2026 Chair for Scientific Computing (SciComp), RPTU University Kaiserslautern-Landau
+ * Homepage: http://scicomp.rptu.de
+ * Contact:  Prof. Nicolas R. Gauger (codi@scicomp.uni-kl.de)
+ *
+ * Lead developers: Max Sagebaum, Johannes Blühdorn (SciComp, RPTU University Kaiserslautern-Landau)
+ *
+ * This file is part of CoDiPack (http://scicomp.rptu.de/software/codi).
+ *
+ * CoDiPack is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * CoDiPack is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * See the GNU General Public License for more details.
+ * You should have received a copy of the GNU
+ * General Public License along with CoDiPack.
+ * If not, see <http://www.gnu.org/licenses/>.
+ *
+ * For other licensing options please contact us.
+ *
+ * Authors:
+ *  - SciComp, RPTU University Kaiserslautern-Landau:
+ *    - Max Sagebaum
+ *    - Johannes Blühdorn
+ *    - Former members:
+ *      - Tim Albring
+ */
+#include <codi.hpp>
+#include <codi/tools/mpi/codiMpiBufferPool.hpp>
+
+#include <fstream>
+
+// Stand-in for the buffer handling of the MeDiPack tool. Each exchange creates one buffer per neighbour, reduces the
+// data of all ranks into the first block, and releases the buffers again.
+
+int const neighbours = 6;
+int const ranks = 4;
+int const messageSizes[neighbours] = {10, 37, 100, 400, 37, 10};
+
+template<typename Real>
+void combineReference(Real* buf, int elements, int vecSize, int ranks) {
+  for (int curRank = 1; curRank < ranks; ++curRank) {
+    for (int curPos = 0; curPos < elements; ++curPos) {
+      for (int dim = 0; dim < vecSize; ++dim) {
+        buf[curPos * vecSize + dim] += buf[(elements * curRank + curPos) * vecSize + dim];
+      }
+    }
+  }
+}
+
+template<typename Real>
+void runTest(std::ostream& out, std::string const& name, int vecSize, int exchanges) {
+  codi::MpiBufferPool<Real> pool;
+
+  double maxError = 0.0;
+  std::vector<Real*> buffers(neighbours);
+  std::vector<Real> reference;
+
+  for (int curExchange = 0; curExchange < exchanges; ++curExchange) {
+    for (int curNeighbour = 0; curNeighbour < neighbours; ++curNeighbour) {
+      size_t size = (size_t)messageSizes[curNeighbour] * vecSize * ranks;
+      Real* buf = pool.alloc(size);
+      buffers[curNeighbour] = buf;
+
+      reference.resize(size);
+      for (size_t pos = 0; pos < size; ++pos) {
+        buf[pos] = 1.0 + 0.5 * (double)pos + curExchange;
+        reference[pos] = buf[pos];
+      }
+
+      combineReference(reference.data(), messageSizes[curNeighbour], vecSize, ranks);
+      codi::MpiBufferPool<Real>::combine(buf, (size_t)messageSizes[curNeighbour] * vecSize, ranks);
+
+      for (int pos = 0; pos < messageSizes[curNeighbour] * vecSize; ++pos) {
+        double error = std::abs(codi::RealTraits::getPassiveValue(buf[pos] - reference[pos]));
+        maxError = std::max(maxError, error);
+      }
+    }
+
+    // Release in a different order than the allocation, like for non-blocking communication.
+    for (int curNeighbour = neighbours - 1; curNeighbour >= 0; --curNeighbour) {
+      pool.free(buffers[curNeighbour]);
+    }
+  }
+
+  out << name << ":" << std::endl;
+  out << "  Exchanges: " << exchanges << std::endl;
+  out << "  Requests: " << pool.getRequestCount() << std::endl;
+  out << "  Allocations: " << pool.getAllocationCount() << std::endl;
+  out << "  Max combine error: " << maxError << std::endl;
+
+  pool.free(nullptr);
+  pool.clear();
+}
+
+int main(int nargs, char** args) {
+  std::ofstream out("run.out");
+
+  runTest<double>(out, "double", 1, 100);
+  runTest<double>(out, "double_vector", 3, 100);
+  runTest<codi::RealForward>(out, "forward_type", 1, 10);
+}
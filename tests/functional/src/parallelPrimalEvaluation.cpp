@@ -0,0 +1,161 @@
+/*
+ * CoDiPack, a Code Differentiation Package
+ *
+ * Copyright (C) 2015-2026 Chair for Scientific Computing (SciComp), RPTU University Kaiserslautern-Landau
+ * Homepage: http://scicomp.rptu.de
+ * Contact:  Prof. Nicolas R. Gauger (codi@scicomp.uni-kl.de)
+ *
+ * Lead developers: Max Sagebaum, Johannes Blühdorn (SciComp, RPTU University Kaiserslautern-Landau)
+ *
+ * This file is part of CoDiPack (http://scicomp.rptu.de/software/codi).
+ *
+ * CoDiPack is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * CoDiPack is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * See the GNU General Public License for more details.
+ * You should have received a copy of the GNU
+ * General Public License along with CoDiPack.
+ * If not, see <http://www.gnu.org/licenses/>.
+ *
+ * For other licensing options please contact us.
+ *
+ * Authors:
+ *  - SciComp, RPTU University Kaiserslautern-Landau:
+ *    - Max Sagebaum
+ *    - Johannes Blühdorn
+ *    - Former members:
+ *      - Tim Albring
+ */
+#define CODI_EnableOpenMP true
+
+#include <codi.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <vector>
+
+template<typename Real>
+void twiceFunc(Real const* x, size_t m, Real* y, size_t n, codi::ExternalFunctionUserData* d) {
+  for (size_t i = 0; i < n; ++i) {
+    y[i] = 2.0 * x[i];
+  }
+}
+
+template<typename Real>
+void twiceRev(Real const* x, Real* x_b, size_t m, Real const* y, Real const* y_b, size_t n,
+              codi::ExternalFunctionUserData* d) {
+  for (size_t i = 0; i < n; ++i) {
+    x_b[i] = 2.0 * y_b[i];
+  }
+}
+
+template<typename Real>
+void record(std::vector<Real>& x, std::vector<Real>& y) {
+  using PassiveReal = typename Real::Real;
+
+  size_t n = x.size();
+  std::vector<Real> a(n), b(n), e(n / 2);
+
+  // Independent statements on the first level.
+  a[0] = x[0] * x[1];
+  for (size_t i = 1; i < n - 1; ++i) {
+    a[i] = 0.25 * x[i - 1] + 0.5 * x[i] + 0.25 * x[i + 1];
+  }
+  a[n - 1] = x[n - 1] * x[n - 2];
+
+  // Statements with passive values.
+  Real p = 1.5;
+  for (size_t i = 0; i < n; ++i) {
+    b[i] = sin(a[i]) * p;
+  }
+
+  // Low level function with declared inputs and outputs.
+  Real d = codi::dotProduct(a.data(), b.data(), (int)n);
+
+  // Low level function without declared inputs and outputs.
+  codi::ExternalFunctionHelper<Real> eh;
+  for (size_t i = 0; i < e.size(); ++i) {
+    eh.addInput(b[i]);
+  }
+  for (size_t i = 0; i < e.size(); ++i) {
+    eh.addOutput(e[i]);
+  }
+  eh.callPrimalFunc(twiceFunc<PassiveReal>);
+  eh.addToTape(twiceRev<PassiveReal>);
+
+  // A chain of dependent statements.
+  Real s = d;
+  for (size_t i = 0; i < e.size(); ++i) {
+    s = s * 0.5 + e[i];
+  }
+
+  for (size_t i = 0; i < n; ++i) {
+    y[i] = b[i] * d + a[i] * s;
+  }
+}
+
+template<typename Real>
+void run(std::ostream& out, std::string const& name) {
+  using Tape = typename Real::Tape;
+
+  Tape& tape = Real::getTape();
+
+  out << name << ":" << std::endl;
+
+  for (size_t n : {600, 40}) {
+    std::vector<Real> x(n), y(n);
+
+    tape.setActive();
+    for (size_t i = 0; i < n; ++i) {
+      x[i] = 1.0 + 0.01 * i;
+      tape.registerInput(x[i]);
+    }
+
+    record(x, y);
+
+    for (size_t i = 0; i < n; ++i) {
+      tape.registerOutput(y[i]);
+    }
+    tape.setPassive();
+
+    out << "  n = " << n << std::endl;
+    for (int eval = 0; eval < 3; ++eval) {
+      for (size_t i = 0; i < n; ++i) {
+        tape.primal(x[i].getIdentifier()) = 2.0 - 0.01 * i + 0.1 * eval;
+      }
+      tape.evaluatePrimal();
+
+      std::vector<double> serial(n);
+      for (size_t i = 0; i < n; ++i) {
+        serial[i] = tape.primal(y[i].getIdentifier());
+        tape.primal(y[i].getIdentifier()) = 0.0;
+      }
+
+      tape.evaluatePrimalParallel();
+
+      double maxDiff = 0.0;
+      for (size_t i = 0; i < n; ++i) {
+        maxDiff = std::max(maxDiff, std::abs(serial[i] - tape.primal(y[i].getIdentifier())));
+      }
+
+      out << "    evaluation " << eval << ": y_0 = " << tape.primal(y[0].getIdentifier())
+          << " y_n-1 = " << tape.primal(y[n - 1].getIdentifier()) << " max difference to serial = " << maxDiff
+          << std::endl;
+    }
+
+    tape.reset();
+  }
+}
+
+int main(int nargs, char** args) {
+  std::ofstream out("run.out");
+
+  run<codi::RealReversePrimal>(out, "RealReversePrimal");
+}
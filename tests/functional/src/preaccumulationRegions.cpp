@@ -0,0 +1,231 @@
+/*
+ * CoDiPack, a Code Differentiation Package
+ *
+ * Copyright (C) 2015-2026 Chair for Scientific Computing (SciComp), RPTU University Kaiserslautern-Landau
+ * Homepage: http://scicomp.rptu.de
+ * Contact:  Prof. Nicolas R. Gauger (codi@scicomp.uni-kl.de)
+ *
+ * Lead developers: Max Sagebaum, Johannes Blühdorn (SciComp, RPTU University Kaiserslautern-Landau)
+ *
+ * This file is part of CoDiPack (http://scicomp.rptu.de/software/codi).
+ *
+ * CoDiPack is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * CoDiPack is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * See the GNU General Public License for more details.
+ * You should have received a copy of the GNU
+ * General Public License along with CoDiPack.
+ * If not, see <http://www.gnu.org/licenses/>.
+ *
+ * For other licensing options please contact us.
+ *
+ * Authors:
+ *  - SciComp, RPTU University Kaiserslautern-Landau:
+ *    - Max Sagebaum
+ *    - Johannes Blühdorn
+ *    - Former members:
+ *      - Tim Albring
+ */
+#include <codi.hpp>
+
+#include "../include/multLowLevelFunction.hpp"
+
+template<typename T_Real>
+struct Test {
+  using Real = CODI_DD(T_Real, codi::RealReverseIndex);
+  using Tape = typename Real::Tape;
+  using Id = typename Real::Identifier;
+  using IdVec = std::vector<Id>;
+
+  #define REAL_IN(name, value) \
+    Real name{value}; \
+    Real::getTape().registerInput(name); \
+    in.push_back(name.getIdentifier());
+
+  #define REAL_OUT(name, value) \
+    Real name{value}; \
+    Real::getTape().registerOutput(name); \
+    out.push_back(name.getIdentifier());
+
+  static void testChain(IdVec& in, IdVec& out) {
+    REAL_IN(x, 0.5);
+
+    Real t = x;
+    for (int i = 0; i < 20; i += 1) {
+      t = sin(t) * x + 0.1 * t;
+    }
+
+    REAL_OUT(y, t);
+  }
+
+  static void testTwoInputsTwoOutputs(IdVec& in, IdVec& out) {
+    REAL_IN(x0, 0.5);
+    REAL_IN(x1, 2.0);
+
+    Real a = x0 * x1;
+    Real b = x0 / x1;
+    for (int i = 0; i < 10; i += 1) {
+      a = sin(a) + b * x0;
+      b = cos(b) * a;
+    }
+
+    REAL_OUT(y0, a + b);
+    REAL_OUT(y1, a * b);
+  }
+
+  static void testInPlaceUpdate(IdVec& in, IdVec& out) {
+    REAL_IN(x, 0.5);
+
+    Real a = 2.0 * x;
+    Real b = 3.0 * x;
+    for (int i = 0; i < 30; i += 1) {
+      a = a * cos(a) + 0.5 * b;
+      b = b * 0.9;
+    }
+
+    REAL_OUT(y, a + b);
+  }
+
+  static void testDeadCode(IdVec& in, IdVec& out) {
+    REAL_IN(x, 0.5);
+
+    Real unused = x;
+    for (int i = 0; i < 20; i += 1) {
+      unused = sin(unused) * x;
+    }
+
+    REAL_OUT(y, x * x);
+  }
+
+  static void testLongChain(IdVec& in, IdVec& out) {
+    REAL_IN(x0, 0.5);
+    REAL_IN(x1, 1.5);
+
+    Real a = x0;
+    Real b = x1;
+    for (int i = 0; i < 40; i += 1) {
+      a = 0.1 * sin(a) * b + 0.95 * a;
+      if (0 == i % 10) {
+        b = cos(b) + 0.5 * a;
+      }
+    }
+
+    REAL_OUT(y, a * b);
+  }
+
+  static void testInPlaceRegions(IdVec& in, IdVec& out) {
+    REAL_IN(x, 0.5);
+
+    Real a = 2.0 * x;
+    for (int i = 0; i < 40; i += 1) {
+      a = 0.5 * sin(a) + 0.6 * a * x;
+    }
+
+    REAL_OUT(y, a);
+  }
+
+  static void testLLF(IdVec& in, IdVec& out) {
+    REAL_IN(x, 0.5);
+
+    Real t = x;
+    for (int i = 0; i < 20; i += 1) {
+      t = sin(t) * x + 0.1 * t;
+    }
+    Real w;
+    MultLowLevelFunction<Real>::evalAndStore(t, x, w);
+
+    REAL_OUT(y, w);
+  }
+
+  static void evalDerivatives(std::vector<double>& derivatives, IdVec const& in, IdVec const& out) {
+    Tape& tape = Real::getTape();
+
+    derivatives.clear();
+    for (Id const& curY : out) {
+      tape.gradient(curY) = 1.0;
+      tape.evaluate();
+
+      for (Id const& curX : in) {
+        derivatives.push_back(tape.gradient(curX));
+      }
+      tape.clearAdjoints();
+    }
+  }
+
+  template<bool rewrite, typename Func>
+  static void runTest(std::ofstream& out, std::string const& name, Func&& test, size_t maxRegionSize = 128) {
+    out << "Running: " << name << std::endl;
+
+    IdVec xId;
+    IdVec yId;
+
+    Tape& tape = Real::getTape();
+    tape.setActive();
+
+    test(xId, yId);
+
+    tape.setPassive();
+
+    std::vector<double> before;
+    evalDerivatives(before, xId, yId);
+
+    codi::PreaccumulationRegionOptimizer<Tape> optimizer{tape};
+    optimizer.maxRegionSize = maxRegionSize;
+    optimizer.analyze([&yId](auto&& func) {
+      for (Id& cur : yId) {
+        func(cur);
+      }
+    });
+    optimizer.writeReport(out);
+    optimizer.writeStatsVerbose(out);
+
+    if constexpr (rewrite) {
+      optimizer.rewrite();
+
+      std::vector<double> after;
+      evalDerivatives(after, xId, yId);
+
+      for (size_t curY = 0; curY < yId.size(); curY += 1) {
+        for (size_t curX = 0; curX < xId.size(); curX += 1) {
+          size_t pos = curY * xId.size() + curX;
+          out << "d y_" << curY << "/ d x_" << curX << " = " << after[pos];
+          if (!(std::abs(after[pos] - before[pos]) <= 1e-12 * std::max(1.0, std::abs(before[pos])))) {
+            out << " (mismatch, before " << before[pos] << ")";
+          }
+          out << "\n";
+        }
+      }
+    }
+
+    tape.resetHard();
+  }
+
+  template<bool rewrite>
+  static void runAllTests(std::ofstream& out) {
+    runTest<rewrite>(out, "testChain", testChain);
+    runTest<rewrite>(out, "testTwoInputsTwoOutputs", testTwoInputsTwoOutputs);
+    runTest<rewrite>(out, "testInPlaceUpdate", testInPlaceUpdate);
+    runTest<rewrite>(out, "testDeadCode", testDeadCode);
+    runTest<rewrite>(out, "testLongChain", testLongChain, 16);
+    runTest<rewrite>(out, "testInPlaceRegions", testInPlaceRegions, 16);
+    runTest<false>(out, "testLLF", testLLF);  // Tapes with low level functions are only analyzed.
+  }
+};
+
+int main(int nargs, char** args) {
+  std::ofstream out("run.out");
+
+  out << "RealReverseIndex:" << std::endl;
+  Test<codi::RealReverseIndex>::runAllTests<true>(out);
+
+  out << "RealReversePrimalIndex:" << std::endl;
+  Test<codi::RealReversePrimalIndex>::runAllTests<false>(out);
+
+  return 0;
+}
@@ -0,0 +1,118 @@
+/*
+ * CoDiPack, a Code Differentiation Package
+ *
+ * Copyright (C) 2015-2026 Chair for Scientific Computing (SciComp), RPTU University Kaiserslautern-Landau
+ * Homepage: http://scicomp.rptu.de
+ * Contact:  Prof. Nicolas R. Gauger (codi@scicomp.uni-kl.de)
+ *
+ * Lead developers: Max Sagebaum, Johannes Blühdorn (SciComp, RPTU University Kaiserslautern-Landau)
+ *
+ * This file is part of CoDiPack (http://scicomp.rptu.de/software/codi).
+ *
+ * CoDiPack is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * CoDiPack is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * See the GNU General Public License for more details.
+ * You should have received a copy of the GNU
+ * General Public License along with CoDiPack.
+ * If not, see <http://www.gnu.org/licenses/>.
+ *
+ * For other licensing options please contact us.
+ *
+ * Authors:
+ *  - SciComp, RPTU University Kaiserslautern-Landau:
+ *    - Max Sagebaum
+ *    - Johannes Blühdorn
+ *    - Former members:
+ *      - Tim Albring
+ */
+#include <codi.hpp>
+
+#include <fstream>
+#include <vector>
+
+template<typename Real>
+void func(std::vector<Real> const& x, std::vector<Real>& y) {
+  Real t = 0.0;
+  for (size_t i = 0; i < x.size(); ++i) {
+    t = t * 0.5 + sin(x[i]);  // Overwritten in every step, reuses identifiers in index management tapes.
+    y[i % y.size()] += t * x[(i + 1) % x.size()];
+  }
+}
+
+template<typename Real>
+void run(std::ostream& out, std::string const& name) {
+  using Tape = typename Real::Tape;
+  using PassiveReal = typename Tape::Real;
+  using Gradient = typename Tape::Gradient;
+
+  int constexpr N = 200;
+  int constexpr M = 3;
+  Tape& tape = Real::getTape();
+
+  std::vector<Real> x(N);
+  std::vector<Real> y(M);
+
+  tape.setActive();
+  for (int i = 0; i < N; ++i) {
+    x[i] = 1.0 + 0.01 * i;
+    tape.registerInput(x[i]);
+  }
+  func(x, y);
+  for (int j = 0; j < M; ++j) {
+    tape.registerOutput(y[j]);
+  }
+  tape.setPassive();
+
+  codi::PrimalVectorSnapshot<Tape> snapshot;
+  snapshot.capture(tape);
+
+  std::vector<PassiveReal> primals;
+  snapshot.initialize(primals);
+  std::vector<Gradient> adjoints(tape.getParameter(codi::TapeParameters::LargestIdentifier) + 1);
+
+  out << name << ":" << std::endl;
+  out << "  restored blocks: " << snapshot.getDirtyBlockCount() << " of " << snapshot.getBlockCount() << std::endl;
+
+  bool tapePrimalsUnchanged = true;
+  bool restored = true;
+  for (int j = 0; j < M; ++j) {
+    tape.gradient(y[j].getIdentifier()) = 1.0;
+    tape.evaluateKeepState(tape.getPosition(), tape.getZeroPosition());
+
+    std::fill(adjoints.begin(), adjoints.end(), Gradient());
+    adjoints[y[j].getIdentifier()] = 1.0;
+    tape.evaluateWithPrimals(tape.getPosition(), tape.getZeroPosition(), primals.data(), adjoints.data());
+
+    double maxDiff = 0.0;
+    for (int i = 0; i < N; ++i) {
+      maxDiff = std::max(maxDiff, std::abs(x[i].getGradient() - adjoints[x[i].getIdentifier()]));
+    }
+    out << "  y[" << j << "]: dy/dx[0] = " << x[0].getGradient() << ", dy/dx[" << N - 1
+        << "] = " << x[N - 1].getGradient() << ", max difference = " << maxDiff << std::endl;
+
+    snapshot.restore(primals.data());
+    restored &= primals == snapshot.getValues();
+    tapePrimalsUnchanged &= std::equal(primals.begin(), primals.end(), tape.getPrimalVector());
+
+    tape.clearAdjoints();
+  }
+
+  out << "  working vector restored: " << (restored ? "yes" : "no") << std::endl;
+  out << "  tape primals unchanged: " << (tapePrimalsUnchanged ? "yes" : "no") << std::endl;
+
+  tape.reset();
+}
+
+int main(int nargs, char** args) {
+  std::ofstream out("run.out");
+
+  run<codi::RealReversePrimal>(out, "RealReversePrimal");
+  run<codi::RealReversePrimalIndex>(out, "RealReversePrimalIndex");
+}
@@ -0,0 +1,113 @@
+/*
+ * CoDiPack, a Code Differentiation Package
+ *
+ * Copyright (C) 2015-2026 Chair for Scientific Computing (SciComp), RPTU University Kaiserslautern-Landau
+ * Homepage: http://scicomp.rptu.de
+ * Contact:  Prof. Nicolas R. Gauger (codi@scicomp.uni-kl.de)
+ *
+ * Lead developers: Max Sagebaum, Johannes Blühdorn (SciComp, RPTU University Kaiserslautern-Landau)
+ *
+ * This file is part of CoDiPack (http://scicomp.rptu.de/software/codi).
+ *
+ * CoDiPack is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * CoDiPack is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * See the GNU General Public License for more details.
+ * You should have received a copy of the GNU
+ * General Public License along with CoDiPack.
+ * If not, see <http://www.gnu.org/licenses/>.
+ *
+ * For other licensing options please contact us.
+ *
+ * Authors:
+ *  - SciComp, RPTU University Kaiserslautern-Landau:
+ *    - Max Sagebaum
+ *    - Johannes Blühdorn
+ *    - Former members:
+ *      - Tim Albring
+ */
+#include <codi.hpp>
+
+#include <fstream>
+
+#include "../../../documentation/generated_files/primal_reuse_text.hpp"
+
+template<typename Real>
+auto update(Real const& a, Real const& b) {
+  return a * b + 0.5 * sin(a);
+}
+
+template<typename Tape>
+struct Registry {
+    using Real = codi::ActiveType<Tape>;
+    using Update = decltype(update(std::declval<Real>(), std::declval<Real>()));
+    using Statements = std::tuple<codi::AssignStatement<Real, Real>, codi::AssignStatement<Real, Update>>;
+};
+
+using Switch = codi::SwitchStatementEvaluator<Registry>;
+
+template<typename Real>
+void run(std::ostream& out, std::string const& name) {
+  using Tape = typename Real::Tape;
+  using Stmt = codi::AssignStatement<Real, decltype(update(std::declval<Real>(), std::declval<Real>()))>;
+  using OtherStmt = codi::AssignStatement<Real, decltype(std::declval<Real>() - std::declval<Real>())>;
+
+  Tape& tape = Real::getTape();
+
+  out << name << ":" << std::endl;
+  out << "  handle size: " << sizeof(typename Tape::EvalHandle) << std::endl;
+  if (std::is_same<typename Tape::StatementEvaluator, Switch>::value) {
+    out << "  registered handle: " << Switch::createHandle<Tape, Tape, Stmt>() << std::endl;
+    out << "  fallback handle is registered: " << (Switch::createHandle<Tape, Tape, OtherStmt>() < 2) << std::endl;
+  }
+
+  Real x[2] = {1.3, 0.7};
+
+  tape.setActive();
+  tape.registerInput(x[0]);
+  tape.registerInput(x[1]);
+
+  Real a = x[0];
+  Real b = x[1];
+  for (int i = 0; i < 5; ++i) {
+    Real t = update(a, b);
+    b = a - b;
+    a = t;
+  }
+
+  Real y = 0.0;
+  codi::StatementPushHelper<Real> pushHelper;
+  pushHelper.startPushStatement();
+  pushHelper.pushArgument(a, 2.0);
+  pushHelper.pushArgument(b, 3.0);
+  pushHelper.endPushStatement(y, 2.0 * a.getValue() + 3.0 * b.getValue());
+
+  tape.registerOutput(y);
+  tape.setPassive();
+
+  y.setGradient(1.0);
+  tape.evaluate();
+
+  out << "  y = " << y.getValue() << std::endl;
+  out << "  d y/d x = " << x[0].getGradient() << " " << x[1].getGradient() << std::endl;
+
+  tape.reset();
+}
+
+int main(int nargs, char** args) {
+  std::ofstream out("run.out");
+
+  run<codi::RealReversePrimal>(out, "RealReversePrimal");
+  run<codi::RealReversePrimalGen<double, double, int, Switch>>(out, "RealReversePrimal switch");
+  run<codi::RealReversePrimalIndexGen<double, double, codi::MultiUseIndexManager<int>, Switch>>(
+      out, "RealReversePrimalIndex switch");
+  run<codi::RealReversePrimalIndexGen<double, double, codi::MultiUseIndexManager<int>,
+                                      codi::SwitchStatementEvaluator<primal_reuse_textStatementRegistry>>>(
+      out, "RealReversePrimalIndex generated registry");
+}
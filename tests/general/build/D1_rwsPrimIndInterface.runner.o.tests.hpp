@@ -0,0 +1 @@
+#define DRIVER_TESTS 	TestCopy,TestCopyHigherOrder,TestExpr,TestExprHigherOrder,TestIndices,TestOutput,TestOneArgumentExceptions,TestTwoArgumentExceptions,TestAssignOperators1,TestAssignOperators2,TestBigExpressions,TestIncrementOperators,TestOneArgumentExpr1,TestOneArgumentExpr2,TestOneArgumentExpr3,TestTwoArgumentExpr1,TestTwoArgumentExpr2,TestExtFunctionCall,TestExtFunctionCallMultiple,TestIO,TestSwap,TestReferenceActiveType,TestNumericLimits,TestEigenLinearSystemSolverHandler,TestEigenSparseLinearSystemSolverHandler,TestEnzymeExternalFunctionHelper,TestExternalFunctionHelper,TestExternalFunctionHelperPassive,TestPreaccumulation,TestPreaccumulationForward,TestPreaccumulationForwardInvalidAdjoint,TestPreaccumulationLargeStatement,TestPreaccumulationLocalAdjointVector,TestPreaccumulationLocalAdjointVectorForward,TestPreaccumulationLocalAdjointVectorForwardInvalidAdjoint,TestPreaccumulationLocalAdjointVectorLargeStatement,TestPreaccumulationLocalAdjointVectorOffset,TestPreaccumulationLocalAdjointVectorOffsetForward,TestPreaccumulationLocalAdjointVectorOffsetForwardInvalidAdjoint,TestPreaccumulationLocalAdjointVectorOffsetLargeStatement,TestPreaccumulationLocalAdjointVectorOffsetPassiveValue,TestPreaccumulationLocalAdjointVectorOffsetZeroJacobi,TestPreaccumulationLocalAdjointVectorPassiveValue,TestPreaccumulationLocalAdjointVectorPreprocessTape,TestPreaccumulationLocalAdjointVectorPreprocessTapeForward,TestPreaccumulationLocalAdjointVectorPreprocessTapeForwardInvalidAdjoint,TestPreaccumulationLocalAdjointVectorPreprocessTapeLargeStatement,TestPreaccumulationLocalAdjointVectorPreprocessTapePassiveValue,TestPreaccumulationLocalAdjointVectorPreprocessTapeZeroJacobi,TestPreaccumulationLocalAdjointVectorZeroJacobi,TestPreaccumulationLocalAdjoints,TestPreaccumulationLocalAdjointsForward,TestPreaccumulationLocalAdjointsForwardInvalidAdjoint,TestPreaccumulationLocalAdjointsLargeStatement,TestPreaccumulationLocalAdjointsPassiveValue,TestPreaccumulationLocalAdjointsZeroJacobi,TestPreaccumulationLocalMappedAdjoints,TestPreaccumulationLocalMappedAdjointsForward,TestPreaccumulationLocalMappedAdjointsForwardInvalidAdjoint,TestPreaccumulationLocalMappedAdjointsLargeStatement,TestPreaccumulationLocalMappedAdjointsPassiveValue,TestPreaccumulationLocalMappedAdjointsZeroJacobi,TestPreaccumulationPassiveValue,TestPreaccumulationZeroJacobi,TestReset,TestStatementPushHelper,TestMatrixMatrixMultiplication
@@ -0,0 +1,108 @@
+/*
+ * CoDiPack, a Code Differentiation Package
+ *
+ * Copyright (C) 2015-2026 Chair for Scientific Computing (SciComp), RPTU University Kaiserslautern-Landau
+ * Homepage: http://scicomp.rptu.de
+ * Contact:  Prof. Nicolas R. Gauger (codi@scicomp.uni-kl.de)
+ *
+ * Lead developers: Max Sagebaum, Johannes Blühdorn (SciComp, RPTU University Kaiserslautern-Landau)
+ *
+ * This file is part of CoDiPack (http://scicomp.rptu.de/software/codi).
+ *
+ * CoDiPack is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * CoDiPack is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * See the GNU General Public License for more details.
+ * You should have received a copy of the GNU
+ * General Public License along with CoDiPack.
+ * If not, see <http://www.gnu.org/licenses/>.
+ *
+ * For other licensing options please contact us.
+ *
+ * Authors:
+ *  - SciComp, RPTU University Kaiserslautern-Landau:
+ *    - Max Sagebaum
+ *    - Johannes Blühdorn
+ *    - Former members:
+ *      - Tim Albring
+ */
+#pragma once
+
+#include <codi.hpp>
+#include <codi/tools/data/jacobian.hpp>
+
+#include "reverse1stOrderBase.hpp"
+
+#include DRIVER_TESTS_INC
+
+struct CoDiReverse1stOrderRuntimeVector : public CoDiReverse1stOrderBase {
+  public:
+
+    using Number = CODI_DECLARE_DEFAULT(
+        CODI_TYPE, CODI_TEMPLATE(codi::LhsExpressionInterface<double, double, CODI_ANY, CODI_ANY>));
+
+    using Tape = CODI_DD(typename Number::Tape, CODI_T(codi::FullTapeInterface<double, double, int, CODI_ANY>));
+    using Base = CoDiReverse1stOrderBase;
+
+    using Gradient = Number::Gradient;
+    using Identifier = typename Number::Identifier;
+
+    using Base::Base;
+
+    Gradient& accessGradient(Number& value) {
+      return value.gradient();
+    }
+
+    void cleanup() {}
+
+    void evaluate() {}
+
+    void prepare() {}
+
+    void evaluateJacobian(TestInfo<Number>& info, Number* x, size_t inputs, Number* y, size_t outputs,
+                          codi::Jacobian<double>& jac) {
+      size_t const runtimeDim = 3;
+
+      Tape& tape = Number::getTape();
+
+      Base::setTapeSizes(tape);
+
+      tape.setActive();
+
+      for (size_t i = 0; i < inputs; ++i) {
+        tape.registerInput(x[i]);
+      }
+
+      info.func(x, y);
+
+      for (size_t i = 0; i < outputs; ++i) {
+        tape.registerOutput(y[i]);
+      }
+
+      tape.setPassive();
+
+      std::vector<Identifier> inputIds(inputs);
+      std::vector<Identifier> outputIds(outputs);
+      for (size_t i = 0; i < inputs; ++i) {
+        inputIds[i] = x[i].getIdentifier();
+      }
+      for (size_t i = 0; i < outputs; ++i) {
+        outputIds[i] = y[i].getIdentifier();
+      }
+
+      codi::RuntimeDirectionAdjoints<double> adjoints(
+          runtimeDim, (size_t)tape.getParameter(codi::TapeParameters::LargestIdentifier) + 1);
+
+      codi::Algorithms<Number>::computeJacobianCustomAdjoints(tape, tape.getZeroPosition(), tape.getPosition(),
+                                                              inputIds.data(), inputs, outputIds.data(), outputs,
+                                                              jac, adjoints);
+
+      tape.reset();
+    }
+};
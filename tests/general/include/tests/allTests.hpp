@@ -61,11 +61,15 @@
 #include "io/testIO.hpp"
 #include "io/testSwap.hpp"
 #include "tools/helpers/testEigenLinearSystemSolverHandler.hpp"
+#include "tools/helpers/testEigenLinearSystemSolverHandlerLU.hpp"
 #include "tools/helpers/testEigenSparseLinearSystemSolverHandler.hpp"
+#include "tools/helpers/testEigenSparseLinearSystemSolverHandlerLU.hpp"
+#include "tools/helpers/testEigenSparseLinearSystemSolverHandlerIterative.hpp"
 #include "tools/helpers/testEnzymeExternalFunctionHelper.hpp"
 #include "tools/helpers/testExternalFunctionHelper.hpp"
 #include "tools/helpers/testExternalFunctionHelperPassive.hpp"
 #include "tools/helpers/testPreaccumulation.hpp"
+#include "tools/helpers/testPreaccumulationBatch.hpp"
 #include "tools/helpers/testPreaccumulationForward.hpp"
 #include "tools/helpers/testPreaccumulationForwardInvalidAdjoint.hpp"
 #include "tools/helpers/testPreaccumulationLargeStatement.hpp"
@@ -103,7 +107,10 @@
 #include "tools/helpers/testPreaccumulationZeroJacobi.hpp"
 #include "tools/helpers/testReset.hpp"
 #include "tools/helpers/testStatementPushHelper.hpp"
+#include "tools/lowlevelFunctions/elementwise/testElementwiseMap.hpp"
 #include "tools/lowlevelFunctions/linearAlgebra/testMatrixMatrixMultiplication.hpp"
+#include "tools/lowlevelFunctions/linearAlgebra/testMatrixVectorMultiplication.hpp"
+#include "tools/lowlevelFunctions/linearAlgebra/testVectorOperations.hpp"
 #include "tools/testReferenceActiveType.hpp"
 #include "traits/testDataExtractionTraits.hpp"
 #include "traits/testNumericLimits.hpp"
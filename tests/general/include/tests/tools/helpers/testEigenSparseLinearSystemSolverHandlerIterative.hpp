@@ -0,0 +1,85 @@
+/*
+ * CoDiPack, a Code Differentiation Package
+ *
+ * Copyright (C) 2015-2026 Chair for Scientific Computing (SciComp), RPTU University Kaiserslautern-Landau
+ * Homepage: http://scicomp.rptu.de
+ * Contact:  Prof. Nicolas R. Gauger (codi@scicomp.uni-kl.de)
+ *
+ * Lead developers: Max Sagebaum, Johannes Blühdorn (SciComp, RPTU University Kaiserslautern-Landau)
+ *
+ * This file is part of CoDiPack (http://scicomp.rptu.de/software/codi).
+ *
+ * CoDiPack is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * CoDiPack is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * See the GNU General Public License for more details.
+ * You should have received a copy of the GNU
+ * General Public License along with CoDiPack.
+ * If not, see <http://www.gnu.org/licenses/>.
+ *
+ * For other licensing options please contact us.
+ *
+ * Authors:
+ *  - SciComp, RPTU University Kaiserslautern-Landau:
+ *    - Max Sagebaum
+ *    - Johannes Blühdorn
+ *    - Former members:
+ *      - Tim Albring
+ */
+
+#pragma once
+
+#include <codi.hpp>
+
+#include "../../../testInterface.hpp"
+#include "baseLinearSystemSolverHandler.hpp"
+
+struct TestEigenSparseLinearSystemSolverHandlerIterative : public TestInterface {
+  public:
+    NAME("EigenSparseLinearSystemSolverHandlerIterative")
+    IN(5)
+    OUT(2)
+    POINTS(1) = { {1.0, 2.0, 4.0, 20.0, 10.0} };
+
+#if CODI_EnableEigen
+    template<typename T>
+    using Matrix = Eigen::SparseMatrix<T>;
+    template<typename T>
+    using Vector = Eigen::Matrix<T, 2, 1>;
+#endif
+
+    template<typename Number>
+    static void func(Number* x, Number* y) {
+#if CODI_EnableEigen
+      Matrix<Number> A(2, 2);
+
+      std::vector<Eigen::Triplet<Number>> entries;
+      entries.push_back(Eigen::Triplet<Number>(0, 0, x[0]));
+      entries.push_back(Eigen::Triplet<Number>(0, 1, x[1]));
+      entries.push_back(Eigen::Triplet<Number>(1, 1, x[2]));
+      A.setFromTriplets(entries.begin(), entries.end());
+
+      Vector<Number> b = {x[3], x[4]};
+      Vector<Number> sol;
+
+      using Solver = codi::SparseEigenLinearSystemIterative<Number, Matrix, Vector>;
+#else
+      Number A[4] = {x[0], x[1], Number(), x[2]};
+      Number b[2] = {x[3], x[4]};
+      Number sol[2];
+
+      using Solver = int;
+#endif
+
+      BaseLinearSystemSolverHandler::func(Solver(), A, b, sol, b[0]);
+
+      y[0] = sol[0];
+      y[1] = sol[1];
+    }
+};
@@ -0,0 +1,79 @@
+/*
+ * CoDiPack, a Code Differentiation Package
+ *
+ * Copyright (C) 2015-2026 Chair for Scientific Computing (SciComp), RPTU University Kaiserslautern-Landau
+ * Homepage: http://scicomp.rptu.de
+ * Contact:  Prof. Nicolas R. Gauger (codi@scicomp.uni-kl.de)
+ *
+ * Lead developers: Max Sagebaum, Johannes Blühdorn (SciComp, RPTU University Kaiserslautern-Landau)
+ *
+ * This file is part of CoDiPack (http://scicomp.rptu.de/software/codi).
+ *
+ * CoDiPack is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * CoDiPack is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * See the GNU General Public License for more details.
+ * You should have received a copy of the GNU
+ * General Public License along with CoDiPack.
+ * If not, see <http://www.gnu.org/licenses/>.
+ *
+ * For other licensing options please contact us.
+ *
+ * Authors:
+ *  - SciComp, RPTU University Kaiserslautern-Landau:
+ *    - Max Sagebaum
+ *    - Johannes Blühdorn
+ *    - Former members:
+ *      - Tim Albring
+ */
+
+#pragma once
+
+#include "../../../testInterface.hpp"
+
+struct TestPreaccumulationBatch : public TestInterface {
+  public:
+    NAME("PreaccumulationBatch")
+    IN(2)
+    OUT(6)
+    POINTS(1) = { {1.0, 0.5} };
+
+    template<typename Number>
+    static void evalRegion(Number* x, Number* y, double scale, bool extraStatement) {
+      y[0] = scale * x[0];
+      y[1] = x[1];
+      for (int i = 0; i < 3; ++i) {
+        Number xTemp = y[0];
+        Number yTemp = y[1];
+
+        y[0] = xTemp * xTemp - yTemp * yTemp - 0.65;
+        y[1] = 2.0 * yTemp * xTemp;
+      }
+
+      if (extraStatement) {
+        y[1] = sin(y[1]) * y[0];
+      }
+    }
+
+    template<typename Number>
+    static void func(Number* x, Number* y) {
+      codi::PreaccumulationBatchHelper<Number> ph;
+
+      // The first two regions have the same structure, the last one has an additional statement.
+      for (int r = 0; r < 3; ++r) {
+        ph.start(x[0], x[1]);
+
+        evalRegion(x, &y[2 * r], 1.0 - 0.1 * r, 2 == r);
+
+        ph.finishBatched(y[2 * r], y[2 * r + 1]);
+      }
+
+      ph.preaccumulateBatch();
+    }
+};
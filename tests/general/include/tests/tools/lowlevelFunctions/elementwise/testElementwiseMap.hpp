@@ -0,0 +1,110 @@
+/*
+ * CoDiPack, a Code Differentiation Package
+ *
+ * Copyright (C) 2015-2026 Chair for Scientific Computing (SciComp), RPTU University Kaiserslautern-Landau
+ * Homepage: http://scicomp.rptu.de
+ * Contact:  Prof. Nicolas R. Gauger (codi@scicomp.uni-kl.de)
+ *
+ * Lead developers: Max Sagebaum, Johannes Blühdorn (SciComp, RPTU University Kaiserslautern-Landau)
+ *
+ * This file is part of CoDiPack (http://scicomp.rptu.de/software/codi).
+ *
+ * CoDiPack is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * CoDiPack is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * See the GNU General Public License for more details.
+ * You should have received a copy of the GNU
+ * General Public License along with CoDiPack.
+ * If not, see <http://www.gnu.org/licenses/>.
+ *
+ * For other licensing options please contact us.
+ *
+ * Authors:
+ *  - SciComp, RPTU University Kaiserslautern-Landau:
+ *    - Max Sagebaum
+ *    - Johannes Blühdorn
+ *    - Former members:
+ *      - Tim Albring
+ */
+#pragma once
+
+#include <codi.hpp>
+
+#include <vector>
+
+#include "../../../../testInterface.hpp"
+
+struct TestElementwiseMap : public TestInterface {
+  public:
+    NAME("ElementwiseMap")
+    IN(2)
+    OUT(5)
+    POINTS(1) = { {0.5, 2.0} };
+
+    static int constexpr N = 4;
+    static int constexpr LARGE = 5000;  // Requires several low level function calls.
+
+    template<typename Number>
+    static void func(Number* x, Number* y) {
+      Number a[N];
+      Number b[N];
+      for (int i = 0; i < N; i += 1) {
+        a[i] = (1.0 + i) * x[0];
+        b[i] = x[1] + 0.5 * i;
+      }
+
+      std::vector<Number> c(LARGE);
+      for (int i = 0; i < LARGE; i += 1) {
+        c[i] = (1.0 + 0.001 * (i % 7)) * x[i % 2];
+      }
+
+      Number r[N];
+      std::vector<Number> d(LARGE);
+
+#if REVERSE_TAPE
+      codi::elementwiseExp(a, r, N);
+      y[0] = r[0] * r[N - 1];
+      codi::elementwiseLog(b, r, N);
+      codi::elementwiseSqrt(r, r, N);
+      y[1] = r[1] * r[2];
+      codi::elementwiseTanh(a, r, N);
+      codi::elementwiseMultiply(r, b, r, N);
+      y[2] = r[0] + r[N - 1];
+      codi::elementwiseMap<codi::OperationDivide>(&x[1], 1, a, N, r, N);
+      codi::elementwisePow(r, x[0], r, N);
+      y[3] = r[0] * r[N - 1];
+
+      codi::elementwiseSigmoid(c.data(), d.data(), LARGE);
+      codi::elementwiseMultiply(c.data(), d.data(), d.data(), LARGE);
+      y[4] = d[0] * d[LARGE - 2] + d[LARGE - 1];
+#else
+      for (int i = 0; i < N; i += 1) {
+        r[i] = exp(a[i]);
+      }
+      y[0] = r[0] * r[N - 1];
+      for (int i = 0; i < N; i += 1) {
+        r[i] = sqrt(log(b[i]));
+      }
+      y[1] = r[1] * r[2];
+      for (int i = 0; i < N; i += 1) {
+        r[i] = tanh(a[i]) * b[i];
+      }
+      y[2] = r[0] + r[N - 1];
+      for (int i = 0; i < N; i += 1) {
+        r[i] = pow(x[1] / a[i], x[0]);
+      }
+      y[3] = r[0] * r[N - 1];
+
+      for (int i = 0; i < LARGE; i += 1) {
+        d[i] = c[i] / (1.0 + exp(-c[i]));
+      }
+      y[4] = d[0] * d[LARGE - 2] + d[LARGE - 1];
+#endif
+    }
+};
@@ -0,0 +1,97 @@
+/*
+ * CoDiPack, a Code Differentiation Package
+ *
+ * Copyright (C) 2015-2026 Chair for Scientific Computing (SciComp), RPTU University Kaiserslautern-Landau
+ * Homepage: http://scicomp.rptu.de
+ * Contact:  Prof. Nicolas R. Gauger (codi@scicomp.uni-kl.de)
+ *
+ * Lead developers: Max Sagebaum, Johannes Blühdorn (SciComp, RPTU University Kaiserslautern-Landau)
+ *
+ * This file is part of CoDiPack (http://scicomp.rptu.de/software/codi).
+ *
+ * CoDiPack is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * CoDiPack is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * See the GNU General Public License for more details.
+ * You should have received a copy of the GNU
+ * General Public License along with CoDiPack.
+ * If not, see <http://www.gnu.org/licenses/>.
+ *
+ * For other licensing options please contact us.
+ *
+ * Authors:
+ *  - SciComp, RPTU University Kaiserslautern-Landau:
+ *    - Max Sagebaum
+ *    - Johannes Blühdorn
+ *    - Former members:
+ *      - Tim Albring
+ */
+#pragma once
+
+#include <codi.hpp>
+
+#include <vector>
+
+#include "../../../../testInterface.hpp"
+
+struct TestMatrixVectorMultiplication : public TestInterface {
+  public:
+    NAME("MatrixVectorMultiplication")
+    IN(2)
+    OUT(4)
+    POINTS(1) = { {2.0, 3.0} };
+
+    static int constexpr N = 3;
+    static int constexpr M = 2;
+    static int constexpr LARGE = 3000;  // Requires several low level function calls.
+
+    template<typename Number>
+    static void func(Number* x, Number* y) {
+      Number A[N * M] = {1.0 * x[0], 2.0 * x[1], 3.0 * x[0], 4.0, 5.0 * x[1], 6.0 * x[0]};
+      Number v[M] = {x[0] * x[1], x[1]};
+      Number w[N] = {x[0], 2.0, x[1]};
+      Number r[N];
+      Number rt[M];
+
+      std::vector<Number> B(LARGE * M);
+      std::vector<Number> c(LARGE);
+      std::vector<Number> ct(M);
+      for (int i = 0; i < LARGE * M; i += 1) {
+        B[i] = (1.0 + i % 3) * x[i % 2];
+      }
+
+#if REVERSE_TAPE
+      codi::matrixVectorMultiplicationRowMajor(A, v, r, N, M);
+      codi::matrixTransposeVectorMultiplicationRowMajor(A, w, rt, N, M);
+      codi::matrixVectorMultiplicationColMajor(B.data(), v, c.data(), LARGE, M);
+      codi::matrixTransposeVectorMultiplicationColMajor(B.data(), c.data(), ct.data(), LARGE, M);
+#else
+      for (int i = 0; i < N; i += 1) {
+        r[i] = A[i * M + 0] * v[0] + A[i * M + 1] * v[1];
+      }
+      for (int j = 0; j < M; j += 1) {
+        rt[j] = A[0 * M + j] * w[0] + A[1 * M + j] * w[1] + A[2 * M + j] * w[2];
+      }
+      for (int i = 0; i < LARGE; i += 1) {
+        c[i] = B[0 * LARGE + i] * v[0] + B[1 * LARGE + i] * v[1];
+      }
+      for (int j = 0; j < M; j += 1) {
+        ct[j] = 0.0;
+        for (int i = 0; i < LARGE; i += 1) {
+          ct[j] += B[j * LARGE + i] * c[i];
+        }
+      }
+#endif
+
+      y[0] = r[0] * r[1] + r[2];
+      y[1] = rt[0] * rt[1];
+      y[2] = c[0] * c[LARGE - 1];
+      y[3] = ct[0] + ct[1] * ct[1];
+    }
+};
@@ -0,0 +1,103 @@
+/*
+ * CoDiPack, a Code Differentiation Package
+ *
+ * Copyright (C) 2015-2026 Chair for Scientific Computing (SciComp), RPTU University Kaiserslautern-Landau
+ * Homepage: http://scicomp.rptu.de
+ * Contact:  Prof. Nicolas R. Gauger (codi@scicomp.uni-kl.de)
+ *
+ * Lead developers: Max Sagebaum, Johannes Blühdorn (SciComp, RPTU University Kaiserslautern-Landau)
+ *
+ * This file is part of CoDiPack (http://scicomp.rptu.de/software/codi).
+ *
+ * CoDiPack is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * CoDiPack is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * See the GNU General Public License for more details.
+ * You should have received a copy of the GNU
+ * General Public License along with CoDiPack.
+ * If not, see <http://www.gnu.org/licenses/>.
+ *
+ * For other licensing options please contact us.
+ *
+ * Authors:
+ *  - SciComp, RPTU University Kaiserslautern-Landau:
+ *    - Max Sagebaum
+ *    - Johannes Blühdorn
+ *    - Former members:
+ *      - Tim Albring
+ */
+#pragma once
+
+#include <codi.hpp>
+
+#include <vector>
+
+#include "../../../../testInterface.hpp"
+
+struct TestVectorOperations : public TestInterface {
+  public:
+    NAME("VectorOperations")
+    IN(2)
+    OUT(5)
+    POINTS(1) = { {2.0, 3.0} };
+
+    static int constexpr N = 4;
+    static int constexpr LARGE = 6000;  // Requires several low level function calls.
+
+    template<typename Number>
+    static void func(Number* x, Number* y) {
+      Number a[N];
+      Number b[N];
+      for (int i = 0; i < N; i += 1) {
+        a[i] = (1.0 + i) * x[0];
+        b[i] = x[1] - i;
+      }
+
+      std::vector<Number> c(LARGE);
+      std::vector<Number> d(LARGE);
+      for (int i = 0; i < LARGE; i += 1) {
+        c[i] = (1.0 + i % 7) * x[i % 2];
+        d[i] = x[(i + 1) % 2] - (i % 5);
+      }
+
+#if REVERSE_TAPE
+      y[0] = codi::dotProduct(a, b, N);
+      y[1] = codi::sum(a, N) * codi::norm2(b, N);
+      codi::axpy(x[1], a, b, N);
+      codi::scale(x[0], b, N);
+      y[2] = b[0] * b[N - 1];
+      y[3] = codi::dotProduct(c.data(), d.data(), LARGE);
+      codi::axpy(x[0], c.data(), d.data(), LARGE);
+      y[4] = codi::sum(d.data(), LARGE) * d[LARGE - 1];
+#else
+      y[0] = 0.0;
+      y[1] = 0.0;
+      Number normSquared = 0.0;
+      for (int i = 0; i < N; i += 1) {
+        y[0] += a[i] * b[i];
+        y[1] += a[i];
+        normSquared += b[i] * b[i];
+      }
+      y[1] *= sqrt(normSquared);
+      for (int i = 0; i < N; i += 1) {
+        b[i] = x[0] * (x[1] * a[i] + b[i]);
+      }
+      y[2] = b[0] * b[N - 1];
+
+      y[3] = 0.0;
+      Number sum = 0.0;
+      for (int i = 0; i < LARGE; i += 1) {
+        y[3] += c[i] * d[i];
+        d[i] = x[0] * c[i] + d[i];
+        sum += d[i];
+      }
+      y[4] = sum * d[LARGE - 1];
+#endif
+    }
+};